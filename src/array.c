@@ -164,7 +164,9 @@ void array_reset_data_strings(array * const a) {
 	for (uint32_t i = 0; i < used; ++i) {
 		data_string * const ds = data[i];
 		/*force_assert(ds->type == TYPE_STRING);*/
-		buffer_reset(&ds->key);
+		/* (keep key for reuse of element by key;
+		 *  see array_get_unused_string_ext()) */
+		if (ds->key.size > BUFFER_MAX_REUSE_SIZE) buffer_reset(&ds->key);
 		buffer_reset(&ds->value);
 	}
 }
@@ -384,11 +386,37 @@ static data_string * array_insert_string_at_pos(array * const a, const uint_fast
     return (data_string *)array_insert_data_at_pos(a, (data_unset *)ds, pos);
 }
 
+static void array_get_unused_string_ext(array * const a, const int ext, const char * const k, const uint32_t klen) {
+    /* prefer to reuse an unused element which previously held the same key,
+     * e.g. request headers on keep-alive connections, so that large values
+     * (e.g. Cookie, Authorization) reuse the same allocated value buffer
+     * rather than growing (realloc) the buffers of multiple unused elements
+     * when header order differs between requests.  Check a limited number of
+     * unused elements; move match (if any) to a->data[a->used] for reuse
+     * (reuses element and buffer allocations only; key and value are still
+     *  copied into the element by the caller for each header inserted) */
+    data_unset ** const data = a->data;
+    const uint32_t used = a->used;
+    const uint32_t sz = (a->size - used > 16) ? used + 16 : a->size;
+    for (uint32_t i = used; i < sz; ++i) {
+        const data_string * const ds = (data_string *)data[i];
+        if (NULL == ds || ds->type != TYPE_STRING || ds->ext != ext) continue;
+        if (0 == ext && !buffer_eq_slen(&ds->key, k, klen)) continue;
+        if (i != used) {
+            data[i] = data[used];
+            data[used] = (data_unset *)ds;
+        }
+        break;
+    }
+}
+
 __attribute_hot__
 buffer * array_get_buf_ptr_ext(array * const a, const int ext, const char * const k, const uint32_t klen) {
     int32_t ipos = array_get_index_ext(a, ext, k, klen);
     if (ipos >= 0) return &((data_string *)a->sorted[ipos])->value;
 
+    if (a->used < a->size)
+        array_get_unused_string_ext(a, ext, k, klen);
     data_string * const ds = array_insert_string_at_pos(a, (uint32_t)(-ipos-1));
     ds->ext = ext;
     buffer_copy_string_len(&ds->key, k, klen);
@@ -11,6 +11,7 @@
 
 #include "buffer.h"
 #include "base64.h"
+#include "sys-simd.h"
 
 static const char hex_chars_uc[] = "0123456789ABCDEF";
 
@@ -334,21 +335,72 @@ static int burl_scan_qmark (const buffer * const b) {
 }
 
 
-int burl_normalize (buffer *b, buffer *t, int flags)
+/* scan URL in a single pass to check if already normalized: no char needs
+ * encoding (including '%' and '#') and, if removing or rejecting dot-segments,
+ * no "/." or "//" (or leading '.') in url-path.  (Each step in
+ * burl_normalize_steps() would then make no changes.)
+ * return qs (offset of '?' as burl_normalize_basic_*() would return, or -1)
+ * if URL is already normalized, or -3 if URL needs burl_normalize_steps() */
+__attribute_pure__
+static int burl_normalize_scan (const buffer * const b, const int flags)
 {
-    int qs;
-
-  #if defined(_WIN32) || defined(__CYGWIN__)
-    /* Windows and Cygwin treat '\\' as '/' if '\\' is present in path;
-     * convert to '/' for consistency before percent-encoding
-     * normalization which will convert '\\' to "%5C" in the URL.
-     * (Clients still should not be sending '\\' unencoded in requests.) */
-    if (flags & HTTP_PARSEOPT_URL_NORMALIZE_PATH_BACKSLASH_TRANS) {
-        for (char *p = b->ptr; *p != '?' && *p != '\0'; ++p) {
-            if (*p == '\\') *p = '/';
+    const unsigned char * const s = (unsigned char *)b->ptr;
+    const int used = (int)buffer_clen(b);
+    const int qlast = (flags & HTTP_PARSEOPT_URL_NORMALIZE_REQUIRED);
+    int qs = -1;  /* first '?' (or last '?' if qlast) */
+    int seg = -1; /* first "/." or "//" (offset of second char) */
+    int i = 0;
+  #ifdef LI_SIMD
+    li_simd_mask_t sprev = 0;
+    for (; i + LI_SIMD <= used; i += LI_SIMD) {
+        /* chars for which encoded_chars_http_uri_reqd[] is set */
+        const li_simd_t v = li_simd_load(s+i);
+        const li_simd_t e1 =
+          li_simd_vor(li_simd_vor(li_simd_vlt(v, 0x21), li_simd_vge(v, 0x7F)),
+                      li_simd_vor(li_simd_vrange(v, '"', '#'),
+                                  li_simd_veq(v, '%')));
+        const li_simd_t e2 =
+          li_simd_vor(li_simd_vor(li_simd_veq(v, '<'), li_simd_veq(v, '>')),
+                      li_simd_vor(li_simd_vrange(v, '[', '^'),
+                                  li_simd_veq(v, '`')));
+        const li_simd_t e3 = li_simd_vrange(v, '{', '}');
+        if (li_simd_movemask(li_simd_vor(li_simd_vor(e1, e2), e3)))
+            return -3;
+        const li_simd_mask_t q = li_simd_eq(v, '?');
+        if (q && (qlast || qs < 0))
+            qs = i + (int)(qlast ? li_simd_mask_last(q) : li_simd_mask_first(q));
+        const li_simd_mask_t sl = li_simd_eq(v, '/');
+        if (seg < 0) {
+            const li_simd_mask_t m = li_simd_mask_shift1(sl, sprev)
+                                   & (sl | li_simd_eq(v, '.'));
+            if (m) seg = i + (int)li_simd_mask_first(m);
         }
+        sprev = sl;
     }
   #endif
+    for (; i < used; ++i) {
+        if (encoded_chars_http_uri_reqd[s[i]])
+            return -3;
+        if (s[i] == '?') {
+            if (qlast || qs < 0) qs = i;
+        }
+        else if ((s[i] == '/' || s[i] == '.') && i && s[i-1] == '/') {
+            if (seg < 0) seg = i;
+        }
+    }
+
+    if ((flags & (HTTP_PARSEOPT_URL_NORMALIZE_PATH_DOTSEG_REMOVE
+                 |HTTP_PARSEOPT_URL_NORMALIZE_PATH_DOTSEG_REJECT))
+        && ((used && s[0] == '.') || (seg >= 0 && (qs < 0 || seg < qs))))
+        return -3;
+
+    return qs;
+}
+
+
+static int burl_normalize_steps (buffer *b, buffer *t, int flags)
+{
+    int qs;
 
     qs = (flags & HTTP_PARSEOPT_URL_NORMALIZE_REQUIRED)
       ? burl_normalize_basic_required(b, t)
@@ -382,6 +434,26 @@ int burl_normalize (buffer *b, buffer *t, int flags)
 }
 
 
+int burl_normalize (buffer *b, buffer *t, int flags)
+{
+  #if defined(_WIN32) || defined(__CYGWIN__)
+    /* Windows and Cygwin treat '\\' as '/' if '\\' is present in path;
+     * convert to '/' for consistency before percent-encoding
+     * normalization which will convert '\\' to "%5C" in the URL.
+     * (Clients still should not be sending '\\' unencoded in requests.) */
+    if (flags & HTTP_PARSEOPT_URL_NORMALIZE_PATH_BACKSLASH_TRANS) {
+        for (char *p = b->ptr; *p != '?' && *p != '\0'; ++p) {
+            if (*p == '\\') *p = '/';
+        }
+    }
+  #endif
+
+    /* common case: URL is already normalized */
+    const int qs = burl_normalize_scan(b, flags);
+    return (qs != -3) ? qs : burl_normalize_steps(b, t, flags);
+}
+
+
 static void burl_append_encode_nde (buffer * const b, const char * const str, const size_t len)
 {
     /* percent-encodes everything except unreserved  - . 0-9 A-Z _ a-z ~
@@ -30,6 +30,9 @@
 /* keep in sync with h1.c */
 #define HTTP_LINGER_TIMEOUT 5
 
+/* max size of responses to pipelined requests coalesced into a single write */
+#define MAX_WRITE_BATCH 16384
+
 #define connection_set_state(r,state)       request_set_state((r),(state))
 #define connection_set_state_error(r,state) request_set_state_error((r),(state))
 
@@ -41,6 +44,8 @@ static connection *connection_init(server *srv);
 __attribute_noinline__
 static void connection_reset(connection *con);
 
+static int connection_write_chunkqueue(connection *con, chunkqueue *cq, off_t max_bytes);
+
 static connection *connections_get_new_connection(server *srv) {
     connection *con;
     --srv->lim_conns;
@@ -192,8 +197,13 @@ static void connection_handle_response_end_state(request_st * const r, connectio
 	    || r->state == CON_STATE_ERROR) {
 		/* request body may not have been read completely */
 		r->keep_alive = 0;
-		/* clean up failed partial write of 1xx intermediate responses*/
+		/* flush responses to prior pipelined requests deferred by
+		 * connection_write_defer() (not yet prepended to a response) and
+		 * clean up failed partial write of 1xx intermediate responses */
 		if (&r->write_queue != con->write_queue) { /*(for HTTP/1.1)*/
+			if (!chunkqueue_is_empty(con->write_queue))
+				connection_write_chunkqueue(con, con->write_queue,
+				                            MAX_WRITE_LIMIT);
 			chunkqueue_free(con->write_queue);
 			con->write_queue = &r->write_queue;
 		}
@@ -334,11 +344,63 @@ static int connection_handle_write(request_st * const r, connection * const con)
 	return CON_STATE_WRITE; /*(state did not change)*/
 }
 
+static int
+connection_write_defer (request_st * const r, connection * const con)
+{
+    /* batch responses to pipelined HTTP/1.x requests: if response is complete
+     * and small, and another request is already in con->read_queue, move the
+     * response to a separate con->write_queue instead of writing it now.
+     * The deferred data is sent ahead of the next response headers (see
+     * h1_send_headers()), or flushed by connection_handle_write_deferred()
+     * if the next request is incomplete or waits on an event */
+    if (r->keep_alive <= 0
+        || r->reqbody_length != r->reqbody_queue.bytes_in
+        || r->http_version > HTTP_VERSION_1_1
+        || con->write_queue != &r->write_queue
+        || chunkqueue_is_empty(con->read_queue)
+        || con->traffic_limit_reached)
+        return 0;
+
+    chunkqueue * const cq = &r->write_queue;
+    for (const chunk *c = cq->first; c; c = c->next) {
+        if (c->type != MEM_CHUNK) return 0;
+    }
+    if (chunkqueue_length(cq) > MAX_WRITE_BATCH) return 0;
+
+    /* (copy bytes for accounting purposes; see h1_send_1xx_info()) */
+    con->write_queue = chunkqueue_init(NULL);
+    con->write_queue->bytes_in = cq->bytes_out; /*(yes, bytes_out)*/
+    con->write_queue->bytes_out = cq->bytes_out;
+    chunkqueue_append_chunkqueue(con->write_queue, cq);
+    return 1;
+}
+
+
+static void
+connection_handle_write_deferred (request_st * const r, connection * const con)
+{
+    /* flush responses deferred by connection_write_defer() */
+    chunkqueue * const cq = con->write_queue;
+    if (cq == &r->write_queue) return;
+    if (!chunkqueue_is_empty(cq)
+        && connection_handle_write(r, con) != CON_STATE_WRITE)
+        return;
+    if (chunkqueue_is_empty(cq)) {
+        chunkqueue_free(cq);
+        con->write_queue = &r->write_queue;
+    }
+}
+
+
 static int connection_handle_write_state(request_st * const r, connection * const con) {
     int loop_once = 0;
     do {
         /* only try to write if we have something in the queue */
         if (!chunkqueue_is_empty(&r->write_queue)) {
+            if (r->resp_body_finished && connection_write_defer(r, con)) {
+                connection_set_state(r, CON_STATE_RESPONSE_END);
+                return CON_STATE_RESPONSE_END;
+            }
             int rc = connection_handle_write(r, con);
             if (rc != CON_STATE_WRITE) return rc;
         }
@@ -643,6 +705,7 @@ connection_state_machine_loop (request_st * const r, connection * const con)
 					ostate = CON_STATE_WRITE;
 					continue; /*(end loop if CON_STATE_WRITE)*/
 				}
+				connection_handle_write_deferred(r, con);
 				break;
 			}
 			/*connection_set_state(r, CON_STATE_REQUEST_END);*/
@@ -660,6 +723,7 @@ connection_state_machine_loop (request_st * const r, connection * const con)
 			  case HANDLER_FINISHED:
 				break;
 			  case HANDLER_WAIT_FOR_EVENT:
+				connection_handle_write_deferred(r, con);
 				return;
 			  /*case HANDLER_COMEBACK:*//*(not expected)*/
 			  /*case HANDLER_ERROR:*/
@@ -791,6 +855,12 @@ connection_set_fdevent_interest (request_st * const r, connection * const con)
         break;
     }
 
+    /* flush responses deferred by connection_write_defer() */
+    if (con->write_queue != &r->write_queue && r->state != CON_STATE_CLOSE
+        && !chunkqueue_is_empty(con->write_queue)
+        && 0 == con->is_writable && 0 == con->traffic_limit_reached)
+        n |= FDEVENT_OUT;
+
     const int events = fdevent_fdnode_interest(con->fdn);
     if (con->is_readable < 0) {
         con->is_readable = 0;
@@ -898,7 +968,8 @@ connection_graceful_shutdown_maint (server * const srv)
                 changed = 1;
         }
         else if (r->state == CON_STATE_READ && con->request_count > 1
-                 && chunkqueue_is_empty(con->read_queue)) {
+                 && chunkqueue_is_empty(con->read_queue)
+                 && con->write_queue == &r->write_queue) {
             /* close connections in keep-alive waiting for next request */
             connection_set_state_error(r, CON_STATE_ERROR);
             changed = 1;
@@ -9,6 +9,7 @@
 #include "gw_backend.h"
 
 #include <sys/types.h>
+#include "sys-mmap.h"
 #include "sys-socket.h"
 #include "sys-stat.h"
 #include "sys-unistd.h" /* <unistd.h> */
@@ -29,6 +30,17 @@
 #define SIGKILL 9
 #endif
 
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/* proc state shared between workers requires fork(), anonymous shared mmap,
+ * and compiler atomic builtins (counters are updated by multiple processes) */
+#if defined(HAVE_FORK) && defined(HAVE_MMAP) && defined(MAP_ANONYMOUS) \
+ && (defined(__GNUC__) || defined(__clang__))
+#define GW_PROC_SHM
+#endif
+
 #include "base.h"
 #include "algo_md.h"
 #include "array.h"
@@ -37,6 +49,7 @@
 #include "fdevent.h"
 #include "http_header.h"
 #include "log.h"
+#include "rand.h"
 #include "sock_addr.h"
 
 
@@ -47,7 +60,7 @@ static int * gw_status_get_counter(gw_host *host, gw_proc *proc, const char *tag
     /*(At the cost of some memory, could prepare strings for host and for proc
      * so that here we would copy ready made string for proc (or if NULL,
      * for host), and then append tag to produce key)*/
-    /*("gw.backend." 11, host->id <=128, proc->id <=10+1, static tag <=11)*/
+    /*("gw.backend." 11, host->id <=128, proc->id <=10+1, static tag <=20)*/
     char label[288];
     size_t llen = sizeof("gw.backend.")-1, len;
     memcpy(label, "gw.backend.", llen);
@@ -80,23 +93,102 @@ static int * gw_status_get_counter(gw_host *host, gw_proc *proc, const char *tag
     return plugin_stats_get_ptr(label, llen);
 }
 
-static void gw_proc_tag_inc(gw_host *host, gw_proc *proc, const char *tag, size_t len) {
-    ++(*gw_status_get_counter(host, proc, tag, len));
-}
-
 static void gw_proc_connected_inc(gw_host *host, gw_proc *proc) {
     UNUSED(host);
     ++(*proc->stats_connected); /* "gw.backend...connected" */
 }
 
+/* proc state shared between workers (server.max-worker)
+ *
+ * A proc disabled by one worker (connect error or failed health check) is
+ * disabled in all workers the next time they select a backend for that host,
+ * rather than each worker rediscovering the failure with client requests.
+ * A proc re-enabled by a successful health check is likewise re-enabled in
+ * all workers.  Load is the sum of requests in-progress to the proc from all
+ * workers, and is used to select the least loaded proc.  Each worker counts
+ * its load in its own slot (claimed on first use), so that the load of a
+ * worker which dies with requests in-progress is discarded when the master
+ * reaps the worker and releases the slot (gw_host_shm_reap()). */
+typedef struct gw_proc_shm {
+    unix_time64_t disabled_until; /* set by most recent worker state change */
+    uint32_t load[];              /* requests in-progress (per worker slot) */
+} gw_proc_shm;
+
+static size_t gw_host_shm_stride(const gw_host * const host) {
+    /* size of proc entry (aligned for disabled_until of next entry) */
+    return (sizeof(gw_proc_shm) + host->shm_nworkers * sizeof(uint32_t)
+            + sizeof(unix_time64_t) - 1) & ~(sizeof(unix_time64_t) - 1);
+}
+
+static size_t gw_host_shm_size(const gw_host * const host) {
+    /* worker slot owners (pid_t[]) followed by proc entries */
+    return host->max_procs * gw_host_shm_stride(host)
+         + ((host->shm_nworkers * sizeof(pid_t) + sizeof(unix_time64_t) - 1)
+            & ~(sizeof(unix_time64_t) - 1));
+}
+
+static uint32_t gw_proc_load(const gw_host * const host, const gw_proc * const proc) {
+  #ifdef GW_PROC_SHM
+    if (proc->shm) {
+        uint32_t load = 0;
+        for (uint32_t i = 0; i < host->shm_nworkers; ++i)
+            load += __atomic_load_n(proc->shm->load+i, __ATOMIC_RELAXED);
+        return load;
+    }
+  #else
+    UNUSED(host);
+  #endif
+    return proc->load;
+}
+
+#ifdef GW_PROC_SHM
+__attribute_cold__
+__attribute_noinline__
+static int gw_host_shm_claim(gw_host * const host) {
+    /* claim worker slot for load of this worker (-2 if none available) */
+    const pid_t pid = getpid();
+    for (uint32_t i = 0; i < host->shm_nworkers; ++i) {
+        pid_t owner = 0;
+        if (__atomic_compare_exchange_n(host->shm_workers+i, &owner, pid, 0,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            return (host->shm_slot = (int)i);
+    }
+    return (host->shm_slot = -2);
+}
+#endif
+
+static void gw_proc_shm_publish(const gw_proc * const proc) {
+  #ifdef GW_PROC_SHM
+    if (proc->shm)
+        __atomic_store_n(&proc->shm->disabled_until, proc->disabled_until,
+                         __ATOMIC_RELAXED);
+  #else
+    UNUSED(proc);
+  #endif
+}
+
 static void gw_proc_load_inc(gw_host *host, gw_proc *proc) {
     *proc->stats_load = ++proc->load; /* "gw.backend...load" */
     ++(*host->stats_global_active); /* "gw.active-requests" */
+  #ifdef GW_PROC_SHM
+    if (proc->shm) {
+        const int slot = (-1 != host->shm_slot)
+          ? host->shm_slot
+          : gw_host_shm_claim(host);
+        if (slot >= 0)
+            __atomic_add_fetch(proc->shm->load+slot, 1, __ATOMIC_RELAXED);
+    }
+  #endif
 }
 
 static void gw_proc_load_dec(gw_host *host, gw_proc *proc) {
     *proc->stats_load = --proc->load; /* "gw.backend...load" */
     --(*host->stats_global_active); /* "gw.active-requests" */
+  #ifdef GW_PROC_SHM
+    /*(slot claimed in gw_proc_load_inc())*/
+    if (proc->shm && host->shm_slot >= 0)
+        __atomic_sub_fetch(proc->shm->load+host->shm_slot, 1, __ATOMIC_RELAXED);
+  #endif
 }
 
 static void gw_host_assign(gw_host *host) {
@@ -109,8 +201,12 @@ static void gw_host_reset(gw_host *host) {
 
 static void gw_status_init_proc(gw_host *host, gw_proc *proc) {
     *gw_status_get_counter(host, proc, CONST_STR_LEN(".disabled")) = 0;
-    *gw_status_get_counter(host, proc, CONST_STR_LEN(".died")) = 0;
-    *gw_status_get_counter(host, proc, CONST_STR_LEN(".overloaded")) = 0;
+    proc->stats_died =
+      gw_status_get_counter(host, proc, CONST_STR_LEN(".died"));
+    *proc->stats_died = 0;
+    proc->stats_overloaded =
+      gw_status_get_counter(host, proc, CONST_STR_LEN(".overloaded"));
+    *proc->stats_overloaded = 0;
     proc->stats_connected =
       gw_status_get_counter(host, proc, CONST_STR_LEN(".connected"));
     *proc->stats_connected = 0;
@@ -119,12 +215,57 @@ static void gw_status_init_proc(gw_host *host, gw_proc *proc) {
     *proc->stats_load = 0;
 }
 
-static void gw_status_init_host(gw_host *host) {
+static void gw_status_init_host(gw_host *host, const char *name) {
+    /*(counters are resolved once here, not looked up by name per request)*/
     host->stats_load =
       gw_status_get_counter(host, NULL, CONST_STR_LEN(".load"));
     *host->stats_load = 0;
+    host->stats_procs =
+      gw_status_get_counter(host, NULL, CONST_STR_LEN(".procs"));
+    *host->stats_procs = 0;
     host->stats_global_active =
       plugin_stats_get_ptr("gw.active-requests",sizeof("gw.active-requests")-1);
+    /*("<module>.requests" is shared by all hosts of module)*/
+    char label[64];
+    const size_t nlen = strlen(name);
+    if (nlen + sizeof(".requests") <= sizeof(label)) {
+        memcpy(label, name, nlen);
+        memcpy(label+nlen, ".requests", sizeof(".requests"));
+        host->stats_requests =
+          plugin_stats_get_ptr(label, nlen + sizeof(".requests")-1);
+    }
+    else
+        host->stats_requests =
+          plugin_stats_get_ptr("gw.requests", sizeof("gw.requests")-1);
+
+    if (!host->queue_max) return;
+    static const struct { const char *tag; uint32_t len; } tags[] = {
+      { CONST_STR_LEN(".queue.wait.le-1ms") }
+     ,{ CONST_STR_LEN(".queue.wait.le-10ms") }
+     ,{ CONST_STR_LEN(".queue.wait.le-100ms") }
+     ,{ CONST_STR_LEN(".queue.wait.le-1s") }
+     ,{ CONST_STR_LEN(".queue.wait.le-10s") }
+     ,{ CONST_STR_LEN(".queue.wait.count") }
+    };
+    for (uint32_t i = 0; i < sizeof(tags)/sizeof(*tags); ++i) {
+        host->stats_queue_wait[i] =
+          gw_status_get_counter(host, NULL, tags[i].tag, tags[i].len);
+        *host->stats_queue_wait[i] = 0;
+    }
+    host->stats_queue_length =
+      gw_status_get_counter(host, NULL, CONST_STR_LEN(".queue.length"));
+    *host->stats_queue_length = 0;
+    host->stats_queue_rejected =
+      gw_status_get_counter(host, NULL, CONST_STR_LEN(".queue.rejected"));
+    *host->stats_queue_rejected = 0;
+    host->stats_queue_timeout =
+      gw_status_get_counter(host, NULL, CONST_STR_LEN(".queue.timeout"));
+    *host->stats_queue_timeout = 0;
+}
+
+static void gw_queue_wake(const gw_host * const host) {
+    /* head of queue checks for available proc when it next runs */
+    joblist_append(host->queue_head->con);
 }
 
 
@@ -137,11 +278,73 @@ static void gw_proc_set_state(gw_host *host, gw_proc *proc, int state) {
         --host->active_procs;
     } else if (state == PROC_STATE_RUNNING) {
         ++host->active_procs;
+        if (host->queue_head) gw_queue_wake(host);
     }
     proc->state = state;
 }
 
 
+static void gw_conn_close(gw_conn * const conn) {
+    fdevent_fdnode_event_del(conn->ev, conn->fdn);
+    fdevent_sched_close(conn->ev, conn->fdn);
+    free(conn);
+}
+
+
+static void gw_proc_conn_unlink(gw_proc * const proc, gw_conn * const conn) {
+    gw_conn **c = &proc->conns;
+    while (*c != conn) c = &(*c)->next;
+    *c = conn->next;
+    --proc->num_conns;
+}
+
+
+static handler_t gw_conn_handle_fdevent(void *ctx, int revents) {
+    /* idle connection is not expected to be readable; backend closed the
+     * connection, sent unexpected data, or an error occurred on the socket */
+    gw_conn * const conn = ctx;
+    UNUSED(revents);
+    gw_proc_conn_unlink(conn->proc, conn);
+    gw_conn_close(conn);
+    return HANDLER_FINISHED;
+}
+
+
+static void gw_proc_conns_close(gw_proc * const proc) {
+    for (gw_conn *conn = proc->conns, *next; conn; conn = next) {
+        next = conn->next;
+        gw_conn_close(conn);
+    }
+    proc->conns = NULL;
+    proc->num_conns = 0;
+}
+
+
+static void gw_proc_conns_expire(gw_proc * const proc, const unix_time64_t idle_ts) {
+    /* close idle connections if proc no longer running or if idle too long */
+    if (proc->state != PROC_STATE_RUNNING) {
+        gw_proc_conns_close(proc);
+        return;
+    }
+    for (gw_conn *conn = proc->conns, *next; conn; conn = next) {
+        next = conn->next;
+        if (conn->idle_ts < idle_ts
+            || (proc->is_local && conn->pid != proc->pid)) {
+            gw_proc_conn_unlink(proc, conn);
+            gw_conn_close(conn);
+        }
+    }
+}
+
+
+static void gw_proc_health_check_close(gw_proc * const proc) {
+    if (proc->hc) {
+        gw_conn_close(proc->hc);
+        proc->hc = NULL;
+    }
+}
+
+
 __attribute_cold__
 __attribute_noinline__
 static void gw_proc_init_portpath(gw_host *host, gw_proc *proc) {
@@ -190,6 +393,8 @@ static void gw_proc_free(gw_proc *proc) {
 
     gw_proc_free(proc->next);
 
+    gw_proc_conns_close(proc);
+    gw_proc_health_check_close(proc);
     buffer_free(proc->unixsocket);
     buffer_free(proc->connection_name);
     free(proc->saddr);
@@ -212,6 +417,8 @@ static void gw_host_free(gw_host *h) {
 
     gw_proc_free(h->first);
     gw_proc_free(h->unused_procs);
+    if (h->shm_workers)
+        munmap((void *)h->shm_workers, gw_host_shm_size(h));
 
     for (uint32_t i = 0; i < h->args.used; ++i) free(h->args.ptr[i]);
     free(h->args.ptr);
@@ -337,16 +544,28 @@ static void gw_proc_connect_error(request_st * const r, gw_host *host, gw_proc *
         }
     }
 
+    if (proc->state == PROC_STATE_OVERLOADED)
+        gw_proc_shm_publish(proc); /* disable proc in other workers */
+
     if (EAGAIN == errnum) {
-        gw_proc_tag_inc(host, proc, CONST_STR_LEN(".overloaded"));
+        ++(*proc->stats_overloaded); /* "gw.backend...overloaded" */
     }
     else {
-        gw_proc_tag_inc(host, proc, CONST_STR_LEN(".died"));
+        ++(*proc->stats_died); /* "gw.backend...died" */
     }
 }
 
+void gw_proc_connect_status(gw_handler_ctx * const hctx, request_st * const r, const int errnum) {
+    if (0 == errnum)
+        gw_proc_connect_success(hctx->host, hctx->proc, hctx->conf.debug, r);
+    else
+        gw_proc_connect_error(r, hctx->host, hctx->proc, hctx->pid,
+                              errnum, hctx->conf.debug);
+}
+
 static void gw_proc_release(gw_host *host, gw_proc *proc, int debug, log_error_st *errh) {
     gw_proc_load_dec(host, proc);
+    if (host->queue_head) gw_queue_wake(host);
 
     if (debug) {
         log_debug(errh, __FILE__, __LINE__,
@@ -369,6 +588,114 @@ static void gw_proc_check_enable(gw_host * const host, gw_proc * const proc, log
       host->unixsocket ? host->unixsocket->ptr : "");
 }
 
+__attribute_cold__
+__attribute_noinline__
+static void gw_proc_shm_sync(gw_host * const host, gw_proc * const proc, const unix_time64_t disabled_until, log_error_st * const errh) {
+    /* adopt proc state change made by another worker */
+    proc->disabled_until = disabled_until;
+    if (disabled_until < log_monotonic_secs)
+        gw_proc_check_enable(host, proc, errh);
+    else if (proc->state == PROC_STATE_RUNNING) {
+        gw_proc_set_state(host, proc, PROC_STATE_OVERLOADED);
+        log_error(errh, __FILE__, __LINE__,
+          "gw-server disabled by another worker: %s",
+          proc->connection_name->ptr);
+    }
+}
+
+static void gw_host_shm_sync(gw_host * const host, log_error_st * const errh) {
+  #ifdef GW_PROC_SHM
+    for (gw_proc *proc = host->first; proc; proc = proc->next) {
+        if (NULL == proc->shm) continue;
+        if (proc->state != PROC_STATE_RUNNING
+            && proc->state != PROC_STATE_OVERLOADED) continue;
+        const unix_time64_t ts =
+          __atomic_load_n(&proc->shm->disabled_until, __ATOMIC_RELAXED);
+        if (ts != proc->disabled_until)
+            gw_proc_shm_sync(host, proc, ts, errh);
+    }
+  #else
+    UNUSED(host);
+    UNUSED(errh);
+  #endif
+}
+
+__attribute_cold__
+static void gw_proc_shm_attach(gw_host * const host, gw_proc * const proc, log_error_st * const errh) {
+    /* attach proc to shared state slot for proc->id, and clear disabled_until
+     * left by previous proc with same id (e.g. respawned proc)
+     * (load is kept; requests in-progress to previous proc decrement load
+     *  when they complete) */
+  #ifdef GW_PROC_SHM
+    if (NULL == host->shm) return;
+    if (proc->id >= host->max_procs) {
+        /*(e.g. proc spawned while killed proc with lower id not yet reaped)*/
+        log_error(errh, __FILE__, __LINE__,
+          "gw proc id %u >= max-procs %u; "
+          "proc state not shared between workers: %s",
+          proc->id, host->max_procs, proc->connection_name->ptr);
+        proc->shm = NULL;
+        return;
+    }
+    proc->shm = (gw_proc_shm *)
+      ((char *)host->shm + proc->id * gw_host_shm_stride(host));
+    __atomic_store_n(&proc->shm->disabled_until, 0, __ATOMIC_RELAXED);
+  #else
+    UNUSED(host);
+    UNUSED(proc);
+    UNUSED(errh);
+  #endif
+}
+
+__attribute_cold__
+static void gw_host_shm_init(gw_host * const host, const uint32_t nworkers, log_error_st * const errh) {
+  #ifdef GW_PROC_SHM
+    /* (anonymous mmap is zero-initialized) */
+    host->shm_nworkers = nworkers;
+    host->shm_slot = -1;
+    const size_t sz = gw_host_shm_size(host);
+    void * const addr = mmap(NULL, sz, PROT_READ|PROT_WRITE,
+                             MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == addr) {
+        /*(not fatal; each worker tracks proc state separately)*/
+        log_perror(errh, __FILE__, __LINE__, "mmap() gw proc shared state");
+        host->shm_nworkers = 0;
+        return;
+    }
+    host->shm_workers = addr;
+    host->shm = (gw_proc_shm *)
+      ((char *)addr + sz - host->max_procs * gw_host_shm_stride(host));
+    for (gw_proc *proc = host->first; proc; proc = proc->next)
+        gw_proc_shm_attach(host, proc, errh);
+  #else
+    UNUSED(host);
+    UNUSED(nworkers);
+    UNUSED(errh);
+  #endif
+}
+
+static void gw_host_shm_reap(gw_host * const host, const pid_t pid) {
+    /* (master) discard load of worker which exited and release worker slot
+     * (requests in-progress in worker when it died are never completed) */
+  #ifdef GW_PROC_SHM
+    for (uint32_t i = 0; i < host->shm_nworkers; ++i) {
+        if (__atomic_load_n(host->shm_workers+i, __ATOMIC_RELAXED) != pid)
+            continue;
+        const size_t stride = gw_host_shm_stride(host);
+        for (uint32_t j = 0; j < host->max_procs; ++j) {
+            gw_proc_shm * const shm =
+              (gw_proc_shm *)((char *)host->shm + j * stride);
+            __atomic_store_n(shm->load+i, 0, __ATOMIC_RELAXED);
+        }
+        __atomic_store_n(host->shm_workers+i, 0, __ATOMIC_RELEASE);
+        break;
+    }
+  #else
+    UNUSED(host);
+    UNUSED(pid);
+  #endif
+}
+
 __attribute_cold__
 static void gw_proc_waitpid_log(const gw_host * const host, const gw_proc * const proc, log_error_st * const errh, const int status) {
     if (WIFEXITED(status)) {
@@ -693,6 +1020,7 @@ static int gw_spawn_connection(gw_host * const host, gw_proc * const proc, log_e
         }
     }
 
+    if (host->shm) gw_proc_shm_attach(host, proc, errh);
     gw_proc_set_state(host, proc, PROC_STATE_RUNNING);
     return 0;
 }
@@ -743,7 +1071,7 @@ static void gw_proc_spawn(gw_host * const host, log_error_st * const errh, const
         if (host->first)
             host->first->prev = proc;
         host->first = proc;
-        ++host->num_procs;
+        *host->stats_procs = (int)++host->num_procs; /* "gw.backend...procs" */
     }
 }
 
@@ -752,7 +1080,7 @@ static void gw_proc_kill(gw_host *host, gw_proc *proc) {
     if (proc->next) proc->next->prev = proc->prev;
     if (proc->prev) proc->prev->next = proc->next;
     else host->first = proc->next;
-    --host->num_procs;
+    *host->stats_procs = (int)--host->num_procs; /* "gw.backend...procs" */
 
     proc->prev = NULL;
     proc->next = host->unused_procs;
@@ -762,6 +1090,8 @@ static void gw_proc_kill(gw_host *host, gw_proc *proc) {
         host->unused_procs->prev = proc;
     host->unused_procs = proc;
 
+    gw_proc_conns_close(proc);
+    gw_proc_health_check_close(proc);
     fdevent_kill(proc->pid, host->kill_signal);
 
     gw_proc_set_state(host, proc, PROC_STATE_KILLED);
@@ -852,9 +1182,104 @@ enum {
   GW_BALANCE_LEAST_CONNECTION,
   GW_BALANCE_RR,
   GW_BALANCE_HASH,
-  GW_BALANCE_STICKY
+  GW_BALANCE_STICKY,
+  GW_BALANCE_LEAST_LATENCY
 };
 
+__attribute_const__
+static uint32_t gw_hash_mix (const uint32_t key, const uint32_t host_hash) {
+    /* combine and finalize (murmur3 fmix32) so that small differences in
+     * djbhash input spread across the full range (plain xor does not) */
+    uint32_t h = key * 0x9e3779b1u ^ host_hash;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+static uint64_t gw_clock_us (void) {
+    unix_timespec64_t ts;
+    if (0 != log_clock_gettime(CLOCK_MONOTONIC, &ts))
+        return (uint64_t)log_monotonic_secs * 1000000;
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+__attribute_const__
+static uint32_t gw_latency_ewma (uint32_t ewma, uint32_t sample) {
+    /* exponentially weighted moving average
+     * (weight 1/4 for new sample above average, so that a backend which
+     *  slows down is avoided sooner, but a single long request (e.g. upload
+     *  or long-poll) does not replace the average; weight 1/8 otherwise) */
+    if (0 == ewma) return sample;
+    return (sample > ewma)
+      ? ewma + ((sample - ewma) >> 2)
+      : ewma - ((ewma - sample) >> 3);
+}
+
+__attribute_const__
+static uint32_t gw_latency_decay (uint32_t latency, unix_time64_t ts, unix_time64_t cur_ts) {
+    /* halve estimate without new samples in the last second (called once per
+     * second), so that a host or proc avoided due to a high estimate is
+     * selected again to get new samples (0 is treated as no samples yet) */
+    return (cur_ts - ts > 1) ? latency >> 1 : latency;
+}
+
+static void gw_latency_update (gw_handler_ctx * const hctx) {
+    uint64_t us = gw_clock_us() - hctx->dispatch_us;
+    const uint32_t sample = (us < UINT32_MAX) ? (uint32_t)us+1 : UINT32_MAX;
+    hctx->dispatch_us = 0;
+    hctx->proc->latency = gw_latency_ewma(hctx->proc->latency, sample);
+    hctx->host->latency = gw_latency_ewma(hctx->host->latency, sample);
+    hctx->proc->latency_ts = hctx->host->latency_ts = log_monotonic_secs;
+}
+
+static void gw_handle_trigger_host_latency(gw_host * const host) {
+    const unix_time64_t cur_ts = log_monotonic_secs;
+    host->latency = gw_latency_decay(host->latency, host->latency_ts, cur_ts);
+    for (gw_proc *proc = host->first; proc; proc = proc->next)
+        proc->latency =
+          gw_latency_decay(proc->latency, proc->latency_ts, cur_ts);
+}
+
+__attribute_pure__
+static uint64_t gw_latency_score (const uint32_t latency, const uint32_t load) {
+    /* expected wait: latency weighted by requests in flight (+1 for this one)
+     * (hosts without samples yet are scored as fast to get them sampled) */
+    return (uint64_t)latency * (load + 1);
+}
+
+static int gw_host_get_least_latency (const gw_extension * const extension) {
+    /* power of two choices: compare two random hosts, pick lower score */
+    const uint32_t ext_used = extension->used;
+    uint32_t k = (uint32_t)li_rand_pseudo() % ext_used;
+    uint32_t j = (uint32_t)li_rand_pseudo() % (ext_used - 1);
+    if (j >= k) ++j;
+    const gw_host * const a = extension->hosts[k];
+    const gw_host * const b = extension->hosts[j];
+    if (a->active_procs && b->active_procs)
+        return gw_latency_score(a->latency, (uint32_t)a->load)
+            <= gw_latency_score(b->latency, (uint32_t)b->load) ? (int)k : (int)j;
+    if (a->active_procs) return (int)k;
+    if (b->active_procs) return (int)j;
+
+    /* both candidates down; pick lowest score among remaining hosts */
+    int ndx = -1;
+    uint64_t min_score = UINT64_MAX;
+    for (k = 0; k < ext_used; ++k) {
+        const gw_host * const host = extension->hosts[k];
+        if (0 == host->active_procs) continue;
+        const uint64_t score =
+          gw_latency_score(host->latency, (uint32_t)host->load);
+        if (min_score > score) {
+            min_score = score;
+            ndx = (int)k;
+        }
+    }
+    return ndx;
+}
+
 __attribute_noinline__
 __attribute_pure__
 static uint32_t
@@ -863,10 +1288,61 @@ gw_hash(const char *str, const uint32_t len, uint32_t hash)
     return djbhash(str, len, hash);
 }
 
+static int gw_host_get_hash (const gw_extension * const extension, const uint32_t base_hash, const int bounded) {
+    /* rendezvous (highest random weight) hashing: only keys mapped to
+     * a host which goes away (or ~1/N keys for a host which is added)
+     * are remapped when the set of active hosts changes */
+    const uint32_t ext_used = extension->used;
+    /* bounded loads (hash balancing only; sticky is for affinity):
+     * skip hosts at (1 + hash_load_bound/100) * average load */
+    uint64_t total = 1; /* (total includes this request) */
+    uint32_t n = 0;
+    if (bounded) {
+        for (uint32_t k = 0; k < ext_used; ++k) {
+            const gw_host * const host = extension->hosts[k];
+            if (0 == host->active_procs) continue;
+            total += (uint32_t)host->load;
+            ++n;
+        }
+    }
+    /* track highest weight host and highest weight host under bound */
+    uint32_t last_max = 0, bounded_max = 0;
+    int ndx = -1, ndx_unbounded = -1;
+    for (uint32_t k = 0; k < ext_used; ++k) {
+        const gw_host * const host = extension->hosts[k];
+        if (0 == host->active_procs) continue;
+        /* (balance "sticky" keeps plain xor weight so that existing client
+         *  affinity mappings are not moved to different hosts on upgrade) */
+        const uint32_t cur_max = bounded
+          ? gw_hash_mix(base_hash, host->gw_hash)
+          : base_hash ^ host->gw_hash;
+        if (last_max <= cur_max) {
+            last_max = cur_max;
+            ndx_unbounded = (int)k;
+        }
+        if (bounded_max <= cur_max) {
+            /* ceil(total * (1+e) / n) (host->hash_load_bound 0 disables) */
+            const uint64_t e = host->hash_load_bound;
+            if (e && n
+                && (uint64_t)host->load * 100 * n >= total * (100 + e))
+                continue;
+            bounded_max = cur_max;
+            ndx = (int)k;
+        }
+    }
+    return (-1 != ndx) ? ndx : ndx_unbounded;
+}
+
 static gw_host * gw_host_get(request_st * const r, gw_extension *extension, int balance, int debug) {
     int ndx = -1;
     const int ext_used = (int)extension->used;
 
+    /* proc state changes made by other workers */
+    for (int k = 0; k < ext_used; ++k) {
+        if (extension->hosts[k]->shm)
+            gw_host_shm_sync(extension->hosts[k], r->conf.errh);
+    }
+
     if (ext_used <= 1) {
         if (1 == ext_used && extension->hosts[0]->active_procs > 0)
             ndx = 0;
@@ -913,6 +1389,9 @@ static gw_host * gw_host_get(request_st * const r, gw_extension *extension, int
         extension->last_used_ndx = ndx;
         break;
        }
+      case GW_BALANCE_LEAST_LATENCY:
+        ndx = gw_host_get_least_latency(extension);
+        break;
       case GW_BALANCE_HASH:
       case GW_BALANCE_STICKY:
        { /* hash balancing or source sticky balancing */
@@ -920,16 +1399,8 @@ static gw_host * gw_host_get(request_st * const r, gw_extension *extension, int
           ? gw_hash(BUF_PTR_LEN(&r->uri.authority),
                     gw_hash(BUF_PTR_LEN(&r->uri.path), DJBHASH_INIT))
           : gw_hash(BUF_PTR_LEN(r->dst_addr_buf), DJBHASH_INIT);
-        uint32_t last_max = 0;
-        for (int k = 0; k < ext_used; ++k) {
-            const gw_host * const host = extension->hosts[k];
-            if (0 == host->active_procs) continue;
-            const uint32_t cur_max = base_hash ^ host->gw_hash;
-            if (last_max <= cur_max) {
-                last_max = cur_max;
-                ndx = k;
-            }
-        }
+        ndx = gw_host_get_hash(extension, base_hash,
+                               (balance == GW_BALANCE_HASH));
         break;
        }
       default:
@@ -960,7 +1431,13 @@ static gw_host * gw_host_get(request_st * const r, gw_extension *extension, int
         }
     }
 
-    /* all hosts are down */
+    /* all hosts are down; wait in host queue, if configured and not full
+     * (gw_queue_check()), in case procs are re-enabled or restarted soon */
+    for (int k = 0; k < ext_used; ++k) {
+        gw_host * const host = extension->hosts[k];
+        if (host->queue_len < host->queue_max) return host;
+    }
+
     /* sorry, we don't have a server alive for this ext */
     r->http_status = 503; /* Service Unavailable */
     r->handler_module = NULL;
@@ -1155,6 +1632,7 @@ static void handler_ctx_clear(gw_handler_ctx *hctx) {
     hctx->reconnects = 0;
     hctx->request_id = 0;
     hctx->send_content_body = 1;
+    hctx->rb_skip = 0;
 
     /*plugin_config conf;*//*(no need to reset for same request)*/
 
@@ -1319,6 +1797,30 @@ int gw_set_defaults_backend(server *srv, gw_plugin_data *p, const array *a, gw_p
      ,{ CONST_STR_LEN("upgrade"),
         T_CONFIG_BOOL,
         T_CONFIG_SCOPE_CONNECTION }
+     ,{ CONST_STR_LEN("keep-conn"),
+        T_CONFIG_SHORT,
+        T_CONFIG_SCOPE_CONNECTION }
+     ,{ CONST_STR_LEN("health-check-interval"),
+        T_CONFIG_SHORT,
+        T_CONFIG_SCOPE_CONNECTION }
+     ,{ CONST_STR_LEN("health-check-timeout"),
+        T_CONFIG_SHORT,
+        T_CONFIG_SCOPE_CONNECTION }
+     ,{ CONST_STR_LEN("collapse-forwarding"),
+        T_CONFIG_SHORT,
+        T_CONFIG_SCOPE_CONNECTION }
+     ,{ CONST_STR_LEN("collapse-timeout"),
+        T_CONFIG_SHORT,
+        T_CONFIG_SCOPE_CONNECTION }
+     ,{ CONST_STR_LEN("queue-max"),
+        T_CONFIG_SHORT,
+        T_CONFIG_SCOPE_CONNECTION }
+     ,{ CONST_STR_LEN("queue-timeout"),
+        T_CONFIG_SHORT,
+        T_CONFIG_SCOPE_CONNECTION }
+     ,{ CONST_STR_LEN("hash-load-bound"),
+        T_CONFIG_SHORT,
+        T_CONFIG_SCOPE_CONNECTION }
      ,{ NULL, 0,
         T_CONFIG_UNSET,
         T_CONFIG_SCOPE_UNSET }
@@ -1384,10 +1886,13 @@ int gw_set_defaults_backend(server *srv, gw_plugin_data *p, const array *a, gw_p
             host->check_local  = 1;
             host->min_procs    = 4;
             host->max_procs    = 4;
-            host->max_load_per_proc = 1;
+            host->max_load_per_proc = 0;
             host->idle_timeout = 60;
             host->connect_timeout = 8;
             host->disable_time = 1;
+            host->collapse_timeout = 10;
+            host->queue_timeout = 10;
+            host->hash_load_bound = 25;
             host->break_scriptfilename_for_php = 0;
             host->kill_signal = SIGTERM;
             host->fix_root_path_name = 0;
@@ -1534,6 +2039,30 @@ int gw_set_defaults_backend(server *srv, gw_plugin_data *p, const array *a, gw_p
                   case 26:/* upgrade */
                     host->upgrade = (0 != cpv->v.u);
                     break;
+                  case 27:/* keep-conn */
+                    host->keep_conn = cpv->v.shrt;
+                    break;
+                  case 28:/* health-check-interval */
+                    host->health_check_interval = cpv->v.shrt;
+                    break;
+                  case 29:/* health-check-timeout */
+                    host->health_check_timeout = cpv->v.shrt;
+                    break;
+                  case 30:/* collapse-forwarding */
+                    host->collapse_forwarding = cpv->v.shrt;
+                    break;
+                  case 31:/* collapse-timeout */
+                    host->collapse_timeout = cpv->v.shrt;
+                    break;
+                  case 32:/* queue-max */
+                    host->queue_max = cpv->v.shrt;
+                    break;
+                  case 33:/* queue-timeout */
+                    host->queue_timeout = cpv->v.shrt;
+                    break;
+                  case 34:/* hash-load-bound */
+                    host->hash_load_bound = cpv->v.shrt;
+                    break;
                   default:
                     break;
                 }
@@ -1619,7 +2148,7 @@ int gw_set_defaults_backend(server *srv, gw_plugin_data *p, const array *a, gw_p
                   : AF_INET;
             }
             if (!host->refcount)
-                gw_status_init_host(host);
+                gw_status_init_host(host, p->self->name);
 
             if (host->refcount) {
                 /* already init'd; skip spawning */
@@ -1718,7 +2247,7 @@ int gw_set_defaults_backend(server *srv, gw_plugin_data *p, const array *a, gw_p
                     proc->next = host->first;
                     if (host->first) host->first->prev = proc;
                     host->first = proc;
-                    ++host->num_procs;
+                    *host->stats_procs = (int)++host->num_procs;
                 }
 
                 if (graceful_restart_bg) {
@@ -1740,13 +2269,16 @@ int gw_set_defaults_backend(server *srv, gw_plugin_data *p, const array *a, gw_p
             } else {
                 gw_proc * const proc = gw_proc_init(host);
                 host->first = proc;
-                ++host->num_procs;
+                *host->stats_procs = (int)++host->num_procs;
                 host->min_procs = 1;
                 host->max_procs = 1;
                 if (0 != gw_proc_sockaddr_init(host, proc, srv->errh)) goto error;
                 gw_proc_set_state(host, proc, PROC_STATE_RUNNING);
             }
 
+            if (0 != srv->srvconf.max_worker && !srv->srvconf.preflight_check)
+                gw_host_shm_init(host, srv->srvconf.max_worker, srv->errh);
+
             const buffer * const h = host->host ? host->host : host->unixsocket;
             host->gw_hash = gw_hash(BUF_PTR_LEN(h), DJBHASH_INIT) ^ host->port;
 
@@ -1797,10 +2329,13 @@ int gw_get_defaults_balance(server *srv, const buffer *b) {
         return GW_BALANCE_HASH;
     if (buffer_eq_slen(b, CONST_STR_LEN("sticky")))
         return GW_BALANCE_STICKY;
+    if (buffer_eq_slen(b, CONST_STR_LEN("least-latency")))
+        return GW_BALANCE_LEAST_LATENCY;
 
     log_error(srv->errh, __FILE__, __LINE__,
       "xxxxx.balance has to be one of: "
-      "least-connection, round-robin, hash, sticky, but not: %s", b->ptr);
+      "least-connection, round-robin, hash, sticky, least-latency, "
+      "but not: %s", b->ptr);
     return GW_BALANCE_LEAST_CONNECTION;
 }
 
@@ -1851,15 +2386,355 @@ static void gw_host_hctx_deq(gw_handler_ctx * const hctx) {
 }
 
 
+static int gw_backend_conn_keep(gw_handler_ctx * const hctx, request_st * const r) {
+    /* keep connection open for reuse if backend protocol module flagged
+     * hctx->keep_conn after response completed and nothing else is pending */
+    gw_proc * const proc = hctx->proc;
+    if (NULL == proc) return 0;
+    if (proc->num_conns >= hctx->host->keep_conn) return 0;
+    if (proc->state != PROC_STATE_RUNNING) return 0;
+    if (proc->is_local && proc->pid != hctx->pid) return 0;
+    if (!chunkqueue_is_empty(&hctx->wb)) return 0;
+    if (r->conf.stream_request_body & FDEVENT_STREAM_REQUEST_BACKEND_SHUT_WR)
+        return 0;
+
+    gw_conn * const conn = ck_malloc(sizeof(*conn));
+    conn->proc = proc;
+    conn->ev = hctx->ev;
+    conn->fdn = hctx->fdn;
+    conn->pid = hctx->pid;
+    conn->idle_ts = log_monotonic_secs;
+    conn->next = proc->conns;
+    proc->conns = conn;
+    ++proc->num_conns;
+    /* (modify fdnode in place instead of fdevent_unregister() and
+     *  fdevent_register() since fdnode might be referenced by pending events;
+     *  any such event is handled by gw_conn_handle_fdevent()) */
+    conn->fdn->handler = gw_conn_handle_fdevent;
+    conn->fdn->ctx = conn;
+    fdevent_fdnode_event_set(conn->ev, conn->fdn, FDEVENT_IN | FDEVENT_RDHUP);
+    return 1;
+}
+
+
+static int gw_backend_conn_reuse(gw_handler_ctx * const hctx) {
+    gw_proc * const proc = hctx->proc;
+    gw_conn *conn;
+    while ((conn = proc->conns)) {
+        proc->conns = conn->next;
+        --proc->num_conns;
+        if (!proc->is_local || conn->pid == proc->pid) break;
+        gw_conn_close(conn); /*(stale connection to prior proc pid)*/
+    }
+    if (NULL == conn) return 0;
+
+    hctx->fdn = conn->fdn;
+    hctx->fd = conn->fdn->fd;
+    hctx->pid = conn->pid;
+    hctx->conn_reused = 1;
+    free(conn);
+    hctx->fdn->handler = gw_handle_fdevent;
+    hctx->fdn->ctx = hctx;
+    fdevent_fdnode_event_del(hctx->ev, hctx->fdn);
+    return 1;
+}
+
+
+enum {
+  GW_COLLAPSE_NONE,
+  GW_COLLAPSE_SKIP,     /* not eligible; send request to backend */
+  GW_COLLAPSE_LEADER,   /* send request to backend; others may wait */
+  GW_COLLAPSE_WAITER,   /* waiting on leader */
+  GW_COLLAPSE_DONE,     /* response copied from leader */
+  GW_COLLAPSE_RELEASED  /* leader response not reusable; send to backend */
+};
+
+static int gw_collapse_eligible (const gw_handler_ctx * const hctx, const request_st * const r) {
+    return r->http_method == HTTP_METHOD_GET
+        && 0 == r->reqbody_length
+        && hctx->gw_mode == GW_RESPONDER
+        && NULL == hctx->ext_auth
+        && !hctx->opts.upgrade
+        && !r->h2_connect_ext
+        && !(r->rqst_htags & (light_bshift(HTTP_HEADER_AUTHORIZATION)
+                             |light_bshift(HTTP_HEADER_COOKIE)
+                             |light_bshift(HTTP_HEADER_RANGE)
+                             |light_bshift(HTTP_HEADER_IF_MATCH)
+                             |light_bshift(HTTP_HEADER_IF_MODIFIED_SINCE)
+                             |light_bshift(HTTP_HEADER_IF_NONE_MATCH)
+                             |light_bshift(HTTP_HEADER_IF_RANGE)
+                             |light_bshift(HTTP_HEADER_IF_UNMODIFIED_SINCE)
+                             |light_bshift(HTTP_HEADER_UPGRADE)));
+}
+
+static int gw_collapse_key_eq (const request_st * const a, const request_st * const b) {
+    return buffer_is_equal(&a->target, &b->target)
+        && buffer_is_equal(&a->uri.authority, &b->uri.authority)
+        && buffer_is_equal(&a->uri.scheme, &b->uri.scheme);
+}
+
+static int gw_collapse_join (gw_handler_ctx * const hctx, request_st * const r) {
+    gw_host * const host = hctx->host;
+    hctx->collapse_state = GW_COLLAPSE_SKIP;
+    if (!gw_collapse_eligible(hctx, r)) return 0;
+
+    for (gw_handler_ctx *leader = host->collapse; leader;
+         leader = leader->collapse_next) {
+        if (!gw_collapse_key_eq(leader->r, r)) continue;
+        if (leader->collapse_num >= host->collapse_forwarding) return 0;
+        /* response might already be streaming to leader client */
+        request_st * const lr = leader->r;
+        if (lr->resp_body_started
+            && (lr->conf.stream_response_body
+                & (FDEVENT_STREAM_RESPONSE | FDEVENT_STREAM_RESPONSE_BUFMIN)))
+            return 0;
+        /* collect complete response from backend before sending response
+         * so that the response might be copied to waiters
+         * (streaming is left enabled unless another request waits) */
+        if (0 == leader->collapse_num)
+            lr->conf.stream_response_body &=
+              ~(FDEVENT_STREAM_RESPONSE | FDEVENT_STREAM_RESPONSE_BUFMIN);
+        hctx->collapse_state = GW_COLLAPSE_WAITER;
+        hctx->collapse_leader = leader;
+        hctx->collapse_next = leader->collapse_waiters;
+        leader->collapse_waiters = hctx;
+        ++leader->collapse_num;
+        hctx->write_ts = log_monotonic_secs;
+        return 1;
+    }
+
+    hctx->collapse_state = GW_COLLAPSE_LEADER;
+    hctx->collapse_next = host->collapse;
+    host->collapse = hctx;
+    return 0;
+}
+
+static void gw_collapse_waiter_wake (gw_handler_ctx * const hctx, const int state) {
+    hctx->collapse_state = state;
+    hctx->collapse_leader = NULL;
+    hctx->collapse_next = NULL;
+    joblist_append(hctx->con);
+}
+
+static void gw_collapse_leader_release (gw_handler_ctx * const leader) {
+    gw_handler_ctx **h = &leader->host->collapse;
+    while (*h != leader) h = &(*h)->collapse_next;
+    *h = leader->collapse_next;
+    leader->collapse_next = NULL;
+    leader->collapse_state = GW_COLLAPSE_SKIP;
+
+    for (gw_handler_ctx *hctx = leader->collapse_waiters, *next; hctx; hctx = next) {
+        next = hctx->collapse_next;
+        gw_collapse_waiter_wake(hctx, GW_COLLAPSE_RELEASED);
+    }
+    leader->collapse_waiters = NULL;
+    leader->collapse_num = 0;
+}
+
+static void gw_collapse_waiter_unlink (gw_handler_ctx * const hctx) {
+    gw_handler_ctx * const leader = hctx->collapse_leader;
+    gw_handler_ctx **h = &leader->collapse_waiters;
+    while (*h != hctx) h = &(*h)->collapse_next;
+    *h = hctx->collapse_next;
+    --leader->collapse_num;
+    hctx->collapse_leader = NULL;
+    hctx->collapse_next = NULL;
+}
+
+static int gw_collapse_response_reusable (const request_st * const r) {
+    if (200 != r->http_status || !r->resp_body_finished
+        || 0 != r->write_queue.bytes_out)
+        return 0;
+    if (r->resp_htags & (light_bshift(HTTP_HEADER_SET_COOKIE)
+                        |light_bshift(HTTP_HEADER_VARY)))
+        return 0;
+    const buffer * const vb =
+      http_header_response_get(r, HTTP_HEADER_CACHE_CONTROL,
+                               CONST_STR_LEN("Cache-Control"));
+    return NULL == vb
+        || (!http_header_str_contains_token(BUF_PTR_LEN(vb),
+                                            CONST_STR_LEN("private"))
+            && !http_header_str_contains_token(BUF_PTR_LEN(vb),
+                                               CONST_STR_LEN("no-store"))
+            && !http_header_str_contains_token(BUF_PTR_LEN(vb),
+                                               CONST_STR_LEN("no-cache")));
+}
+
+static void gw_collapse_fanout (gw_handler_ctx * const leader, request_st * const r) {
+    /* copy complete response to waiters (if response is reusable);
+     * otherwise, waiters are released in gw_backend_close() */
+    if (!gw_collapse_response_reusable(r)) return;
+    const off_t len = chunkqueue_length(&r->write_queue);
+    for (gw_handler_ctx *hctx = leader->collapse_waiters, *next; hctx; hctx = next) {
+        next = hctx->collapse_next;
+        request_st * const wr = hctx->r;
+        wr->http_status = r->http_status;
+        for (uint32_t i = 0; i < r->resp_headers.used; ++i) {
+            const data_string * const ds =
+              (data_string *)r->resp_headers.data[i];
+            http_header_response_insert(wr, ds->ext, BUF_PTR_LEN(&ds->key),
+                                        BUF_PTR_LEN(&ds->value));
+        }
+        chunkqueue_append_cq_range(&wr->write_queue, &r->write_queue, 0, len);
+        wr->resp_body_started = 1;
+        wr->resp_body_finished = 1;
+        gw_collapse_waiter_wake(hctx, GW_COLLAPSE_DONE);
+    }
+    leader->collapse_waiters = NULL;
+    leader->collapse_num = 0;
+}
+
+static handler_t gw_collapse_subrequest (gw_handler_ctx * const hctx, request_st * const r) {
+    switch (hctx->collapse_state) {
+      case GW_COLLAPSE_WAITER:
+        return HANDLER_WAIT_FOR_EVENT;
+      case GW_COLLAPSE_DONE:
+        gw_connection_close(hctx, r);
+        return HANDLER_FINISHED;
+      default: /* GW_COLLAPSE_RELEASED */
+        hctx->collapse_state = GW_COLLAPSE_SKIP;
+        return HANDLER_GO_ON;
+    }
+}
+
+static int gw_proc_available(const gw_host * const host, const gw_proc * const proc) {
+    return proc->state == PROC_STATE_RUNNING
+        && (0 == host->max_load_per_proc
+            || proc->load < (int)host->max_load_per_proc);
+}
+
+static int gw_host_proc_available(const gw_host * const host) {
+    for (const gw_proc *proc = host->first; proc; proc = proc->next) {
+        if (gw_proc_available(host, proc)) return 1;
+    }
+    return 0;
+}
+
+static void gw_queue_wait_record(const gw_host * const host, const uint64_t us) {
+    /* cumulative histogram buckets (wait <= 1ms, 10ms, 100ms, 1s, 10s) */
+    int * const * const hist = host->stats_queue_wait;
+    uint64_t bound = 1000;
+    for (int i = 0; i < 5; ++i, bound *= 10) {
+        if (us <= bound) ++(*hist[i]);
+    }
+    ++(*hist[5]); /* ".queue.wait.count" */
+}
+
+static void gw_queue_unlink(gw_host * const host, gw_handler_ctx * const hctx) {
+    gw_handler_ctx *prev = NULL;
+    gw_handler_ctx **h = &host->queue_head;
+    while (*h != hctx) h = &(prev = *h)->queue_next;
+    *h = hctx->queue_next;
+    if (host->queue_tail == hctx) host->queue_tail = prev;
+    hctx->queue_next = NULL;
+    hctx->queued = 0;
+    *host->stats_queue_length = (int)--host->queue_len;
+}
+
+static handler_t gw_queue_check(gw_handler_ctx * const hctx) {
+    /* wait in FIFO host queue if no proc is available
+     * (returns HANDLER_GO_ON to proceed, HANDLER_WAIT_FOR_EVENT to wait,
+     *  or HANDLER_ERROR if queue is full) */
+    gw_host * const host = hctx->host;
+    if (hctx->queued) {
+        if (hctx != host->queue_head || !gw_host_proc_available(host))
+            return HANDLER_WAIT_FOR_EVENT;
+        gw_queue_unlink(host, hctx);
+        /*(only waits which end in dispatch are recorded in the histogram;
+         * timeouts and rejections are counted separately)*/
+        gw_queue_wait_record(host, gw_clock_us() - hctx->queue_us);
+        if (host->queue_head) gw_queue_wake(host); /*(more procs available?)*/
+        return HANDLER_GO_ON;
+    }
+
+    if (NULL == host->queue_head && gw_host_proc_available(host))
+        return HANDLER_GO_ON;
+
+    if (host->queue_len >= host->queue_max) {
+        ++(*host->stats_queue_rejected); /* "gw.backend...queue.rejected" */
+        return HANDLER_ERROR;
+    }
+
+    hctx->queued = 1;
+    hctx->queue_us = gw_clock_us();
+    hctx->queue_next = NULL;
+    if (host->queue_tail)
+        host->queue_tail->queue_next = hctx;
+    else
+        host->queue_head = hctx;
+    host->queue_tail = hctx;
+    *host->stats_queue_length = (int)++host->queue_len;
+    return HANDLER_WAIT_FOR_EVENT;
+}
+
+int gw_proc_select(gw_handler_ctx * const hctx) {
+    /* select running proc with lowest load (or lowest latency score)
+     * and account the request to the proc (released in gw_backend_close()) */
+    hctx->proc = NULL;
+
+    for (gw_proc *proc = hctx->host->first; proc; proc = proc->next) {
+        if (proc->state == PROC_STATE_RUNNING
+            && (!hctx->host->queue_max
+                || gw_proc_available(hctx->host, proc))) {
+            hctx->proc = proc;
+            break;
+        }
+    }
+
+    /* all children are dead */
+    if (hctx->proc == NULL) return 0;
+
+    /* check the other procs if they have a lower load */
+    if (hctx->conf.balance != GW_BALANCE_LEAST_LATENCY) {
+        for (gw_proc *proc = hctx->proc->next; proc; proc = proc->next) {
+            if (proc->state != PROC_STATE_RUNNING) continue;
+            if (gw_proc_load(hctx->host, proc)
+                < gw_proc_load(hctx->host, hctx->proc))
+                hctx->proc = proc;
+        }
+    }
+    else {
+        uint64_t score =
+          gw_latency_score(hctx->proc->latency,
+                           gw_proc_load(hctx->host, hctx->proc));
+        for (gw_proc *proc = hctx->proc->next; proc; proc = proc->next) {
+            if (proc->state != PROC_STATE_RUNNING) continue;
+            if (hctx->host->queue_max
+                && !gw_proc_available(hctx->host, proc)) continue;
+            const uint64_t pscore =
+              gw_latency_score(proc->latency, gw_proc_load(hctx->host, proc));
+            if (pscore < score) {
+                score = pscore;
+                hctx->proc = proc;
+            }
+        }
+        hctx->dispatch_us = gw_clock_us();
+    }
+
+    gw_proc_load_inc(hctx->host, hctx->proc);
+    return 1;
+}
+
 static void gw_backend_close(gw_handler_ctx * const hctx, request_st * const r) {
+    if (hctx->queued)
+        gw_queue_unlink(hctx->host, hctx);
+
+    if (hctx->collapse_state == GW_COLLAPSE_LEADER)
+        gw_collapse_leader_release(hctx);
+    else if (hctx->collapse_state == GW_COLLAPSE_WAITER)
+        gw_collapse_waiter_unlink(hctx);
+
     if (hctx->fd >= 0) {
         fdevent_fdnode_event_del(hctx->ev, hctx->fdn);
         /*fdevent_unregister(ev, hctx->fdn);*//*(handled below)*/
-        fdevent_sched_close(hctx->ev, hctx->fdn);
+        if (!hctx->keep_conn || !gw_backend_conn_keep(hctx, r))
+            fdevent_sched_close(hctx->ev, hctx->fdn);
         hctx->fdn = NULL;
         hctx->fd = -1;
         gw_host_hctx_deq(hctx);
     }
+    hctx->keep_conn = 0;
+    hctx->conn_reused = 0;
 
     if (hctx->host) {
         if (hctx->proc) {
@@ -1873,7 +2748,7 @@ static void gw_backend_close(gw_handler_ctx * const hctx, request_st * const r)
     }
 }
 
-static void gw_connection_close(gw_handler_ctx * const hctx, request_st * const r) {
+void gw_connection_close(gw_handler_ctx * const hctx, request_st * const r) {
     gw_plugin_data *p = hctx->plugin_data;
 
     gw_backend_close(hctx, r);
@@ -1885,7 +2760,7 @@ static void gw_connection_close(gw_handler_ctx * const hctx, request_st * const
     }
 }
 
-static handler_t gw_reconnect(gw_handler_ctx * const hctx, request_st * const r) {
+handler_t gw_reconnect(gw_handler_ctx * const hctx, request_st * const r) {
     gw_backend_close(hctx, r);
 
     hctx->host = gw_host_get(r,hctx->ext,hctx->conf.balance,hctx->conf.debug);
@@ -1989,58 +2864,66 @@ static handler_t gw_network_backend_write_error(gw_handler_ctx * const hctx, req
 static handler_t gw_write_request(gw_handler_ctx * const hctx, request_st * const r) {
     switch(hctx->state) {
     case GW_STATE_INIT:
-        /* do we have a running process for this host (max-procs) ? */
-        hctx->proc = NULL;
-
-        for (gw_proc *proc = hctx->host->first; proc; proc = proc->next) {
-             if (proc->state == PROC_STATE_RUNNING) {
-                 hctx->proc = proc;
-                 break;
-             }
-        }
+        /* wait on identical request already in progress, if configured */
+        if (hctx->host->collapse_forwarding
+            && hctx->collapse_state == GW_COLLAPSE_NONE
+            && gw_collapse_join(hctx, r))
+            return HANDLER_WAIT_FOR_EVENT;
 
-        /* all children are dead */
-        if (hctx->proc == NULL) {
-            return HANDLER_ERROR;
+        /* wait in host queue until proc is available, if configured */
+        if (hctx->host->queue_max) {
+            const handler_t rc = gw_queue_check(hctx);
+            if (rc == HANDLER_WAIT_FOR_EVENT) return rc;
+            if (rc == HANDLER_ERROR) {
+                r->http_status = 503; /* Service Unavailable */
+                return gw_backend_error(hctx, r); /* HANDLER_FINISHED */
+            }
         }
 
-        /* check the other procs if they have a lower load */
-        for (gw_proc *proc = hctx->proc->next; proc; proc = proc->next) {
-            if (proc->state != PROC_STATE_RUNNING) continue;
-            if (proc->load < hctx->proc->load) hctx->proc = proc;
+        /* do we have a running process for this host (max-procs) ? */
+        if (!gw_proc_select(hctx)) {
+            return HANDLER_ERROR; /* all children are dead */
         }
 
-        gw_proc_load_inc(hctx->host, hctx->proc);
-
-        hctx->fd = fdevent_socket_nb_cloexec(hctx->host->family,SOCK_STREAM,0);
-        if (-1 == hctx->fd) {
-            log_perror(r->conf.errh, __FILE__, __LINE__,
-              "socket() failed (cur_fds:%d) (max_fds:%d)",
-              r->con->srv->cur_fds, r->con->srv->max_fds);
-            return HANDLER_ERROR;
+        if (hctx->proc->conns && gw_backend_conn_reuse(hctx)) {
+            /* reuse idle connection to backend */
+            hctx->write_ts = log_monotonic_secs;
+            gw_host_hctx_enq(hctx);
         }
+        else {
+            hctx->fd =
+              fdevent_socket_nb_cloexec(hctx->host->family, SOCK_STREAM, 0);
+            if (-1 == hctx->fd) {
+                log_perror(r->conf.errh, __FILE__, __LINE__,
+                  "socket() failed (cur_fds:%d) (max_fds:%d)",
+                  r->con->srv->cur_fds, r->con->srv->max_fds);
+                return HANDLER_ERROR;
+            }
 
-        ++r->con->srv->cur_fds;
+            ++r->con->srv->cur_fds;
 
-        hctx->fdn = fdevent_register(hctx->ev,hctx->fd,gw_handle_fdevent,hctx);
+            hctx->fdn =
+              fdevent_register(hctx->ev, hctx->fd, gw_handle_fdevent, hctx);
 
-        if (hctx->proc->is_local) {
-            hctx->pid = hctx->proc->pid;
-        }
+            if (hctx->proc->is_local) {
+                hctx->pid = hctx->proc->pid;
+            }
 
-        hctx->write_ts = log_monotonic_secs;
-        gw_host_hctx_enq(hctx);
-        switch (gw_establish_connection(r, hctx->host, hctx->proc, hctx->pid,
-                                        hctx->fd, hctx->conf.debug)) {
-        case 1: /* connection is in progress */
-            fdevent_fdnode_event_set(hctx->ev, hctx->fdn, FDEVENT_OUT);
-            gw_set_state(hctx, GW_STATE_CONNECT_DELAYED);
-            return HANDLER_WAIT_FOR_EVENT;
-        case -1:/* connection error */
-            return HANDLER_ERROR;
-        case 0: /* everything is ok, go on */
-            hctx->reconnects = 0;
-            break;
+            hctx->write_ts = log_monotonic_secs;
+            gw_host_hctx_enq(hctx);
+            switch (gw_establish_connection(r, hctx->host, hctx->proc,
+                                            hctx->pid, hctx->fd,
+                                            hctx->conf.debug)) {
+            case 1: /* connection is in progress */
+                fdevent_fdnode_event_set(hctx->ev, hctx->fdn, FDEVENT_OUT);
+                gw_set_state(hctx, GW_STATE_CONNECT_DELAYED);
+                return HANDLER_WAIT_FOR_EVENT;
+            case -1:/* connection error */
+                return HANDLER_ERROR;
+            case 0: /* everything is ok, go on */
+                hctx->reconnects = 0;
+                break;
+            }
         }
         __attribute_fallthrough__
     case GW_STATE_CONNECT_DELAYED:
@@ -2173,7 +3056,7 @@ void gw_backend_error_trace(const gw_handler_ctx * const hctx, const request_st
 
 __attribute_cold__
 __attribute_noinline__
-static handler_t gw_backend_error(gw_handler_ctx * const hctx, request_st * const r)
+handler_t gw_backend_error(gw_handler_ctx * const hctx, request_st * const r)
 {
     if (hctx->backend_error) hctx->backend_error(hctx);
     http_response_backend_error(r);
@@ -2237,6 +3120,11 @@ handler_t gw_handle_subrequest(request_st * const r, void *p_d) {
     gw_handler_ctx *hctx = r->plugin_ctx[p->id];
     if (NULL == hctx) return HANDLER_GO_ON;
 
+    if (hctx->collapse_state >= GW_COLLAPSE_WAITER) {
+        handler_t rc = gw_collapse_subrequest(hctx, r);
+        if (rc != HANDLER_GO_ON) return rc;       /*(might invalidate hctx)*/
+    }
+
     const int revents = hctx->revents;
     if (revents) {
         hctx->revents = 0;
@@ -2410,6 +3298,10 @@ static handler_t gw_recv_response(gw_handler_ctx * const hctx, request_st * cons
 
     gw_proc * const proc = hctx->proc;
 
+    /* (time to response headers; balance "least-latency") */
+    if (hctx->dispatch_us && (r->resp_body_started || rc == HANDLER_FINISHED))
+        gw_latency_update(hctx);
+
     switch (rc) {
     default:
         /* change in r->write_queue.bytes_in used to approximate backend read,
@@ -2427,6 +3319,16 @@ static handler_t gw_recv_response(gw_handler_ctx * const hctx, request_st * cons
             && (200 == r->http_status || 0 == r->http_status))
             return gw_authorizer_ok(hctx, r);
 
+        if (hctx->collapse_waiters) {
+            /* response without Content-Length (and not chunked) is complete
+             * at backend EOF (or e.g. FastCGI END_REQUEST); would otherwise
+             * be marked finished later in http_response_backend_done() */
+            if (!r->resp_body_finished && r->resp_body_started
+                && r->resp_body_scratchpad < 0 && !r->resp_decode_chunked)
+                r->resp_body_finished = 1;
+            gw_collapse_fanout(hctx, r);
+        }
+
         gw_connection_close(hctx, r);
         return HANDLER_FINISHED;
     case HANDLER_COMEBACK: /*(not expected; treat as error)*/
@@ -2462,6 +3364,21 @@ static handler_t gw_recv_response_error(gw_handler_ctx * const hctx, request_st
             }
         }
 
+        if (hctx->conn_reused && !r->resp_body_started
+            && 0 == r->reqbody_length
+            && (NULL == hctx->response || buffer_is_blank(hctx->response))
+            && (NULL == hctx->rb || chunkqueue_is_empty(hctx->rb))
+            && hctx->reconnects++ < 5) {
+            /* backend might have closed idle connection before it was reused;
+             * resend request (without request body) on a new connection */
+            if (hctx->conf.debug)
+                gw_backend_error_trace(hctx, r,
+                  "reconnecting; reused connection closed by backend");
+            chunkqueue_reset(&hctx->wb);
+            hctx->wb_reqlen = 0;
+            return gw_reconnect(hctx, r);
+        }
+
         int reconnect = 0;
         const char * const msg = (r->resp_body_started == 0)
           ? hctx->wb.bytes_out == 0
@@ -2888,16 +3805,192 @@ static void gw_handle_trigger_host_timeouts(gw_host * const host) {
     }
 }
 
-static void gw_handle_trigger_host(gw_host * const host, log_error_st * const errh, const int debug) {
+static void gw_handle_trigger_host_collapse(gw_host * const host) {
+    /* release waiters which waited too long for leader response */
+    const unix_time64_t ts = log_monotonic_secs - host->collapse_timeout;
+    for (gw_handler_ctx *leader = host->collapse; leader;
+         leader = leader->collapse_next) {
+        for (gw_handler_ctx *hctx = leader->collapse_waiters, *next; hctx;
+             hctx = next) {
+            next = hctx->collapse_next;
+            if (hctx->write_ts >= ts) continue;
+            gw_collapse_waiter_unlink(hctx);
+            gw_collapse_waiter_wake(hctx, GW_COLLAPSE_RELEASED);
+        }
+    }
+}
+
+static void gw_handle_trigger_host_queue(gw_host * const host) {
+    /* send 503 to requests which waited too long in queue for a proc */
+    const uint64_t ts = gw_clock_us() - (uint64_t)host->queue_timeout*1000000;
+    gw_handler_ctx *hctx;
+    while ((hctx = host->queue_head) && hctx->queue_us <= ts) {
+        request_st * const r = hctx->r;
+        joblist_append(r->con);
+        gw_queue_unlink(host, hctx);
+        ++(*host->stats_queue_timeout); /* "gw.backend...queue.timeout" */
+        r->http_status = 503; /* Service Unavailable */
+        gw_backend_error(hctx, r);
+    }
+    if (host->queue_head && gw_host_proc_available(host))
+        gw_queue_wake(host);
+}
+
+static void gw_handle_trigger_host_conns(gw_host * const host) {
+    if (!host->keep_conn) return;
+    const unix_time64_t idle_ts = log_monotonic_secs - host->idle_timeout;
+    for (gw_proc *proc = host->first; proc; proc = proc->next) {
+        if (proc->conns) gw_proc_conns_expire(proc, idle_ts);
+    }
+}
+
+typedef struct gw_health_check {
+    gw_conn conn; /*(must be first member; freed by gw_conn_close())*/
+    gw_host *host;
+    server *srv;
+} gw_health_check;
+
+__attribute_cold__
+static void gw_proc_health_check_result(gw_host * const host, gw_proc * const proc, const int errnum, log_error_st * const errh) {
+    if (0 == errnum) {
+        /* re-enable proc disabled by earlier (active or passive) failure */
+        if (proc->state == PROC_STATE_OVERLOADED) {
+            proc->disabled_until = 0;
+            gw_proc_check_enable(host, proc, errh);
+            gw_proc_shm_publish(proc); /* re-enable proc in other workers */
+        }
+        return;
+    }
+
+    if (proc->state == PROC_STATE_RUNNING) {
+      #ifdef _WIN32
+        WSASetLastError(errnum); /*(for log_serror())*/
+      #else
+        errno = errnum; /*(for log_serror())*/
+      #endif
+        log_serror(errh, __FILE__, __LINE__,
+          "health check failed; disabling backend: %s",
+          proc->connection_name->ptr);
+        gw_proc_set_state(host, proc, PROC_STATE_OVERLOADED);
+        ++(*proc->stats_died); /* "gw.backend...died" */
+    }
+    if (proc->state == PROC_STATE_OVERLOADED) {
+        /* keep proc disabled until a later health check succeeds */
+        proc->disabled_until = log_monotonic_secs + host->disable_time
+                             + host->health_check_interval;
+        gw_proc_shm_publish(proc);
+    }
+}
+
+static handler_t gw_health_check_handle_fdevent(void *ctx, int revents) {
+    gw_health_check * const hc = ctx;
+    gw_proc * const proc = hc->conn.proc;
+    int errnum = fdevent_connect_status(hc->conn.fdn->fd);
+    if (0 == errnum && (revents & (FDEVENT_ERR|FDEVENT_HUP))) errnum = EIO;
+    if (!proc->is_local || proc->pid == hc->conn.pid)
+        gw_proc_health_check_result(hc->host, proc, errnum, hc->srv->errh);
+    gw_proc_health_check_close(proc);
+    return HANDLER_FINISHED;
+}
+
+__attribute_cold__
+static void gw_proc_health_check_start(server * const srv, gw_host * const host, gw_proc * const proc) {
+    proc->hc_ts = log_monotonic_secs;
+    const int fd = fdevent_socket_nb_cloexec(host->family, SOCK_STREAM, 0);
+    if (-1 == fd) return; /*(try again next interval)*/
+    ++srv->cur_fds;
+
+    gw_health_check * const hc = ck_calloc(1, sizeof(*hc));
+    hc->host = host;
+    hc->srv = srv;
+    hc->conn.proc = proc;
+    hc->conn.ev = srv->ev;
+    hc->conn.pid = proc->pid;
+    hc->conn.idle_ts = log_monotonic_secs;
+    hc->conn.fdn =
+      fdevent_register(srv->ev, fd, gw_health_check_handle_fdevent, hc);
+    proc->hc = &hc->conn;
+
+    int errnum = 0;
+    if (-1 == connect(fd, proc->saddr, proc->saddrlen)) {
+      #ifdef _WIN32
+        errnum = WSAGetLastError();
+        if (errnum == WSAEINPROGRESS || errnum == WSAEALREADY
+            || errnum == WSAEWOULDBLOCK || errnum == WSAEINTR)
+      #else
+        errnum = errno;
+        if (errnum == EINPROGRESS || errnum == EALREADY || errnum == EINTR
+            || (errnum == EAGAIN && host->unixsocket))
+      #endif
+        {
+            fdevent_fdnode_event_set(srv->ev, hc->conn.fdn, FDEVENT_OUT);
+            return;
+        }
+    }
+    gw_proc_health_check_result(host, proc, errnum, srv->errh);
+    gw_proc_health_check_close(proc);
+}
+
+static void gw_handle_trigger_host_health(server * const srv, gw_host * const host) {
+    if (!host->health_check_interval || NULL == srv->ev) return;
+    const unix_time64_t cur_ts = log_monotonic_secs;
+    const unix_time64_t timeout = host->health_check_timeout
+      ? host->health_check_timeout
+      : host->connect_timeout ? host->connect_timeout : 2;
+    for (gw_proc *proc = host->first; proc; proc = proc->next) {
+        if (proc->hc) {
+            if (cur_ts - proc->hc->idle_ts < timeout) continue;
+            gw_proc_health_check_result(host, proc, ETIMEDOUT, srv->errh);
+            gw_proc_health_check_close(proc);
+            continue;
+        }
+        if (proc->state != PROC_STATE_RUNNING
+            && proc->state != PROC_STATE_OVERLOADED) continue;
+        if (cur_ts - proc->hc_ts < host->health_check_interval) continue;
+        gw_proc_health_check_start(srv, host, proc);
+    }
+}
+
+static uint32_t gw_host_procs_demand(const gw_host * const host) {
+    /* number of procs needed for current load, within [min_procs,max_procs]
+     * (max_load_per_proc 0 is treated as 1 request in-flight per proc) */
+    const uint32_t per_proc =
+      host->max_load_per_proc ? host->max_load_per_proc : 1;
+    uint32_t want = ((uint32_t)host->load + per_proc - 1) / per_proc;
+    if (want < host->min_procs) want = host->min_procs;
+    if (want > host->max_procs) want = host->max_procs;
+    return want;
+}
+
+static int gw_proc_idle_expired(const gw_proc * const proc, const unix_time64_t idle_ts) {
+    /* proc may be terminated if idle since before idle_ts */
+    return 0 == proc->load && proc->pid > 0 && proc->last_used < idle_ts;
+}
+
+static void gw_handle_trigger_host(server * const srv, gw_host * const host, log_error_st * const errh, const int debug) {
 
     /* check for socket timeouts on active requests to backend host */
     gw_handle_trigger_host_timeouts(host);
 
-    /* check each child proc to detect if proc exited */
+    /* proc state changes made by other workers */
+    if (host->shm) gw_host_shm_sync(host, errh);
 
-    gw_proc *proc;
-    unix_time64_t idle_timestamp;
-    int overload = 1;
+    /* close idle connections to backend host which are no longer usable */
+    gw_handle_trigger_host_conns(host);
+
+    /* release requests waiting too long on collapsed requests */
+    if (host->collapse) gw_handle_trigger_host_collapse(host);
+
+    /* expire requests waiting too long in queue for a proc */
+    if (host->queue_head) gw_handle_trigger_host_queue(host);
+
+    /* actively check backend procs */
+    gw_handle_trigger_host_health(srv, host);
+
+    /* decay stale latency estimates (balance "least-latency") */
+    gw_handle_trigger_host_latency(host);
+
+    /* check each child proc to detect if proc exited */
 
   #if 0 /* redundant w/ handle_waitpid hook since lighttpd 1.4.46 */
     for (proc = host->first; proc; proc = proc->next) {
@@ -2911,29 +4004,36 @@ static void gw_handle_trigger_host(gw_host * const host, log_error_st * const er
     if (host->min_procs == host->max_procs) return;
     if (!host->bin_path) return;
 
-    for (proc = host->first; proc; proc = proc->next) {
-        if (proc->load <= host->max_load_per_proc) {
-            overload = 0;
-            break;
-        }
-    }
+    /* spawn procs to match demand (in-flight requests to host, including
+     * requests queued on saturated procs), and terminate procs idle for
+     * host->idle_timeout while there are more procs than demand */
+    const uint32_t want = gw_host_procs_demand(host);
 
-    if (overload && host->num_procs && host->num_procs < host->max_procs) {
-        /* overload, spawn new child */
+    if (want > host->num_procs && host->num_procs) {
+        /* overload, spawn new children
+         * (limit burst to doubling num_procs each interval) */
+        uint32_t n = want - host->num_procs;
+        if (n > host->num_procs) n = host->num_procs;
         if (debug) {
             log_debug(errh, __FILE__, __LINE__,
-              "overload detected, spawning a new child");
+              "overload detected (load: %d), spawning %u new children",
+              host->load, n);
         }
 
-        gw_proc_spawn(host, errh, debug);
+        do {
+            const uint32_t num_procs = host->num_procs;
+            gw_proc_spawn(host, errh, debug);
+            if (num_procs == host->num_procs) break; /* spawn failed */
+        } while (--n);
+        return;
     }
 
-    idle_timestamp = log_monotonic_secs - host->idle_timeout;
-    for (proc = host->first; proc; proc = proc->next) {
-        if (host->num_procs <= host->min_procs) break;
-        if (0 != proc->load) continue;
-        if (proc->pid <= 0) continue;
-        if (proc->last_used >= idle_timestamp) continue;
+    const unix_time64_t idle_timestamp =
+      log_monotonic_secs - host->idle_timeout;
+    for (gw_proc *proc = host->first, *next; proc; proc = next) {
+        next = proc->next;
+        if (host->num_procs <= want) break;
+        if (!gw_proc_idle_expired(proc, idle_timestamp)) continue;
 
         /* terminate proc that has been idling for a long time */
         if (debug) {
@@ -2943,33 +4043,35 @@ static void gw_handle_trigger_host(gw_host * const host, log_error_st * const er
         }
 
         gw_proc_kill(host, proc);
-
-        /* proc is now in unused, let next second handle next process */
-        break;
     }
 
   #if 0 /* redundant w/ handle_waitpid hook since lighttpd 1.4.46 */
-    for (proc = host->unused_procs; proc; proc = proc->next) {
+    for (gw_proc *proc = host->unused_procs; proc; proc = proc->next) {
         gw_proc_waitpid(host, proc, errh);
     }
   #endif
 }
 
-static void gw_handle_trigger_exts(gw_exts * const exts, log_error_st * const errh, const int debug) {
+static void gw_handle_trigger_exts(server * const srv, gw_exts * const exts, log_error_st * const errh, const int debug) {
     for (uint32_t j = 0; j < exts->used; ++j) {
         gw_extension *ex = exts->exts+j;
         for (uint32_t n = 0; n < ex->used; ++n) {
-            gw_handle_trigger_host(ex->hosts[n], errh, debug);
+            gw_handle_trigger_host(srv, ex->hosts[n], errh, debug);
         }
     }
 }
 
-static void gw_handle_trigger_exts_wkr(gw_exts *exts, log_error_st *errh) {
+static void gw_handle_trigger_exts_wkr(server *srv, gw_exts *exts, log_error_st *errh) {
     for (uint32_t j = 0; j < exts->used; ++j) {
         gw_extension * const ex = exts->exts+j;
         for (uint32_t n = 0; n < ex->used; ++n) {
             gw_host * const host = ex->hosts[n];
             gw_handle_trigger_host_timeouts(host);
+            gw_handle_trigger_host_conns(host);
+            if (host->collapse) gw_handle_trigger_host_collapse(host);
+            if (host->queue_head) gw_handle_trigger_host_queue(host);
+            gw_handle_trigger_host_health(srv, host);
+            gw_handle_trigger_host_latency(host);
             for (gw_proc *proc = host->first; proc; proc = proc->next) {
                 if (proc->state == PROC_STATE_OVERLOADED)
                     gw_proc_check_enable(host, proc, errh);
@@ -3010,8 +4112,8 @@ handler_t gw_handle_trigger(server *srv, void *p_d) {
          * (unable to use p->defaults.debug since gw_plugin_config
          *  might be part of a larger plugin_config) */
         wkr
-          ? gw_handle_trigger_exts_wkr(conf->exts, errh)
-          : gw_handle_trigger_exts(conf->exts, errh, debug);
+          ? gw_handle_trigger_exts_wkr(srv, conf->exts, errh)
+          : gw_handle_trigger_exts(srv, conf->exts, errh, debug);
     }
 
     return HANDLER_GO_ON;
@@ -3056,6 +4158,7 @@ handler_t gw_handle_waitpid_cb(server *srv, void *p_d, pid_t pid, int status) {
             for (uint32_t n = 0; n < ex->used; ++n) {
                 gw_host *host = ex->hosts[n];
                 gw_proc *proc;
+                if (host->shm) gw_host_shm_reap(host, pid); /*(worker exited)*/
                 for (proc = host->first; proc; proc = proc->next) {
                     if (!proc->is_local || proc->pid != pid) continue;
 
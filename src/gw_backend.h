@@ -14,6 +14,21 @@ typedef struct {
     uint32_t used;
 } char_array;
 
+struct gw_proc;         /* declaration */
+struct gw_proc_shm;     /* declaration */
+struct fdevents;        /* declaration */
+struct fdnode_st;       /* declaration */
+
+/* idle connection to backend kept open for reuse (e.g. FCGI_KEEP_CONN) */
+typedef struct gw_conn {
+    struct gw_conn *next;
+    struct gw_proc *proc;
+    struct fdevents *ev;
+    struct fdnode_st *fdn;
+    pid_t pid;
+    unix_time64_t idle_ts;
+} gw_conn;
+
 typedef struct gw_proc {
     struct gw_proc *next; /* see first */
     enum {
@@ -24,9 +39,14 @@ typedef struct gw_proc {
         PROC_STATE_KILLED      /* killed (signal sent to proc) */
     } state;
     uint32_t load; /* number of requests waiting on this process */
+    uint32_t latency; /* EWMA of backend response latency (usec) */
+    unix_time64_t latency_ts; /* time of last latency sample */
     unix_time64_t last_used; /* see idle_timeout */
+    /* counters in plugin_stats, resolved when proc is initialized */
     int *stats_load;
     int *stats_connected;
+    int *stats_died;
+    int *stats_overloaded;
     pid_t pid;   /* PID of the spawned process (0 if not spawned locally) */
     int is_local;
     uint32_t id; /* id will be between 1 and max_procs */
@@ -40,6 +60,14 @@ typedef struct gw_proc {
     buffer *connection_name;
     buffer *unixsocket; /* config.socket + "-" + id */
     unsigned short port;  /* config.port + pno */
+
+    gw_conn *conns;       /* idle connections to proc (most recent first) */
+    uint32_t num_conns;
+
+    gw_conn *hc;          /* active health check connect() in progress */
+    unix_time64_t hc_ts;  /* time of last active health check */
+
+    struct gw_proc_shm *shm; /* state shared with other workers (or NULL) */
 } gw_proc;
 
 struct gw_handler_ctx;  /* declaration */
@@ -58,8 +86,13 @@ typedef struct {
     uint32_t gw_hash;
 
     int32_t load;
+    uint32_t latency; /* EWMA of backend response latency (usec) */
+    unix_time64_t latency_ts; /* time of last latency sample */
+    /* counters in plugin_stats, resolved when host is initialized */
     int *stats_load;
+    int *stats_procs; /* num_procs (changes with adaptive spawning) */
     int *stats_global_active;
+    int *stats_requests; /* "<module>.requests", e.g. "fastcgi.requests" */
 
     /*
      * host:port
@@ -79,13 +112,21 @@ typedef struct {
     const buffer *id;
     gw_proc *unused_procs;
 
+    /* proc state shared across workers if server.max-worker is non-zero
+     * (one entry per proc id, with load counted per worker slot; mapped
+     *  before workers are forked; slot released when master reaps worker) */
+    struct gw_proc_shm *shm;
+    pid_t *shm_workers;     /* pid of worker owning each load slot */
+    uint32_t shm_nworkers;  /* number of worker slots */
+    int shm_slot;           /* load slot of this worker (-1 if not claimed) */
+
     /*
      * spawn at least min_procs, at max_procs.
      *
-     * as soon as the load of the first entry
-     * is max_load_per_proc we spawn a new one
-     * and add it to the first entry and give it
-     * the load
+     * when the load of the host exceeds
+     * num_procs * max_load_per_proc we spawn
+     * enough new procs to handle the load
+     * (at most doubling num_procs each second)
      *
      */
 
@@ -210,6 +251,56 @@ typedef struct {
 
     uint8_t upgrade;
     uint8_t tcp_fin_propagate;
+
+    /*
+     * max number of idle connections kept open to each proc for reuse
+     * (0 disables; supported by backend protocols which can signal the
+     *  end of a response without closing the connection, e.g. FastCGI)
+     */
+    unsigned short keep_conn;
+
+    /*
+     * active health check: connect() to each proc every interval secs
+     * and disable (or re-enable) the proc before requests are sent to it
+     * (0 disables; timeout defaults to connect-timeout, else 2 secs)
+     */
+    unsigned short health_check_interval;
+    unsigned short health_check_timeout;
+
+    /*
+     * collapse forwarding: concurrent identical cacheable GET requests
+     * wait on a single in-flight backend request (the leader) and are sent
+     * a copy of its response (if also cacheable)
+     * (max waiters per leader; 0 disables; waiters released after timeout)
+     */
+    unsigned short collapse_forwarding;
+    unsigned short collapse_timeout;
+    struct gw_handler_ctx *collapse; /* in-flight leaders */
+
+    /*
+     * request queue: when no proc is running with load below
+     * max_load_per_proc (0 (default) for no limit), requests wait in FIFO
+     * order for a proc (max queue_max requests; each for max queue_timeout secs)
+     * (queue_max 0 disables; requests are then sent to a loaded proc,
+     *  or are sent 503 Service Unavailable if all procs are disabled)
+     */
+    unsigned short queue_max;
+    unsigned short queue_timeout;
+    uint32_t queue_len;
+    struct gw_handler_ctx *queue_head;
+    struct gw_handler_ctx *queue_tail;
+    int *stats_queue_length;
+    int *stats_queue_wait[6]; /* histogram of queue wait time */
+    int *stats_queue_rejected;
+    int *stats_queue_timeout;
+
+    /*
+     * balance "hash": skip host if its load would exceed average load of
+     * active hosts by more than hash_load_bound percent (bounded loads;
+     * 0 disables, and requests always go to the highest weight host)
+     */
+    unsigned short hash_load_bound;
+
     unsigned short kill_signal; /* we need a setting for this as libfcgi
                                    applications prefer SIGUSR1 while the
                                    rest of the world would use SIGTERM
@@ -293,8 +384,6 @@ typedef enum {
     GW_STATE_READ
 } gw_connection_state_t;
 
-struct fdevents;        /* declaration */
-
 #define GW_RESPONDER  1
 #define GW_AUTHORIZER 2
 #define GW_FILTER     3  /*(not implemented)*/
@@ -324,6 +413,17 @@ typedef struct gw_handler_ctx {
 
     int       request_id;
     int       send_content_body;
+    uint32_t  rb_skip;     /* bytes to discard from rb (e.g. packet padding) */
+    uint8_t   keep_conn;   /* backend connection may be kept open for reuse */
+    uint8_t   conn_reused; /* backend connection reused from proc->conns */
+    uint8_t   collapse_state; /* (see host->collapse_forwarding) */
+    uint32_t  collapse_num;   /* (leader) number of waiters */
+    struct gw_handler_ctx *collapse_waiters; /* (leader) */
+    struct gw_handler_ctx *collapse_next;    /* next leader or next waiter */
+    struct gw_handler_ctx *collapse_leader;  /* (waiter) */
+    uint8_t   queued;      /* waiting in host->queue_head list */
+    struct gw_handler_ctx *queue_next;
+    uint64_t  queue_us;    /* time request entered host queue */
 
     http_response_opts opts;
     gw_plugin_config conf;
@@ -333,6 +433,7 @@ typedef struct gw_handler_ctx {
     gw_plugin_data *plugin_data; /* dumb pointer */
     unix_time64_t read_ts;
     unix_time64_t write_ts;
+    uint64_t  dispatch_us; /* (balance "least-latency") */
     handler_t(*stdin_append)(struct gw_handler_ctx *hctx);
     handler_t(*create_env)(struct gw_handler_ctx *hctx);
     struct gw_handler_ctx *prev;
@@ -373,6 +474,15 @@ handler_t gw_handle_waitpid_cb(server *srv, void *p_d, pid_t pid, int status);
 
 void gw_set_transparent(gw_handler_ctx *hctx);
 
+/* (for modules which manage their own connections to hctx->proc, e.g. to
+ *  multiplex requests over a shared connection; hctx->fd remains -1) */
+int gw_proc_select(gw_handler_ctx *hctx);
+void gw_proc_connect_status(gw_handler_ctx *hctx, request_st *r, int errnum);
+void gw_connection_close(gw_handler_ctx *hctx, request_st *r);
+handler_t gw_reconnect(gw_handler_ctx *hctx, request_st *r);
+__attribute_cold__
+handler_t gw_backend_error(gw_handler_ctx *hctx, request_st *r);
+
 int gw_upgrade_policy (request_st *r, int auth_mode, int upgrade);
 
 #endif
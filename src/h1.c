@@ -125,12 +125,13 @@ h1_send_100_continue (request_st * const r, connection * const con)
 }
 
 
-__attribute_cold__
-static void
+static uint32_t
 h1_send_headers_partial_1xx (request_st * const r, buffer * const b)
 {
     /* take data in con->write_queue and move into b
-     * (to be sent prior to final response headers in r->write_queue) */
+     * (to be sent prior to final response headers in r->write_queue)
+     * (data is partial 1xx, or responses to prior pipelined requests
+     *  deferred by connection_write_defer()) */
     connection * const con = r->con;
     /*assert(&r->write_queue != con->write_queue);*/
     chunkqueue * const cq = con->write_queue;
@@ -144,6 +145,10 @@ h1_send_headers_partial_1xx (request_st * const r, buffer * const b)
         len = 0;
     buffer_truncate(b, len);/*expect initial empty buffer from caller*/
     chunkqueue_free(cq);
+    /* data was accounted in r->write_queue.bytes_out when queued;
+     * skip for http_request_stats_bytes_out() when it is sent again */
+    r->x.h1.bytes_written_ckpt += len;
+    return len;
 }
 
 
@@ -194,8 +199,9 @@ h1_send_headers (request_st * const r)
     chunkqueue * const cq = &r->write_queue;
     buffer * const b = chunkqueue_prepend_buffer_open(cq);
 
-    if (cq != r->con->write_queue)
-        h1_send_headers_partial_1xx(r, b);
+    const uint32_t plen = (cq != r->con->write_queue)
+      ? h1_send_headers_partial_1xx(r, b)
+      : 0;
 
     buffer_append_string_len(b,
                              (r->http_version == HTTP_VERSION_1_1)
@@ -242,11 +248,12 @@ h1_send_headers (request_st * const r)
                               BUF_PTR_LEN(r->conf.server_tag));
 
     buffer_append_string_len(b, CONST_STR_LEN("\r\n\r\n"));
-    r->resp_header_len = buffer_clen(b);
+    r->resp_header_len = buffer_clen(b) - plen;
 
     if (r->conf.log_response_header)
         log_debug_multiline(r->conf.errh, __FILE__, __LINE__,
-                            BUF_PTR_LEN(b), "fd:%d resp: ", r->con->fd);
+                            b->ptr+plen, r->resp_header_len,
+                            "fd:%d resp: ", r->con->fd);
 
     chunkqueue_prepend_buffer_commit(cq);
 
@@ -254,7 +261,7 @@ h1_send_headers (request_st * const r)
     off_t cqlen;
     if (r->resp_body_finished
         && light_btst(r->resp_htags, HTTP_HEADER_CONTENT_LENGTH)
-        && (cqlen = chunkqueue_length(cq) - r->resp_header_len) > 0
+        && (cqlen = chunkqueue_length(cq) - buffer_clen(b)) > 0
         && cqlen < 16384)
         chunkqueue_small_resp_optim(cq);
 }
@@ -590,6 +597,70 @@ h1_chunked_crlf (chunkqueue * const cq)
 }
 
 
+static handler_t
+h1_chunked_mem (request_st * const r, chunkqueue * const cq, chunkqueue * const dst_cq, const off_t max_request_size)
+{
+    /* fast path for many small chunks: decode sequence of complete chunks
+     * ("HEX\r\n" data "\r\n") contained in first MEM_CHUNK in cq in place,
+     * moving chunk data over chunk headers, then transfer the decoded data
+     * to dst_cq at once.  Stop at anything else (chunk ext, final chunk,
+     * chunk crossing end of MEM_CHUNK) and leave it for h1_chunked() */
+    chunk * const c = cq->first;
+    if (NULL == c || c->type != MEM_CHUNK) return HANDLER_GO_ON;
+    char * const s0 = c->mem->ptr + c->offset;
+    const char * const end = c->mem->ptr + buffer_clen(c->mem);
+    char *s = s0;
+    char *d = s0;
+    for (;;) {
+        /* (c->mem is '\0'-terminated; hex2int('\0') is 0xFF) */
+        char *h = s;
+        uint32_t n = 0;
+        for (unsigned char u; (u = (unsigned char)hex2int(*h)) != 0xFF; ++h) {
+            if (h - s == 7) break; /*(< 256 MB; larger handled elsewhere)*/
+            n = (n << 4) | u;
+        }
+        if (0 == n || h[0] != '\r' || h[1] != '\n') break;
+        h += 2;
+        if ((uint32_t)(end - h) < n + 2 || h[n] != '\r' || h[n+1] != '\n')
+            break;
+        memmove(d, h, n);
+        d += n;
+        s = h + n + 2;
+    }
+
+    const off_t dlen = (off_t)(d - s0);
+    if (0 == dlen) return HANDLER_GO_ON;
+
+    if (0 != max_request_size
+        && max_request_size - dlen < dst_cq->bytes_in) {
+        log_error(r->conf.errh, __FILE__, __LINE__,
+          "request-size too long: %lld -> 413",
+          (long long)(dst_cq->bytes_in + dlen));
+        /* 413 Payload Too Large */
+        return http_response_reqbody_read_error(r, 413);
+    }
+
+    const off_t hlen = (off_t)(s - d); /*(consumed chunk headers and CRLF)*/
+    if (s == end) {
+        /* entire MEM_CHUNK decoded; move chunk by reference */
+        buffer_truncate(c->mem, (uint32_t)(d - c->mem->ptr));
+        cq->bytes_out += hlen;
+    }
+    if (dst_cq->bytes_in + dlen <= 64*1024) {
+        /* avoid buffering request bodies <= 64k on disk */
+        chunkqueue_steal(dst_cq, cq, dlen);
+    }
+    else if (0 != chunkqueue_steal_with_tempfiles(dst_cq, cq, dlen,
+                                                  r->conf.errh)) {
+        /* 500 Internal Server Error */
+        return http_response_reqbody_read_error(r, 500);
+    }
+    if (s != end)
+        chunkqueue_mark_written(cq, hlen);
+    return HANDLER_GO_ON;
+}
+
+
 static handler_t
 h1_chunked (request_st * const r, chunkqueue * const cq, chunkqueue * const dst_cq)
 {
@@ -597,6 +668,12 @@ h1_chunked (request_st * const r, chunkqueue * const cq, chunkqueue * const dst_
     const off_t max_request_size = (off_t)r->conf.max_request_size << 10;
     off_t te_chunked = r->x.h1.te_chunked;
     do {
+        if (0 == te_chunked) {
+            handler_t rc = h1_chunked_mem(r, cq, dst_cq, max_request_size);
+            if (HANDLER_GO_ON != rc) return rc;
+            if (chunkqueue_is_empty(cq)) break;
+        }
+
         off_t len = chunkqueue_length(cq);
 
         while (0 == te_chunked) {
@@ -635,6 +635,73 @@ h2_recv_rst_stream (connection * const con, const uint8_t * const s, const uint3
 }
 
 
+/* max recv window per connection grown by h2_recv_ping_bdp() (memory budget)*/
+#define H2_RWIN_MAX (16u << 20) /* 16 MB */
+
+/* PING sent to estimate bandwidth-delay product (BDP) */
+static const uint8_t h2_ping_bdp[] = { /*(big-endian numbers)*/
+  /* PING */
+  0x00, 0x00, 0x08        /* frame length */
+ ,H2_FTYPE_PING           /* frame type */
+ ,0x00                    /* frame flags */
+ ,0x00, 0x00, 0x00, 0x00  /* stream identifier */
+ ,'l', 'i', 'g', 'h', 't', 'b', 'd', 'p' /* opaque */
+};
+
+
+static void
+h2_send_window_update (connection * const con, uint32_t h2id, const uint32_t len);
+
+
+static void
+h2_recv_data_bdp (connection * const con, h2con * const h2c, const uint32_t len)
+{
+    /* Receive windows are replenished as DATA is received, so the windows
+     * limit DATA in flight: throughput <= window / RTT.  Estimate the BDP as
+     * the amount of DATA received during the round trip of a PING, sent when
+     * DATA is received and no probe is outstanding (see h2_recv_ping_bdp()) */
+    h2c->bdp_bytes += len;
+    if (h2c->bdp_ping || h2c->c_rwin_sz >= H2_RWIN_MAX)
+        return;
+    h2c->bdp_ping = 1;
+    h2c->bdp_bytes = 0;
+    chunkqueue_append_mem(con->write_queue,
+                          (const char *)h2_ping_bdp, sizeof(h2_ping_bdp));
+}
+
+
+__attribute_cold__
+static void
+h2_recv_ping_bdp (connection * const con)
+{
+    /* grow windows to twice the BDP estimate if DATA in flight appears to be
+     * limited by the connection window, up to H2_RWIN_MAX per connection */
+    h2con * const h2c = (h2con *)con->hx;
+    if (!h2c->bdp_ping) return;
+    h2c->bdp_ping = 0;
+    const uint32_t bdp = h2c->bdp_bytes;
+    if (bdp < h2c->c_rwin_sz / 3 * 2) return;
+    const uint32_t n = (bdp < H2_RWIN_MAX / 2) ? bdp * 2 : H2_RWIN_MAX;
+    if (n <= h2c->c_rwin_sz) return;
+    h2_send_window_update(con, 0, n - h2c->c_rwin_sz);
+    h2c->c_rwin_sz = n;
+
+    if (n <= h2c->rwin_sz) return;
+    const uint32_t delta = n - h2c->rwin_sz;
+    h2c->rwin_sz = n;
+    /* grow window of active streams receiving request body
+     * (streams which received larger window in h2_recv_headers()) */
+    for (uint32_t i = 0, rused = h2c->rused; i < rused; ++i) {
+        const request_st * const r = h2c->r[i];
+        if ((r->x.h2.state == H2_STATE_OPEN
+             || r->x.h2.state == H2_STATE_HALF_CLOSED_LOCAL)
+            && r->reqbody_length
+            && !(r->conf.stream_request_body & FDEVENT_STREAM_REQUEST_BUFMIN))
+            h2_send_window_update(con, r->x.h2.id, delta);
+    }
+}
+
+
 static void
 h2_recv_ping (connection * const con, uint8_t * const s, const uint32_t len)
 {
@@ -665,8 +732,11 @@ h2_recv_ping (connection * const con, uint8_t * const s, const uint32_t len)
         h2_send_goaway_e(con, H2_E_PROTOCOL_ERROR);
         return;
     }
-    if (s[4] & H2_FLAG_ACK) /*(ignore; unexpected if we did not send PING)*/
-        return;
+    if (s[4] & H2_FLAG_ACK) {
+        if (0 == memcmp(s+9, h2_ping_bdp+9, 8))
+            h2_recv_ping_bdp(con);
+        return; /*(ignore other; unexpected if we did not send PING)*/
+    }
     /* reflect PING back to peer with frame flag ACK */
     /* (9 byte frame header plus 8 byte PING payload = 17 bytes)*/
     s[4] = H2_FLAG_ACK;
@@ -701,6 +771,26 @@ h2_apply_priority_update (h2con * const h2c, const request_st * const r, const u
 }
 
 
+static int
+h2_rotate_stream (h2con * const h2c, const uint32_t rpos)
+{
+    /* move stream behind other streams with same priority (round-robin)
+     * (order by stream id within same priority is not preserved; this is
+     *  not required by h2_apply_priority_update(), which compares priority
+     *  before stream id) */
+    request_st ** const rr = h2c->r;
+    request_st * const r = rr[rpos];
+    uint32_t npos = rpos;
+    while (npos+1 < h2c->rused && rr[npos+1]->x.h2.prio == r->x.h2.prio)
+        ++npos;
+    if (npos == rpos)
+        return 0;
+    memmove(rr+rpos, rr+rpos+1, (npos - rpos)*sizeof(request_st *));
+    rr[npos] = r;
+    return 1;
+}
+
+
 __attribute_noinline__
 __attribute_nonnull__()
 __attribute_pure__
@@ -1167,6 +1257,7 @@ h2_recv_data (connection * const con, const uint8_t * const s, const uint32_t le
      * Pre-emptively increase window size up to 16k (default max frame size)
      * and then defer small window updates until the excess is utilized. */
     h2_send_window_update_unit(con, h2r, len); /*(h2r->x.h2.rwin)*/
+    h2_recv_data_bdp(con, h2c, len);
 
     chunkqueue * const dst = &r->reqbody_queue;
 
@@ -1886,7 +1977,8 @@ h2_recv_headers (connection * const con, uint8_t * const s, uint32_t flen)
          * but do not increase window size if BUFMIN set in global config)*/
         if (r->reqbody_length /*(see h2_init_con() for session window)*/
             && !(r->conf.stream_request_body & FDEVENT_STREAM_REQUEST_BUFMIN))
-            h2_send_window_update(con, id, 131072); /*(add 128k)*/
+            /*(add 128k, or more if grown by h2_recv_ping_bdp())*/
+            h2_send_window_update(con, id, h2c->rwin_sz - 65536);
 
         if (light_btst(r->rqst_htags, HTTP_HEADER_PRIORITY)) {
             const buffer * const prio =
@@ -2220,6 +2312,8 @@ h2_init_con (request_st * const restrict h2r, connection * const restrict con)
     h2r->x.h2.rwin = 262144;              /* h2 connection recv window (256k)*/
     h2r->x.h2.swin = 65535;               /* h2 connection send window */
     h2r->x.h2.rwin_fudge = 0;
+    h2c->c_rwin_sz = 262144;              /* h2 connection recv window (256k)*/
+    h2c->rwin_sz = 65536 + 131072;        /* h2 stream recv window (192k) */
     /* settings sent from peer */         /* initial values */
     h2c->s_header_table_size     = 4096;  /* SETTINGS_HEADER_TABLE_SIZE      */
     h2c->s_enable_push           = 1;     /* SETTINGS_ENABLE_PUSH            */
@@ -2535,6 +2629,8 @@ h2_send_headers (request_st * const r, connection * const con)
         /* "date: " 6-chars + 30-chars for "%a, %d %b %Y %T GMT" + '\0' */
         static unix_time64_t tlast = 0;
         static char tstr[36] = "date: ";
+        static uint32_t thash[2];   /* cached name_hash, nameval_hash */
+        static int thash_valid = 0;
 
         memset(&lsx, 0, sizeof(lsxpack_header_t));
         lsx.buf = tstr;
@@ -2546,8 +2642,16 @@ h2_send_headers (request_st * const r, connection * const con)
 
         /* cache the generated timestamp */
         const unix_time64_t cur_ts = log_epoch_secs;
-        if (__builtin_expect ( (tlast != cur_ts), 0))
+        if (__builtin_expect ( (tlast != cur_ts), 0)) {
             http_date_time_to_str(tstr+6, sizeof(tstr)-6, (tlast = cur_ts));
+            thash_valid = 0;
+        }
+        /* reuse hashes from HPACK encoding of same timestamp (if any) */
+        if (thash_valid) {
+            lsx.flags = LSXPACK_NAME_HASH | LSXPACK_NAMEVAL_HASH;
+            lsx.name_hash = thash[0];
+            lsx.nameval_hash = thash[1];
+        }
 
         alen += 35+2;
 
@@ -2560,6 +2664,11 @@ h2_send_headers (request_st * const r, connection * const con)
             h2_send_rst_stream(r, con, H2_E_INTERNAL_ERROR);
             return;
         }
+        if (!thash_valid && (lsx.flags & LSXPACK_NAMEVAL_HASH)) {
+            thash[0] = lsx.name_hash;
+            thash[1] = lsx.nameval_hash;
+            thash_valid = 1;
+        }
     }
 
     if (!light_btst(r->resp_htags, HTTP_HEADER_SERVER) && r->conf.server_tag) {
@@ -2575,6 +2684,12 @@ h2_send_headers (request_st * const r, connection * const con)
         lsx.val_offset = 0;
         lsx.val_len = vlen;
         lsx.hpack_index = LSHPACK_HDR_SERVER;
+        /* reuse hashes from previous HPACK encoding of same server_tag */
+        if (h2c->server_tag == r->conf.server_tag) {
+            lsx.flags = LSXPACK_NAME_HASH | LSXPACK_NAMEVAL_HASH;
+            lsx.name_hash = h2c->server_tag_hash[0];
+            lsx.nameval_hash = h2c->server_tag_hash[1];
+        }
 
         if (log_response_header)
             h2_log_response_header_lsx(r, &lsx);
@@ -2585,6 +2700,12 @@ h2_send_headers (request_st * const r, connection * const con)
             h2_send_rst_stream(r, con, H2_E_INTERNAL_ERROR);
             return;
         }
+        if (h2c->server_tag != r->conf.server_tag
+            && (lsx.flags & LSXPACK_NAMEVAL_HASH)) {
+            h2c->server_tag = r->conf.server_tag;
+            h2c->server_tag_hash[0] = lsx.name_hash;
+            h2c->server_tag_hash[1] = lsx.nameval_hash;
+        }
     }
 
     alen += 2; /* "virtual" blank line ("\r\n") ending headers */
@@ -2938,8 +3059,15 @@ h2_send_cqdata (request_st * const r, connection * const con, chunkqueue * const
 
     dataframe.u[2] = htonl(r->x.h2.id);
 
-    /* XXX: does not provide an optimization to send final set of data with
-     *      END_STREAM flag; see h2_send_end_stream_data() to end stream */
+    /* send END_STREAM flag on final DATA frame if response is complete and
+     * there are no trailers to send, avoiding extra 0-length DATA frame
+     * later sent by h2_send_end_stream_data() */
+    const uint8_t eos =
+      (cq == &r->write_queue && r->resp_body_finished
+       && !(r->gw_dechunk && r->gw_dechunk->done
+            && !buffer_is_unset(&r->gw_dechunk->b)))
+      ? H2_FLAG_END_STREAM
+      : 0;
 
     /* adjust stream and connection windows */
     /*assert(dlen <= INT32_MAX);*//* dlen should be <= MAX_WRITE_LIMIT */
@@ -2992,6 +3120,7 @@ h2_send_cqdata (request_st * const r, connection * const con, chunkqueue * const
                 }
                 dlen -= len;
                 sent += len;
+                dataframe.c[7] = (off_t)sent == cqlen ? eos : 0;
                 dataframe.c[3] = (len >> 16) & 0xFF; /*(+3 to skip align pad)*/
                 dataframe.c[4] = (len >>  8) & 0xFF;
                 dataframe.c[5] = (len      ) & 0xFF;
@@ -3013,6 +3142,7 @@ h2_send_cqdata (request_st * const r, connection * const con, chunkqueue * const
         const uint32_t len = dlen < fsize ? dlen : fsize;
         dlen -= len;
         sent += len;
+        dataframe.c[7] = (off_t)sent == cqlen ? eos : 0;
         dataframe.c[3] = (len >> 16) & 0xFF; /*(off +3 to skip over align pad)*/
         dataframe.c[4] = (len >>  8) & 0xFF;
         dataframe.c[5] = (len      ) & 0xFF;
@@ -3022,6 +3152,14 @@ h2_send_cqdata (request_st * const r, connection * const con, chunkqueue * const
     } while (dlen);
     r->x.h2.swin   -= (int32_t)sent;
     h2r->x.h2.swin -= (int32_t)sent;
+    if (eos && (off_t)sent == cqlen) {
+        /* END_STREAM sent; (see h2_send_end_stream_data())
+         *   H2_STATE_OPEN -> H2_STATE_HALF_CLOSED_LOCAL
+         *   H2_STATE_HALF_CLOSED_REMOTE -> H2_STATE_CLOSED */
+        r->x.h2.state = (r->x.h2.state == H2_STATE_HALF_CLOSED_REMOTE)
+          ? H2_STATE_CLOSED
+          : H2_STATE_HALF_CLOSED_LOCAL;
+    }
     return sent;
 }
 
@@ -3483,11 +3621,19 @@ h2_process_streams (connection * const con,
                         || (r->conf.stream_response_body
                             & (FDEVENT_STREAM_RESPONSE
                               |FDEVENT_STREAM_RESPONSE_BUFMIN)))) {
-                    /*(subtract 9 byte HTTP/2 frame overhead from each 16k DATA
-                     * frame for more efficient sending of large files)*/
-                    /*(use smaller max per stream if marked 'incremental' (w/ 0)
-                     * to give more streams a chance to send in parallel)*/
-                    uint32_t dlen = (r->x.h2.prio & 1) ? 32768-18 : 8192;
+                    /* RFC 9218 Extensible Prioritization Scheme for HTTP
+                     * h2c->r[] is ordered by urgency, then incremental before
+                     * non-incremental, then stream id.  Non-incremental
+                     * streams are sent sequentially: stream may use all of
+                     * max_bytes.  Incremental streams are sent round-robin
+                     * with a fixed quantum; stream which sends full quantum
+                     * is moved behind other streams with same priority.
+                     * Stream cut short by max_bytes keeps its place, to be
+                     * first in next pass (deficit) */
+                    const int incremental = !(r->x.h2.prio & 1);
+                    uint32_t dlen = incremental
+                      ? 8192
+                      : (uint32_t)max_bytes; /*(max_bytes <= MAX_WRITE_LIMIT)*/
                     if (dlen > (uint32_t)max_bytes) dlen = (uint32_t)max_bytes;
                     dlen = h2_send_cqdata(r, con, &r->write_queue, dlen);
                     max_bytes -= (off_t)dlen;
@@ -3495,6 +3641,11 @@ h2_process_streams (connection * const con,
                         /*(do not resched (spin) if swin empty window)*/
                         if (dlen || r->write_queue.first->file.busy)
                             resched |= r->write_queue.first->file.busy ? 4 : 1;
+                        /*(visit stream at i again if moved; dlen > 0 and
+                         * max_bytes is reduced, so pass ends)*/
+                        if (incremental && 8192 == dlen
+                            && h2_rotate_stream(h2c, i))
+                            --i;
                         continue;
                     }
                 }
@@ -88,6 +88,12 @@ struct h2con {
     struct lshpack_dec decoder;
     struct lshpack_enc encoder;
     unix_time64_t half_closed_ts;
+    uint32_t c_rwin_sz;  /* connection recv window size */
+    uint32_t rwin_sz;    /* stream recv window size (request body) */
+    uint32_t bdp_bytes;  /* DATA received since BDP probe PING sent */
+    uint8_t bdp_ping;    /* BDP probe PING outstanding */
+    const buffer *server_tag;     /* server_tag of cached HPACK hashes */
+    uint32_t server_tag_hash[2];  /* HPACK name_hash, nameval_hash */
     uint8_t n_refused_stream;
     uint8_t n_discarded_headers;
     uint8_t n_recv_rst_stream;
@@ -1402,6 +1402,11 @@ handler_t http_response_read(request_st * const r, http_response_opts * const op
               : toread;
             avail = chunk_buffer_prepare_append(b, avail);
         }
+        /* mod_fastcgi sets opts->max_per_read to end of partially received
+         * FCGI_STDOUT content so that content ends at end of read and can
+         * be moved without copying (see mod_fastcgi.c) */
+        if (opts->backend == BACKEND_FASTCGI && avail > opts->max_per_read)
+            avail = opts->max_per_read;
 
       #ifdef _WIN32
         n = recv(fd, b->ptr+buffer_clen(b), avail, 0);
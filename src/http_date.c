@@ -280,6 +280,16 @@ http_date_time_to_str (char * const s, const size_t sz, const unix_time64_t t)
 }
 
 
+unix_time64_t
+http_date_str_to_time (const char * const s, const uint32_t len)
+{
+    struct tm tm;
+    if (NULL == http_date_str_to_tm(s, len, &tm))
+        return -1; /* date parse error */
+    return TIME64_CAST(timegm(&tm));
+}
+
+
 int
 http_date_if_modified_since (const char * const ifmod, const uint32_t ifmodlen,
                              const unix_time64_t lmtime)
@@ -22,6 +22,9 @@ uint32_t http_date_time_to_str (char *s, size_t sz, unix_time64_t t);
 
 int http_date_if_modified_since (const char *ifmod, uint32_t ifmodlen, unix_time64_t lmtime);
 
+/*(returns -1 if date parse error)*/
+unix_time64_t http_date_str_to_time (const char *s, uint32_t len);
+
 /*(convenience macro to append IMF-fixdate to (buffer *))*/
 #define http_date_time_append(b, t)                                           \
   do {                                                                        \
@@ -7,6 +7,7 @@
 #include "first.h"
 
 #include <string.h>
+#include "sys-simd.h"
 #include "sys-strings.h"
 
 #include "http_header.h"
@@ -358,19 +359,43 @@ void http_header_env_append(request_st * const r, const char *k, uint32_t klen,
 }
 
 
+static inline int
+http_header_parse_hoff_eol (const char * const n, const uint32_t x, uint32_t * const hlen, unsigned short hoff[8192])
+{
+    /* x is offset following '\n'; *hlen is offset of start of line */
+    if (x - *hlen <= 2 && (x - *hlen == 1 || n[x-2] == '\r')) {
+        hoff[hoff[0]+1] = x;
+        return 1;
+    }
+    if (++hoff[0] >= /*sizeof(hoff)/sizeof(hoff[0])-1*/ 8192-1)
+        return -1;
+    hoff[hoff[0]] = *hlen = x;
+    return 0;
+}
+
+
 uint32_t
 http_header_parse_hoff (const char *n, const uint32_t clen, unsigned short hoff[8192])
 {
-    uint32_t hlen = 0;
-    for (const char *b; (n = memchr((b = n),'\n',clen-hlen)); ++n) {
-        uint32_t x = (uint32_t)(n - b + 1);
-        hlen += x;
-        if (x <= 2 && (x == 1 || n[-1] == '\r')) {
-            hoff[hoff[0]+1] = hlen;
-            return hlen;
+    uint32_t hlen = 0; /* offset of start of current line */
+    uint32_t i = 0;
+    int rc;
+  #ifdef LI_SIMD
+    /* scan 16 bytes at a time and process each '\n' found in bitmask
+     * (avoids per-line memchr() call overhead for typically short lines) */
+    for (; i + LI_SIMD <= clen; i += LI_SIMD) {
+        li_simd_mask_t m = li_simd_eq(li_simd_load(n+i), '\n');
+        for (; m; m = li_simd_mask_next(m)) {
+            const uint32_t x = i + li_simd_mask_first(m) + 1;
+            rc = http_header_parse_hoff_eol(n, x, &hlen, hoff);
+            if (rc) return rc > 0 ? x : 0;
         }
-        if (++hoff[0] >= /*sizeof(hoff)/sizeof(hoff[0])-1*/ 8192-1) break;
-        hoff[hoff[0]] = hlen;
+    }
+  #endif
+    for (const char *e; (e = memchr(n+i, '\n', clen-i)); ) {
+        i = (uint32_t)(e - n + 1);
+        rc = http_header_parse_hoff_eol(n, i, &hlen, hoff);
+        if (rc) return rc > 0 ? i : 0;
     }
     return 0;
 }
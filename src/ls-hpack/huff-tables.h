@@ -5140,3 +5140,1045 @@ static const struct decode_el decode_tables[256][16] =
         { 0, 0x04, 0 },
     },
 };
+
+
+#if !LS_HPACK_USE_LARGE_TABLES
+/*(lighttpd customization)*/
+/* Multi-symbol decode table indexed by next 12 bits of input.
+ * lens: (bits consumed << 2) | number of symbols decoded (0, 1, or 2)
+ * lens is 0 if the next code is longer than 12 bits.  A second symbol is
+ * included only if it is fully contained in the 12 bits. */
+struct hdec12
+{
+    uint8_t lens;
+    uint8_t out[3]; /*(out[2] unused; pads entry to 4 bytes)*/
+};
+
+static const struct hdec12 hdecs12[4096] =
+{
+    { 42,{ 48, 48}}, { 42,{ 48, 48}}, { 42,{ 48, 48}}, { 42,{ 48, 48}},
+    { 42,{ 48, 49}}, { 42,{ 48, 49}}, { 42,{ 48, 49}}, { 42,{ 48, 49}},
+    { 42,{ 48, 50}}, { 42,{ 48, 50}}, { 42,{ 48, 50}}, { 42,{ 48, 50}},
+    { 42,{ 48, 97}}, { 42,{ 48, 97}}, { 42,{ 48, 97}}, { 42,{ 48, 97}},
+    { 42,{ 48, 99}}, { 42,{ 48, 99}}, { 42,{ 48, 99}}, { 42,{ 48, 99}},
+    { 42,{ 48,101}}, { 42,{ 48,101}}, { 42,{ 48,101}}, { 42,{ 48,101}},
+    { 42,{ 48,105}}, { 42,{ 48,105}}, { 42,{ 48,105}}, { 42,{ 48,105}},
+    { 42,{ 48,111}}, { 42,{ 48,111}}, { 42,{ 48,111}}, { 42,{ 48,111}},
+    { 42,{ 48,115}}, { 42,{ 48,115}}, { 42,{ 48,115}}, { 42,{ 48,115}},
+    { 42,{ 48,116}}, { 42,{ 48,116}}, { 42,{ 48,116}}, { 42,{ 48,116}},
+    { 46,{ 48, 32}}, { 46,{ 48, 32}}, { 46,{ 48, 37}}, { 46,{ 48, 37}},
+    { 46,{ 48, 45}}, { 46,{ 48, 45}}, { 46,{ 48, 46}}, { 46,{ 48, 46}},
+    { 46,{ 48, 47}}, { 46,{ 48, 47}}, { 46,{ 48, 51}}, { 46,{ 48, 51}},
+    { 46,{ 48, 52}}, { 46,{ 48, 52}}, { 46,{ 48, 53}}, { 46,{ 48, 53}},
+    { 46,{ 48, 54}}, { 46,{ 48, 54}}, { 46,{ 48, 55}}, { 46,{ 48, 55}},
+    { 46,{ 48, 56}}, { 46,{ 48, 56}}, { 46,{ 48, 57}}, { 46,{ 48, 57}},
+    { 46,{ 48, 61}}, { 46,{ 48, 61}}, { 46,{ 48, 65}}, { 46,{ 48, 65}},
+    { 46,{ 48, 95}}, { 46,{ 48, 95}}, { 46,{ 48, 98}}, { 46,{ 48, 98}},
+    { 46,{ 48,100}}, { 46,{ 48,100}}, { 46,{ 48,102}}, { 46,{ 48,102}},
+    { 46,{ 48,103}}, { 46,{ 48,103}}, { 46,{ 48,104}}, { 46,{ 48,104}},
+    { 46,{ 48,108}}, { 46,{ 48,108}}, { 46,{ 48,109}}, { 46,{ 48,109}},
+    { 46,{ 48,110}}, { 46,{ 48,110}}, { 46,{ 48,112}}, { 46,{ 48,112}},
+    { 46,{ 48,114}}, { 46,{ 48,114}}, { 46,{ 48,117}}, { 46,{ 48,117}},
+    { 50,{ 48, 58}}, { 50,{ 48, 66}}, { 50,{ 48, 67}}, { 50,{ 48, 68}},
+    { 50,{ 48, 69}}, { 50,{ 48, 70}}, { 50,{ 48, 71}}, { 50,{ 48, 72}},
+    { 50,{ 48, 73}}, { 50,{ 48, 74}}, { 50,{ 48, 75}}, { 50,{ 48, 76}},
+    { 50,{ 48, 77}}, { 50,{ 48, 78}}, { 50,{ 48, 79}}, { 50,{ 48, 80}},
+    { 50,{ 48, 81}}, { 50,{ 48, 82}}, { 50,{ 48, 83}}, { 50,{ 48, 84}},
+    { 50,{ 48, 85}}, { 50,{ 48, 86}}, { 50,{ 48, 87}}, { 50,{ 48, 89}},
+    { 50,{ 48,106}}, { 50,{ 48,107}}, { 50,{ 48,113}}, { 50,{ 48,118}},
+    { 50,{ 48,119}}, { 50,{ 48,120}}, { 50,{ 48,121}}, { 50,{ 48,122}},
+    { 21,{ 48,  0}}, { 21,{ 48,  0}}, { 21,{ 48,  0}}, { 21,{ 48,  0}},
+    { 42,{ 49, 48}}, { 42,{ 49, 48}}, { 42,{ 49, 48}}, { 42,{ 49, 48}},
+    { 42,{ 49, 49}}, { 42,{ 49, 49}}, { 42,{ 49, 49}}, { 42,{ 49, 49}},
+    { 42,{ 49, 50}}, { 42,{ 49, 50}}, { 42,{ 49, 50}}, { 42,{ 49, 50}},
+    { 42,{ 49, 97}}, { 42,{ 49, 97}}, { 42,{ 49, 97}}, { 42,{ 49, 97}},
+    { 42,{ 49, 99}}, { 42,{ 49, 99}}, { 42,{ 49, 99}}, { 42,{ 49, 99}},
+    { 42,{ 49,101}}, { 42,{ 49,101}}, { 42,{ 49,101}}, { 42,{ 49,101}},
+    { 42,{ 49,105}}, { 42,{ 49,105}}, { 42,{ 49,105}}, { 42,{ 49,105}},
+    { 42,{ 49,111}}, { 42,{ 49,111}}, { 42,{ 49,111}}, { 42,{ 49,111}},
+    { 42,{ 49,115}}, { 42,{ 49,115}}, { 42,{ 49,115}}, { 42,{ 49,115}},
+    { 42,{ 49,116}}, { 42,{ 49,116}}, { 42,{ 49,116}}, { 42,{ 49,116}},
+    { 46,{ 49, 32}}, { 46,{ 49, 32}}, { 46,{ 49, 37}}, { 46,{ 49, 37}},
+    { 46,{ 49, 45}}, { 46,{ 49, 45}}, { 46,{ 49, 46}}, { 46,{ 49, 46}},
+    { 46,{ 49, 47}}, { 46,{ 49, 47}}, { 46,{ 49, 51}}, { 46,{ 49, 51}},
+    { 46,{ 49, 52}}, { 46,{ 49, 52}}, { 46,{ 49, 53}}, { 46,{ 49, 53}},
+    { 46,{ 49, 54}}, { 46,{ 49, 54}}, { 46,{ 49, 55}}, { 46,{ 49, 55}},
+    { 46,{ 49, 56}}, { 46,{ 49, 56}}, { 46,{ 49, 57}}, { 46,{ 49, 57}},
+    { 46,{ 49, 61}}, { 46,{ 49, 61}}, { 46,{ 49, 65}}, { 46,{ 49, 65}},
+    { 46,{ 49, 95}}, { 46,{ 49, 95}}, { 46,{ 49, 98}}, { 46,{ 49, 98}},
+    { 46,{ 49,100}}, { 46,{ 49,100}}, { 46,{ 49,102}}, { 46,{ 49,102}},
+    { 46,{ 49,103}}, { 46,{ 49,103}}, { 46,{ 49,104}}, { 46,{ 49,104}},
+    { 46,{ 49,108}}, { 46,{ 49,108}}, { 46,{ 49,109}}, { 46,{ 49,109}},
+    { 46,{ 49,110}}, { 46,{ 49,110}}, { 46,{ 49,112}}, { 46,{ 49,112}},
+    { 46,{ 49,114}}, { 46,{ 49,114}}, { 46,{ 49,117}}, { 46,{ 49,117}},
+    { 50,{ 49, 58}}, { 50,{ 49, 66}}, { 50,{ 49, 67}}, { 50,{ 49, 68}},
+    { 50,{ 49, 69}}, { 50,{ 49, 70}}, { 50,{ 49, 71}}, { 50,{ 49, 72}},
+    { 50,{ 49, 73}}, { 50,{ 49, 74}}, { 50,{ 49, 75}}, { 50,{ 49, 76}},
+    { 50,{ 49, 77}}, { 50,{ 49, 78}}, { 50,{ 49, 79}}, { 50,{ 49, 80}},
+    { 50,{ 49, 81}}, { 50,{ 49, 82}}, { 50,{ 49, 83}}, { 50,{ 49, 84}},
+    { 50,{ 49, 85}}, { 50,{ 49, 86}}, { 50,{ 49, 87}}, { 50,{ 49, 89}},
+    { 50,{ 49,106}}, { 50,{ 49,107}}, { 50,{ 49,113}}, { 50,{ 49,118}},
+    { 50,{ 49,119}}, { 50,{ 49,120}}, { 50,{ 49,121}}, { 50,{ 49,122}},
+    { 21,{ 49,  0}}, { 21,{ 49,  0}}, { 21,{ 49,  0}}, { 21,{ 49,  0}},
+    { 42,{ 50, 48}}, { 42,{ 50, 48}}, { 42,{ 50, 48}}, { 42,{ 50, 48}},
+    { 42,{ 50, 49}}, { 42,{ 50, 49}}, { 42,{ 50, 49}}, { 42,{ 50, 49}},
+    { 42,{ 50, 50}}, { 42,{ 50, 50}}, { 42,{ 50, 50}}, { 42,{ 50, 50}},
+    { 42,{ 50, 97}}, { 42,{ 50, 97}}, { 42,{ 50, 97}}, { 42,{ 50, 97}},
+    { 42,{ 50, 99}}, { 42,{ 50, 99}}, { 42,{ 50, 99}}, { 42,{ 50, 99}},
+    { 42,{ 50,101}}, { 42,{ 50,101}}, { 42,{ 50,101}}, { 42,{ 50,101}},
+    { 42,{ 50,105}}, { 42,{ 50,105}}, { 42,{ 50,105}}, { 42,{ 50,105}},
+    { 42,{ 50,111}}, { 42,{ 50,111}}, { 42,{ 50,111}}, { 42,{ 50,111}},
+    { 42,{ 50,115}}, { 42,{ 50,115}}, { 42,{ 50,115}}, { 42,{ 50,115}},
+    { 42,{ 50,116}}, { 42,{ 50,116}}, { 42,{ 50,116}}, { 42,{ 50,116}},
+    { 46,{ 50, 32}}, { 46,{ 50, 32}}, { 46,{ 50, 37}}, { 46,{ 50, 37}},
+    { 46,{ 50, 45}}, { 46,{ 50, 45}}, { 46,{ 50, 46}}, { 46,{ 50, 46}},
+    { 46,{ 50, 47}}, { 46,{ 50, 47}}, { 46,{ 50, 51}}, { 46,{ 50, 51}},
+    { 46,{ 50, 52}}, { 46,{ 50, 52}}, { 46,{ 50, 53}}, { 46,{ 50, 53}},
+    { 46,{ 50, 54}}, { 46,{ 50, 54}}, { 46,{ 50, 55}}, { 46,{ 50, 55}},
+    { 46,{ 50, 56}}, { 46,{ 50, 56}}, { 46,{ 50, 57}}, { 46,{ 50, 57}},
+    { 46,{ 50, 61}}, { 46,{ 50, 61}}, { 46,{ 50, 65}}, { 46,{ 50, 65}},
+    { 46,{ 50, 95}}, { 46,{ 50, 95}}, { 46,{ 50, 98}}, { 46,{ 50, 98}},
+    { 46,{ 50,100}}, { 46,{ 50,100}}, { 46,{ 50,102}}, { 46,{ 50,102}},
+    { 46,{ 50,103}}, { 46,{ 50,103}}, { 46,{ 50,104}}, { 46,{ 50,104}},
+    { 46,{ 50,108}}, { 46,{ 50,108}}, { 46,{ 50,109}}, { 46,{ 50,109}},
+    { 46,{ 50,110}}, { 46,{ 50,110}}, { 46,{ 50,112}}, { 46,{ 50,112}},
+    { 46,{ 50,114}}, { 46,{ 50,114}}, { 46,{ 50,117}}, { 46,{ 50,117}},
+    { 50,{ 50, 58}}, { 50,{ 50, 66}}, { 50,{ 50, 67}}, { 50,{ 50, 68}},
+    { 50,{ 50, 69}}, { 50,{ 50, 70}}, { 50,{ 50, 71}}, { 50,{ 50, 72}},
+    { 50,{ 50, 73}}, { 50,{ 50, 74}}, { 50,{ 50, 75}}, { 50,{ 50, 76}},
+    { 50,{ 50, 77}}, { 50,{ 50, 78}}, { 50,{ 50, 79}}, { 50,{ 50, 80}},
+    { 50,{ 50, 81}}, { 50,{ 50, 82}}, { 50,{ 50, 83}}, { 50,{ 50, 84}},
+    { 50,{ 50, 85}}, { 50,{ 50, 86}}, { 50,{ 50, 87}}, { 50,{ 50, 89}},
+    { 50,{ 50,106}}, { 50,{ 50,107}}, { 50,{ 50,113}}, { 50,{ 50,118}},
+    { 50,{ 50,119}}, { 50,{ 50,120}}, { 50,{ 50,121}}, { 50,{ 50,122}},
+    { 21,{ 50,  0}}, { 21,{ 50,  0}}, { 21,{ 50,  0}}, { 21,{ 50,  0}},
+    { 42,{ 97, 48}}, { 42,{ 97, 48}}, { 42,{ 97, 48}}, { 42,{ 97, 48}},
+    { 42,{ 97, 49}}, { 42,{ 97, 49}}, { 42,{ 97, 49}}, { 42,{ 97, 49}},
+    { 42,{ 97, 50}}, { 42,{ 97, 50}}, { 42,{ 97, 50}}, { 42,{ 97, 50}},
+    { 42,{ 97, 97}}, { 42,{ 97, 97}}, { 42,{ 97, 97}}, { 42,{ 97, 97}},
+    { 42,{ 97, 99}}, { 42,{ 97, 99}}, { 42,{ 97, 99}}, { 42,{ 97, 99}},
+    { 42,{ 97,101}}, { 42,{ 97,101}}, { 42,{ 97,101}}, { 42,{ 97,101}},
+    { 42,{ 97,105}}, { 42,{ 97,105}}, { 42,{ 97,105}}, { 42,{ 97,105}},
+    { 42,{ 97,111}}, { 42,{ 97,111}}, { 42,{ 97,111}}, { 42,{ 97,111}},
+    { 42,{ 97,115}}, { 42,{ 97,115}}, { 42,{ 97,115}}, { 42,{ 97,115}},
+    { 42,{ 97,116}}, { 42,{ 97,116}}, { 42,{ 97,116}}, { 42,{ 97,116}},
+    { 46,{ 97, 32}}, { 46,{ 97, 32}}, { 46,{ 97, 37}}, { 46,{ 97, 37}},
+    { 46,{ 97, 45}}, { 46,{ 97, 45}}, { 46,{ 97, 46}}, { 46,{ 97, 46}},
+    { 46,{ 97, 47}}, { 46,{ 97, 47}}, { 46,{ 97, 51}}, { 46,{ 97, 51}},
+    { 46,{ 97, 52}}, { 46,{ 97, 52}}, { 46,{ 97, 53}}, { 46,{ 97, 53}},
+    { 46,{ 97, 54}}, { 46,{ 97, 54}}, { 46,{ 97, 55}}, { 46,{ 97, 55}},
+    { 46,{ 97, 56}}, { 46,{ 97, 56}}, { 46,{ 97, 57}}, { 46,{ 97, 57}},
+    { 46,{ 97, 61}}, { 46,{ 97, 61}}, { 46,{ 97, 65}}, { 46,{ 97, 65}},
+    { 46,{ 97, 95}}, { 46,{ 97, 95}}, { 46,{ 97, 98}}, { 46,{ 97, 98}},
+    { 46,{ 97,100}}, { 46,{ 97,100}}, { 46,{ 97,102}}, { 46,{ 97,102}},
+    { 46,{ 97,103}}, { 46,{ 97,103}}, { 46,{ 97,104}}, { 46,{ 97,104}},
+    { 46,{ 97,108}}, { 46,{ 97,108}}, { 46,{ 97,109}}, { 46,{ 97,109}},
+    { 46,{ 97,110}}, { 46,{ 97,110}}, { 46,{ 97,112}}, { 46,{ 97,112}},
+    { 46,{ 97,114}}, { 46,{ 97,114}}, { 46,{ 97,117}}, { 46,{ 97,117}},
+    { 50,{ 97, 58}}, { 50,{ 97, 66}}, { 50,{ 97, 67}}, { 50,{ 97, 68}},
+    { 50,{ 97, 69}}, { 50,{ 97, 70}}, { 50,{ 97, 71}}, { 50,{ 97, 72}},
+    { 50,{ 97, 73}}, { 50,{ 97, 74}}, { 50,{ 97, 75}}, { 50,{ 97, 76}},
+    { 50,{ 97, 77}}, { 50,{ 97, 78}}, { 50,{ 97, 79}}, { 50,{ 97, 80}},
+    { 50,{ 97, 81}}, { 50,{ 97, 82}}, { 50,{ 97, 83}}, { 50,{ 97, 84}},
+    { 50,{ 97, 85}}, { 50,{ 97, 86}}, { 50,{ 97, 87}}, { 50,{ 97, 89}},
+    { 50,{ 97,106}}, { 50,{ 97,107}}, { 50,{ 97,113}}, { 50,{ 97,118}},
+    { 50,{ 97,119}}, { 50,{ 97,120}}, { 50,{ 97,121}}, { 50,{ 97,122}},
+    { 21,{ 97,  0}}, { 21,{ 97,  0}}, { 21,{ 97,  0}}, { 21,{ 97,  0}},
+    { 42,{ 99, 48}}, { 42,{ 99, 48}}, { 42,{ 99, 48}}, { 42,{ 99, 48}},
+    { 42,{ 99, 49}}, { 42,{ 99, 49}}, { 42,{ 99, 49}}, { 42,{ 99, 49}},
+    { 42,{ 99, 50}}, { 42,{ 99, 50}}, { 42,{ 99, 50}}, { 42,{ 99, 50}},
+    { 42,{ 99, 97}}, { 42,{ 99, 97}}, { 42,{ 99, 97}}, { 42,{ 99, 97}},
+    { 42,{ 99, 99}}, { 42,{ 99, 99}}, { 42,{ 99, 99}}, { 42,{ 99, 99}},
+    { 42,{ 99,101}}, { 42,{ 99,101}}, { 42,{ 99,101}}, { 42,{ 99,101}},
+    { 42,{ 99,105}}, { 42,{ 99,105}}, { 42,{ 99,105}}, { 42,{ 99,105}},
+    { 42,{ 99,111}}, { 42,{ 99,111}}, { 42,{ 99,111}}, { 42,{ 99,111}},
+    { 42,{ 99,115}}, { 42,{ 99,115}}, { 42,{ 99,115}}, { 42,{ 99,115}},
+    { 42,{ 99,116}}, { 42,{ 99,116}}, { 42,{ 99,116}}, { 42,{ 99,116}},
+    { 46,{ 99, 32}}, { 46,{ 99, 32}}, { 46,{ 99, 37}}, { 46,{ 99, 37}},
+    { 46,{ 99, 45}}, { 46,{ 99, 45}}, { 46,{ 99, 46}}, { 46,{ 99, 46}},
+    { 46,{ 99, 47}}, { 46,{ 99, 47}}, { 46,{ 99, 51}}, { 46,{ 99, 51}},
+    { 46,{ 99, 52}}, { 46,{ 99, 52}}, { 46,{ 99, 53}}, { 46,{ 99, 53}},
+    { 46,{ 99, 54}}, { 46,{ 99, 54}}, { 46,{ 99, 55}}, { 46,{ 99, 55}},
+    { 46,{ 99, 56}}, { 46,{ 99, 56}}, { 46,{ 99, 57}}, { 46,{ 99, 57}},
+    { 46,{ 99, 61}}, { 46,{ 99, 61}}, { 46,{ 99, 65}}, { 46,{ 99, 65}},
+    { 46,{ 99, 95}}, { 46,{ 99, 95}}, { 46,{ 99, 98}}, { 46,{ 99, 98}},
+    { 46,{ 99,100}}, { 46,{ 99,100}}, { 46,{ 99,102}}, { 46,{ 99,102}},
+    { 46,{ 99,103}}, { 46,{ 99,103}}, { 46,{ 99,104}}, { 46,{ 99,104}},
+    { 46,{ 99,108}}, { 46,{ 99,108}}, { 46,{ 99,109}}, { 46,{ 99,109}},
+    { 46,{ 99,110}}, { 46,{ 99,110}}, { 46,{ 99,112}}, { 46,{ 99,112}},
+    { 46,{ 99,114}}, { 46,{ 99,114}}, { 46,{ 99,117}}, { 46,{ 99,117}},
+    { 50,{ 99, 58}}, { 50,{ 99, 66}}, { 50,{ 99, 67}}, { 50,{ 99, 68}},
+    { 50,{ 99, 69}}, { 50,{ 99, 70}}, { 50,{ 99, 71}}, { 50,{ 99, 72}},
+    { 50,{ 99, 73}}, { 50,{ 99, 74}}, { 50,{ 99, 75}}, { 50,{ 99, 76}},
+    { 50,{ 99, 77}}, { 50,{ 99, 78}}, { 50,{ 99, 79}}, { 50,{ 99, 80}},
+    { 50,{ 99, 81}}, { 50,{ 99, 82}}, { 50,{ 99, 83}}, { 50,{ 99, 84}},
+    { 50,{ 99, 85}}, { 50,{ 99, 86}}, { 50,{ 99, 87}}, { 50,{ 99, 89}},
+    { 50,{ 99,106}}, { 50,{ 99,107}}, { 50,{ 99,113}}, { 50,{ 99,118}},
+    { 50,{ 99,119}}, { 50,{ 99,120}}, { 50,{ 99,121}}, { 50,{ 99,122}},
+    { 21,{ 99,  0}}, { 21,{ 99,  0}}, { 21,{ 99,  0}}, { 21,{ 99,  0}},
+    { 42,{101, 48}}, { 42,{101, 48}}, { 42,{101, 48}}, { 42,{101, 48}},
+    { 42,{101, 49}}, { 42,{101, 49}}, { 42,{101, 49}}, { 42,{101, 49}},
+    { 42,{101, 50}}, { 42,{101, 50}}, { 42,{101, 50}}, { 42,{101, 50}},
+    { 42,{101, 97}}, { 42,{101, 97}}, { 42,{101, 97}}, { 42,{101, 97}},
+    { 42,{101, 99}}, { 42,{101, 99}}, { 42,{101, 99}}, { 42,{101, 99}},
+    { 42,{101,101}}, { 42,{101,101}}, { 42,{101,101}}, { 42,{101,101}},
+    { 42,{101,105}}, { 42,{101,105}}, { 42,{101,105}}, { 42,{101,105}},
+    { 42,{101,111}}, { 42,{101,111}}, { 42,{101,111}}, { 42,{101,111}},
+    { 42,{101,115}}, { 42,{101,115}}, { 42,{101,115}}, { 42,{101,115}},
+    { 42,{101,116}}, { 42,{101,116}}, { 42,{101,116}}, { 42,{101,116}},
+    { 46,{101, 32}}, { 46,{101, 32}}, { 46,{101, 37}}, { 46,{101, 37}},
+    { 46,{101, 45}}, { 46,{101, 45}}, { 46,{101, 46}}, { 46,{101, 46}},
+    { 46,{101, 47}}, { 46,{101, 47}}, { 46,{101, 51}}, { 46,{101, 51}},
+    { 46,{101, 52}}, { 46,{101, 52}}, { 46,{101, 53}}, { 46,{101, 53}},
+    { 46,{101, 54}}, { 46,{101, 54}}, { 46,{101, 55}}, { 46,{101, 55}},
+    { 46,{101, 56}}, { 46,{101, 56}}, { 46,{101, 57}}, { 46,{101, 57}},
+    { 46,{101, 61}}, { 46,{101, 61}}, { 46,{101, 65}}, { 46,{101, 65}},
+    { 46,{101, 95}}, { 46,{101, 95}}, { 46,{101, 98}}, { 46,{101, 98}},
+    { 46,{101,100}}, { 46,{101,100}}, { 46,{101,102}}, { 46,{101,102}},
+    { 46,{101,103}}, { 46,{101,103}}, { 46,{101,104}}, { 46,{101,104}},
+    { 46,{101,108}}, { 46,{101,108}}, { 46,{101,109}}, { 46,{101,109}},
+    { 46,{101,110}}, { 46,{101,110}}, { 46,{101,112}}, { 46,{101,112}},
+    { 46,{101,114}}, { 46,{101,114}}, { 46,{101,117}}, { 46,{101,117}},
+    { 50,{101, 58}}, { 50,{101, 66}}, { 50,{101, 67}}, { 50,{101, 68}},
+    { 50,{101, 69}}, { 50,{101, 70}}, { 50,{101, 71}}, { 50,{101, 72}},
+    { 50,{101, 73}}, { 50,{101, 74}}, { 50,{101, 75}}, { 50,{101, 76}},
+    { 50,{101, 77}}, { 50,{101, 78}}, { 50,{101, 79}}, { 50,{101, 80}},
+    { 50,{101, 81}}, { 50,{101, 82}}, { 50,{101, 83}}, { 50,{101, 84}},
+    { 50,{101, 85}}, { 50,{101, 86}}, { 50,{101, 87}}, { 50,{101, 89}},
+    { 50,{101,106}}, { 50,{101,107}}, { 50,{101,113}}, { 50,{101,118}},
+    { 50,{101,119}}, { 50,{101,120}}, { 50,{101,121}}, { 50,{101,122}},
+    { 21,{101,  0}}, { 21,{101,  0}}, { 21,{101,  0}}, { 21,{101,  0}},
+    { 42,{105, 48}}, { 42,{105, 48}}, { 42,{105, 48}}, { 42,{105, 48}},
+    { 42,{105, 49}}, { 42,{105, 49}}, { 42,{105, 49}}, { 42,{105, 49}},
+    { 42,{105, 50}}, { 42,{105, 50}}, { 42,{105, 50}}, { 42,{105, 50}},
+    { 42,{105, 97}}, { 42,{105, 97}}, { 42,{105, 97}}, { 42,{105, 97}},
+    { 42,{105, 99}}, { 42,{105, 99}}, { 42,{105, 99}}, { 42,{105, 99}},
+    { 42,{105,101}}, { 42,{105,101}}, { 42,{105,101}}, { 42,{105,101}},
+    { 42,{105,105}}, { 42,{105,105}}, { 42,{105,105}}, { 42,{105,105}},
+    { 42,{105,111}}, { 42,{105,111}}, { 42,{105,111}}, { 42,{105,111}},
+    { 42,{105,115}}, { 42,{105,115}}, { 42,{105,115}}, { 42,{105,115}},
+    { 42,{105,116}}, { 42,{105,116}}, { 42,{105,116}}, { 42,{105,116}},
+    { 46,{105, 32}}, { 46,{105, 32}}, { 46,{105, 37}}, { 46,{105, 37}},
+    { 46,{105, 45}}, { 46,{105, 45}}, { 46,{105, 46}}, { 46,{105, 46}},
+    { 46,{105, 47}}, { 46,{105, 47}}, { 46,{105, 51}}, { 46,{105, 51}},
+    { 46,{105, 52}}, { 46,{105, 52}}, { 46,{105, 53}}, { 46,{105, 53}},
+    { 46,{105, 54}}, { 46,{105, 54}}, { 46,{105, 55}}, { 46,{105, 55}},
+    { 46,{105, 56}}, { 46,{105, 56}}, { 46,{105, 57}}, { 46,{105, 57}},
+    { 46,{105, 61}}, { 46,{105, 61}}, { 46,{105, 65}}, { 46,{105, 65}},
+    { 46,{105, 95}}, { 46,{105, 95}}, { 46,{105, 98}}, { 46,{105, 98}},
+    { 46,{105,100}}, { 46,{105,100}}, { 46,{105,102}}, { 46,{105,102}},
+    { 46,{105,103}}, { 46,{105,103}}, { 46,{105,104}}, { 46,{105,104}},
+    { 46,{105,108}}, { 46,{105,108}}, { 46,{105,109}}, { 46,{105,109}},
+    { 46,{105,110}}, { 46,{105,110}}, { 46,{105,112}}, { 46,{105,112}},
+    { 46,{105,114}}, { 46,{105,114}}, { 46,{105,117}}, { 46,{105,117}},
+    { 50,{105, 58}}, { 50,{105, 66}}, { 50,{105, 67}}, { 50,{105, 68}},
+    { 50,{105, 69}}, { 50,{105, 70}}, { 50,{105, 71}}, { 50,{105, 72}},
+    { 50,{105, 73}}, { 50,{105, 74}}, { 50,{105, 75}}, { 50,{105, 76}},
+    { 50,{105, 77}}, { 50,{105, 78}}, { 50,{105, 79}}, { 50,{105, 80}},
+    { 50,{105, 81}}, { 50,{105, 82}}, { 50,{105, 83}}, { 50,{105, 84}},
+    { 50,{105, 85}}, { 50,{105, 86}}, { 50,{105, 87}}, { 50,{105, 89}},
+    { 50,{105,106}}, { 50,{105,107}}, { 50,{105,113}}, { 50,{105,118}},
+    { 50,{105,119}}, { 50,{105,120}}, { 50,{105,121}}, { 50,{105,122}},
+    { 21,{105,  0}}, { 21,{105,  0}}, { 21,{105,  0}}, { 21,{105,  0}},
+    { 42,{111, 48}}, { 42,{111, 48}}, { 42,{111, 48}}, { 42,{111, 48}},
+    { 42,{111, 49}}, { 42,{111, 49}}, { 42,{111, 49}}, { 42,{111, 49}},
+    { 42,{111, 50}}, { 42,{111, 50}}, { 42,{111, 50}}, { 42,{111, 50}},
+    { 42,{111, 97}}, { 42,{111, 97}}, { 42,{111, 97}}, { 42,{111, 97}},
+    { 42,{111, 99}}, { 42,{111, 99}}, { 42,{111, 99}}, { 42,{111, 99}},
+    { 42,{111,101}}, { 42,{111,101}}, { 42,{111,101}}, { 42,{111,101}},
+    { 42,{111,105}}, { 42,{111,105}}, { 42,{111,105}}, { 42,{111,105}},
+    { 42,{111,111}}, { 42,{111,111}}, { 42,{111,111}}, { 42,{111,111}},
+    { 42,{111,115}}, { 42,{111,115}}, { 42,{111,115}}, { 42,{111,115}},
+    { 42,{111,116}}, { 42,{111,116}}, { 42,{111,116}}, { 42,{111,116}},
+    { 46,{111, 32}}, { 46,{111, 32}}, { 46,{111, 37}}, { 46,{111, 37}},
+    { 46,{111, 45}}, { 46,{111, 45}}, { 46,{111, 46}}, { 46,{111, 46}},
+    { 46,{111, 47}}, { 46,{111, 47}}, { 46,{111, 51}}, { 46,{111, 51}},
+    { 46,{111, 52}}, { 46,{111, 52}}, { 46,{111, 53}}, { 46,{111, 53}},
+    { 46,{111, 54}}, { 46,{111, 54}}, { 46,{111, 55}}, { 46,{111, 55}},
+    { 46,{111, 56}}, { 46,{111, 56}}, { 46,{111, 57}}, { 46,{111, 57}},
+    { 46,{111, 61}}, { 46,{111, 61}}, { 46,{111, 65}}, { 46,{111, 65}},
+    { 46,{111, 95}}, { 46,{111, 95}}, { 46,{111, 98}}, { 46,{111, 98}},
+    { 46,{111,100}}, { 46,{111,100}}, { 46,{111,102}}, { 46,{111,102}},
+    { 46,{111,103}}, { 46,{111,103}}, { 46,{111,104}}, { 46,{111,104}},
+    { 46,{111,108}}, { 46,{111,108}}, { 46,{111,109}}, { 46,{111,109}},
+    { 46,{111,110}}, { 46,{111,110}}, { 46,{111,112}}, { 46,{111,112}},
+    { 46,{111,114}}, { 46,{111,114}}, { 46,{111,117}}, { 46,{111,117}},
+    { 50,{111, 58}}, { 50,{111, 66}}, { 50,{111, 67}}, { 50,{111, 68}},
+    { 50,{111, 69}}, { 50,{111, 70}}, { 50,{111, 71}}, { 50,{111, 72}},
+    { 50,{111, 73}}, { 50,{111, 74}}, { 50,{111, 75}}, { 50,{111, 76}},
+    { 50,{111, 77}}, { 50,{111, 78}}, { 50,{111, 79}}, { 50,{111, 80}},
+    { 50,{111, 81}}, { 50,{111, 82}}, { 50,{111, 83}}, { 50,{111, 84}},
+    { 50,{111, 85}}, { 50,{111, 86}}, { 50,{111, 87}}, { 50,{111, 89}},
+    { 50,{111,106}}, { 50,{111,107}}, { 50,{111,113}}, { 50,{111,118}},
+    { 50,{111,119}}, { 50,{111,120}}, { 50,{111,121}}, { 50,{111,122}},
+    { 21,{111,  0}}, { 21,{111,  0}}, { 21,{111,  0}}, { 21,{111,  0}},
+    { 42,{115, 48}}, { 42,{115, 48}}, { 42,{115, 48}}, { 42,{115, 48}},
+    { 42,{115, 49}}, { 42,{115, 49}}, { 42,{115, 49}}, { 42,{115, 49}},
+    { 42,{115, 50}}, { 42,{115, 50}}, { 42,{115, 50}}, { 42,{115, 50}},
+    { 42,{115, 97}}, { 42,{115, 97}}, { 42,{115, 97}}, { 42,{115, 97}},
+    { 42,{115, 99}}, { 42,{115, 99}}, { 42,{115, 99}}, { 42,{115, 99}},
+    { 42,{115,101}}, { 42,{115,101}}, { 42,{115,101}}, { 42,{115,101}},
+    { 42,{115,105}}, { 42,{115,105}}, { 42,{115,105}}, { 42,{115,105}},
+    { 42,{115,111}}, { 42,{115,111}}, { 42,{115,111}}, { 42,{115,111}},
+    { 42,{115,115}}, { 42,{115,115}}, { 42,{115,115}}, { 42,{115,115}},
+    { 42,{115,116}}, { 42,{115,116}}, { 42,{115,116}}, { 42,{115,116}},
+    { 46,{115, 32}}, { 46,{115, 32}}, { 46,{115, 37}}, { 46,{115, 37}},
+    { 46,{115, 45}}, { 46,{115, 45}}, { 46,{115, 46}}, { 46,{115, 46}},
+    { 46,{115, 47}}, { 46,{115, 47}}, { 46,{115, 51}}, { 46,{115, 51}},
+    { 46,{115, 52}}, { 46,{115, 52}}, { 46,{115, 53}}, { 46,{115, 53}},
+    { 46,{115, 54}}, { 46,{115, 54}}, { 46,{115, 55}}, { 46,{115, 55}},
+    { 46,{115, 56}}, { 46,{115, 56}}, { 46,{115, 57}}, { 46,{115, 57}},
+    { 46,{115, 61}}, { 46,{115, 61}}, { 46,{115, 65}}, { 46,{115, 65}},
+    { 46,{115, 95}}, { 46,{115, 95}}, { 46,{115, 98}}, { 46,{115, 98}},
+    { 46,{115,100}}, { 46,{115,100}}, { 46,{115,102}}, { 46,{115,102}},
+    { 46,{115,103}}, { 46,{115,103}}, { 46,{115,104}}, { 46,{115,104}},
+    { 46,{115,108}}, { 46,{115,108}}, { 46,{115,109}}, { 46,{115,109}},
+    { 46,{115,110}}, { 46,{115,110}}, { 46,{115,112}}, { 46,{115,112}},
+    { 46,{115,114}}, { 46,{115,114}}, { 46,{115,117}}, { 46,{115,117}},
+    { 50,{115, 58}}, { 50,{115, 66}}, { 50,{115, 67}}, { 50,{115, 68}},
+    { 50,{115, 69}}, { 50,{115, 70}}, { 50,{115, 71}}, { 50,{115, 72}},
+    { 50,{115, 73}}, { 50,{115, 74}}, { 50,{115, 75}}, { 50,{115, 76}},
+    { 50,{115, 77}}, { 50,{115, 78}}, { 50,{115, 79}}, { 50,{115, 80}},
+    { 50,{115, 81}}, { 50,{115, 82}}, { 50,{115, 83}}, { 50,{115, 84}},
+    { 50,{115, 85}}, { 50,{115, 86}}, { 50,{115, 87}}, { 50,{115, 89}},
+    { 50,{115,106}}, { 50,{115,107}}, { 50,{115,113}}, { 50,{115,118}},
+    { 50,{115,119}}, { 50,{115,120}}, { 50,{115,121}}, { 50,{115,122}},
+    { 21,{115,  0}}, { 21,{115,  0}}, { 21,{115,  0}}, { 21,{115,  0}},
+    { 42,{116, 48}}, { 42,{116, 48}}, { 42,{116, 48}}, { 42,{116, 48}},
+    { 42,{116, 49}}, { 42,{116, 49}}, { 42,{116, 49}}, { 42,{116, 49}},
+    { 42,{116, 50}}, { 42,{116, 50}}, { 42,{116, 50}}, { 42,{116, 50}},
+    { 42,{116, 97}}, { 42,{116, 97}}, { 42,{116, 97}}, { 42,{116, 97}},
+    { 42,{116, 99}}, { 42,{116, 99}}, { 42,{116, 99}}, { 42,{116, 99}},
+    { 42,{116,101}}, { 42,{116,101}}, { 42,{116,101}}, { 42,{116,101}},
+    { 42,{116,105}}, { 42,{116,105}}, { 42,{116,105}}, { 42,{116,105}},
+    { 42,{116,111}}, { 42,{116,111}}, { 42,{116,111}}, { 42,{116,111}},
+    { 42,{116,115}}, { 42,{116,115}}, { 42,{116,115}}, { 42,{116,115}},
+    { 42,{116,116}}, { 42,{116,116}}, { 42,{116,116}}, { 42,{116,116}},
+    { 46,{116, 32}}, { 46,{116, 32}}, { 46,{116, 37}}, { 46,{116, 37}},
+    { 46,{116, 45}}, { 46,{116, 45}}, { 46,{116, 46}}, { 46,{116, 46}},
+    { 46,{116, 47}}, { 46,{116, 47}}, { 46,{116, 51}}, { 46,{116, 51}},
+    { 46,{116, 52}}, { 46,{116, 52}}, { 46,{116, 53}}, { 46,{116, 53}},
+    { 46,{116, 54}}, { 46,{116, 54}}, { 46,{116, 55}}, { 46,{116, 55}},
+    { 46,{116, 56}}, { 46,{116, 56}}, { 46,{116, 57}}, { 46,{116, 57}},
+    { 46,{116, 61}}, { 46,{116, 61}}, { 46,{116, 65}}, { 46,{116, 65}},
+    { 46,{116, 95}}, { 46,{116, 95}}, { 46,{116, 98}}, { 46,{116, 98}},
+    { 46,{116,100}}, { 46,{116,100}}, { 46,{116,102}}, { 46,{116,102}},
+    { 46,{116,103}}, { 46,{116,103}}, { 46,{116,104}}, { 46,{116,104}},
+    { 46,{116,108}}, { 46,{116,108}}, { 46,{116,109}}, { 46,{116,109}},
+    { 46,{116,110}}, { 46,{116,110}}, { 46,{116,112}}, { 46,{116,112}},
+    { 46,{116,114}}, { 46,{116,114}}, { 46,{116,117}}, { 46,{116,117}},
+    { 50,{116, 58}}, { 50,{116, 66}}, { 50,{116, 67}}, { 50,{116, 68}},
+    { 50,{116, 69}}, { 50,{116, 70}}, { 50,{116, 71}}, { 50,{116, 72}},
+    { 50,{116, 73}}, { 50,{116, 74}}, { 50,{116, 75}}, { 50,{116, 76}},
+    { 50,{116, 77}}, { 50,{116, 78}}, { 50,{116, 79}}, { 50,{116, 80}},
+    { 50,{116, 81}}, { 50,{116, 82}}, { 50,{116, 83}}, { 50,{116, 84}},
+    { 50,{116, 85}}, { 50,{116, 86}}, { 50,{116, 87}}, { 50,{116, 89}},
+    { 50,{116,106}}, { 50,{116,107}}, { 50,{116,113}}, { 50,{116,118}},
+    { 50,{116,119}}, { 50,{116,120}}, { 50,{116,121}}, { 50,{116,122}},
+    { 21,{116,  0}}, { 21,{116,  0}}, { 21,{116,  0}}, { 21,{116,  0}},
+    { 46,{ 32, 48}}, { 46,{ 32, 48}}, { 46,{ 32, 49}}, { 46,{ 32, 49}},
+    { 46,{ 32, 50}}, { 46,{ 32, 50}}, { 46,{ 32, 97}}, { 46,{ 32, 97}},
+    { 46,{ 32, 99}}, { 46,{ 32, 99}}, { 46,{ 32,101}}, { 46,{ 32,101}},
+    { 46,{ 32,105}}, { 46,{ 32,105}}, { 46,{ 32,111}}, { 46,{ 32,111}},
+    { 46,{ 32,115}}, { 46,{ 32,115}}, { 46,{ 32,116}}, { 46,{ 32,116}},
+    { 50,{ 32, 32}}, { 50,{ 32, 37}}, { 50,{ 32, 45}}, { 50,{ 32, 46}},
+    { 50,{ 32, 47}}, { 50,{ 32, 51}}, { 50,{ 32, 52}}, { 50,{ 32, 53}},
+    { 50,{ 32, 54}}, { 50,{ 32, 55}}, { 50,{ 32, 56}}, { 50,{ 32, 57}},
+    { 50,{ 32, 61}}, { 50,{ 32, 65}}, { 50,{ 32, 95}}, { 50,{ 32, 98}},
+    { 50,{ 32,100}}, { 50,{ 32,102}}, { 50,{ 32,103}}, { 50,{ 32,104}},
+    { 50,{ 32,108}}, { 50,{ 32,109}}, { 50,{ 32,110}}, { 50,{ 32,112}},
+    { 50,{ 32,114}}, { 50,{ 32,117}}, { 25,{ 32,  0}}, { 25,{ 32,  0}},
+    { 25,{ 32,  0}}, { 25,{ 32,  0}}, { 25,{ 32,  0}}, { 25,{ 32,  0}},
+    { 25,{ 32,  0}}, { 25,{ 32,  0}}, { 25,{ 32,  0}}, { 25,{ 32,  0}},
+    { 25,{ 32,  0}}, { 25,{ 32,  0}}, { 25,{ 32,  0}}, { 25,{ 32,  0}},
+    { 25,{ 32,  0}}, { 25,{ 32,  0}}, { 25,{ 32,  0}}, { 25,{ 32,  0}},
+    { 46,{ 37, 48}}, { 46,{ 37, 48}}, { 46,{ 37, 49}}, { 46,{ 37, 49}},
+    { 46,{ 37, 50}}, { 46,{ 37, 50}}, { 46,{ 37, 97}}, { 46,{ 37, 97}},
+    { 46,{ 37, 99}}, { 46,{ 37, 99}}, { 46,{ 37,101}}, { 46,{ 37,101}},
+    { 46,{ 37,105}}, { 46,{ 37,105}}, { 46,{ 37,111}}, { 46,{ 37,111}},
+    { 46,{ 37,115}}, { 46,{ 37,115}}, { 46,{ 37,116}}, { 46,{ 37,116}},
+    { 50,{ 37, 32}}, { 50,{ 37, 37}}, { 50,{ 37, 45}}, { 50,{ 37, 46}},
+    { 50,{ 37, 47}}, { 50,{ 37, 51}}, { 50,{ 37, 52}}, { 50,{ 37, 53}},
+    { 50,{ 37, 54}}, { 50,{ 37, 55}}, { 50,{ 37, 56}}, { 50,{ 37, 57}},
+    { 50,{ 37, 61}}, { 50,{ 37, 65}}, { 50,{ 37, 95}}, { 50,{ 37, 98}},
+    { 50,{ 37,100}}, { 50,{ 37,102}}, { 50,{ 37,103}}, { 50,{ 37,104}},
+    { 50,{ 37,108}}, { 50,{ 37,109}}, { 50,{ 37,110}}, { 50,{ 37,112}},
+    { 50,{ 37,114}}, { 50,{ 37,117}}, { 25,{ 37,  0}}, { 25,{ 37,  0}},
+    { 25,{ 37,  0}}, { 25,{ 37,  0}}, { 25,{ 37,  0}}, { 25,{ 37,  0}},
+    { 25,{ 37,  0}}, { 25,{ 37,  0}}, { 25,{ 37,  0}}, { 25,{ 37,  0}},
+    { 25,{ 37,  0}}, { 25,{ 37,  0}}, { 25,{ 37,  0}}, { 25,{ 37,  0}},
+    { 25,{ 37,  0}}, { 25,{ 37,  0}}, { 25,{ 37,  0}}, { 25,{ 37,  0}},
+    { 46,{ 45, 48}}, { 46,{ 45, 48}}, { 46,{ 45, 49}}, { 46,{ 45, 49}},
+    { 46,{ 45, 50}}, { 46,{ 45, 50}}, { 46,{ 45, 97}}, { 46,{ 45, 97}},
+    { 46,{ 45, 99}}, { 46,{ 45, 99}}, { 46,{ 45,101}}, { 46,{ 45,101}},
+    { 46,{ 45,105}}, { 46,{ 45,105}}, { 46,{ 45,111}}, { 46,{ 45,111}},
+    { 46,{ 45,115}}, { 46,{ 45,115}}, { 46,{ 45,116}}, { 46,{ 45,116}},
+    { 50,{ 45, 32}}, { 50,{ 45, 37}}, { 50,{ 45, 45}}, { 50,{ 45, 46}},
+    { 50,{ 45, 47}}, { 50,{ 45, 51}}, { 50,{ 45, 52}}, { 50,{ 45, 53}},
+    { 50,{ 45, 54}}, { 50,{ 45, 55}}, { 50,{ 45, 56}}, { 50,{ 45, 57}},
+    { 50,{ 45, 61}}, { 50,{ 45, 65}}, { 50,{ 45, 95}}, { 50,{ 45, 98}},
+    { 50,{ 45,100}}, { 50,{ 45,102}}, { 50,{ 45,103}}, { 50,{ 45,104}},
+    { 50,{ 45,108}}, { 50,{ 45,109}}, { 50,{ 45,110}}, { 50,{ 45,112}},
+    { 50,{ 45,114}}, { 50,{ 45,117}}, { 25,{ 45,  0}}, { 25,{ 45,  0}},
+    { 25,{ 45,  0}}, { 25,{ 45,  0}}, { 25,{ 45,  0}}, { 25,{ 45,  0}},
+    { 25,{ 45,  0}}, { 25,{ 45,  0}}, { 25,{ 45,  0}}, { 25,{ 45,  0}},
+    { 25,{ 45,  0}}, { 25,{ 45,  0}}, { 25,{ 45,  0}}, { 25,{ 45,  0}},
+    { 25,{ 45,  0}}, { 25,{ 45,  0}}, { 25,{ 45,  0}}, { 25,{ 45,  0}},
+    { 46,{ 46, 48}}, { 46,{ 46, 48}}, { 46,{ 46, 49}}, { 46,{ 46, 49}},
+    { 46,{ 46, 50}}, { 46,{ 46, 50}}, { 46,{ 46, 97}}, { 46,{ 46, 97}},
+    { 46,{ 46, 99}}, { 46,{ 46, 99}}, { 46,{ 46,101}}, { 46,{ 46,101}},
+    { 46,{ 46,105}}, { 46,{ 46,105}}, { 46,{ 46,111}}, { 46,{ 46,111}},
+    { 46,{ 46,115}}, { 46,{ 46,115}}, { 46,{ 46,116}}, { 46,{ 46,116}},
+    { 50,{ 46, 32}}, { 50,{ 46, 37}}, { 50,{ 46, 45}}, { 50,{ 46, 46}},
+    { 50,{ 46, 47}}, { 50,{ 46, 51}}, { 50,{ 46, 52}}, { 50,{ 46, 53}},
+    { 50,{ 46, 54}}, { 50,{ 46, 55}}, { 50,{ 46, 56}}, { 50,{ 46, 57}},
+    { 50,{ 46, 61}}, { 50,{ 46, 65}}, { 50,{ 46, 95}}, { 50,{ 46, 98}},
+    { 50,{ 46,100}}, { 50,{ 46,102}}, { 50,{ 46,103}}, { 50,{ 46,104}},
+    { 50,{ 46,108}}, { 50,{ 46,109}}, { 50,{ 46,110}}, { 50,{ 46,112}},
+    { 50,{ 46,114}}, { 50,{ 46,117}}, { 25,{ 46,  0}}, { 25,{ 46,  0}},
+    { 25,{ 46,  0}}, { 25,{ 46,  0}}, { 25,{ 46,  0}}, { 25,{ 46,  0}},
+    { 25,{ 46,  0}}, { 25,{ 46,  0}}, { 25,{ 46,  0}}, { 25,{ 46,  0}},
+    { 25,{ 46,  0}}, { 25,{ 46,  0}}, { 25,{ 46,  0}}, { 25,{ 46,  0}},
+    { 25,{ 46,  0}}, { 25,{ 46,  0}}, { 25,{ 46,  0}}, { 25,{ 46,  0}},
+    { 46,{ 47, 48}}, { 46,{ 47, 48}}, { 46,{ 47, 49}}, { 46,{ 47, 49}},
+    { 46,{ 47, 50}}, { 46,{ 47, 50}}, { 46,{ 47, 97}}, { 46,{ 47, 97}},
+    { 46,{ 47, 99}}, { 46,{ 47, 99}}, { 46,{ 47,101}}, { 46,{ 47,101}},
+    { 46,{ 47,105}}, { 46,{ 47,105}}, { 46,{ 47,111}}, { 46,{ 47,111}},
+    { 46,{ 47,115}}, { 46,{ 47,115}}, { 46,{ 47,116}}, { 46,{ 47,116}},
+    { 50,{ 47, 32}}, { 50,{ 47, 37}}, { 50,{ 47, 45}}, { 50,{ 47, 46}},
+    { 50,{ 47, 47}}, { 50,{ 47, 51}}, { 50,{ 47, 52}}, { 50,{ 47, 53}},
+    { 50,{ 47, 54}}, { 50,{ 47, 55}}, { 50,{ 47, 56}}, { 50,{ 47, 57}},
+    { 50,{ 47, 61}}, { 50,{ 47, 65}}, { 50,{ 47, 95}}, { 50,{ 47, 98}},
+    { 50,{ 47,100}}, { 50,{ 47,102}}, { 50,{ 47,103}}, { 50,{ 47,104}},
+    { 50,{ 47,108}}, { 50,{ 47,109}}, { 50,{ 47,110}}, { 50,{ 47,112}},
+    { 50,{ 47,114}}, { 50,{ 47,117}}, { 25,{ 47,  0}}, { 25,{ 47,  0}},
+    { 25,{ 47,  0}}, { 25,{ 47,  0}}, { 25,{ 47,  0}}, { 25,{ 47,  0}},
+    { 25,{ 47,  0}}, { 25,{ 47,  0}}, { 25,{ 47,  0}}, { 25,{ 47,  0}},
+    { 25,{ 47,  0}}, { 25,{ 47,  0}}, { 25,{ 47,  0}}, { 25,{ 47,  0}},
+    { 25,{ 47,  0}}, { 25,{ 47,  0}}, { 25,{ 47,  0}}, { 25,{ 47,  0}},
+    { 46,{ 51, 48}}, { 46,{ 51, 48}}, { 46,{ 51, 49}}, { 46,{ 51, 49}},
+    { 46,{ 51, 50}}, { 46,{ 51, 50}}, { 46,{ 51, 97}}, { 46,{ 51, 97}},
+    { 46,{ 51, 99}}, { 46,{ 51, 99}}, { 46,{ 51,101}}, { 46,{ 51,101}},
+    { 46,{ 51,105}}, { 46,{ 51,105}}, { 46,{ 51,111}}, { 46,{ 51,111}},
+    { 46,{ 51,115}}, { 46,{ 51,115}}, { 46,{ 51,116}}, { 46,{ 51,116}},
+    { 50,{ 51, 32}}, { 50,{ 51, 37}}, { 50,{ 51, 45}}, { 50,{ 51, 46}},
+    { 50,{ 51, 47}}, { 50,{ 51, 51}}, { 50,{ 51, 52}}, { 50,{ 51, 53}},
+    { 50,{ 51, 54}}, { 50,{ 51, 55}}, { 50,{ 51, 56}}, { 50,{ 51, 57}},
+    { 50,{ 51, 61}}, { 50,{ 51, 65}}, { 50,{ 51, 95}}, { 50,{ 51, 98}},
+    { 50,{ 51,100}}, { 50,{ 51,102}}, { 50,{ 51,103}}, { 50,{ 51,104}},
+    { 50,{ 51,108}}, { 50,{ 51,109}}, { 50,{ 51,110}}, { 50,{ 51,112}},
+    { 50,{ 51,114}}, { 50,{ 51,117}}, { 25,{ 51,  0}}, { 25,{ 51,  0}},
+    { 25,{ 51,  0}}, { 25,{ 51,  0}}, { 25,{ 51,  0}}, { 25,{ 51,  0}},
+    { 25,{ 51,  0}}, { 25,{ 51,  0}}, { 25,{ 51,  0}}, { 25,{ 51,  0}},
+    { 25,{ 51,  0}}, { 25,{ 51,  0}}, { 25,{ 51,  0}}, { 25,{ 51,  0}},
+    { 25,{ 51,  0}}, { 25,{ 51,  0}}, { 25,{ 51,  0}}, { 25,{ 51,  0}},
+    { 46,{ 52, 48}}, { 46,{ 52, 48}}, { 46,{ 52, 49}}, { 46,{ 52, 49}},
+    { 46,{ 52, 50}}, { 46,{ 52, 50}}, { 46,{ 52, 97}}, { 46,{ 52, 97}},
+    { 46,{ 52, 99}}, { 46,{ 52, 99}}, { 46,{ 52,101}}, { 46,{ 52,101}},
+    { 46,{ 52,105}}, { 46,{ 52,105}}, { 46,{ 52,111}}, { 46,{ 52,111}},
+    { 46,{ 52,115}}, { 46,{ 52,115}}, { 46,{ 52,116}}, { 46,{ 52,116}},
+    { 50,{ 52, 32}}, { 50,{ 52, 37}}, { 50,{ 52, 45}}, { 50,{ 52, 46}},
+    { 50,{ 52, 47}}, { 50,{ 52, 51}}, { 50,{ 52, 52}}, { 50,{ 52, 53}},
+    { 50,{ 52, 54}}, { 50,{ 52, 55}}, { 50,{ 52, 56}}, { 50,{ 52, 57}},
+    { 50,{ 52, 61}}, { 50,{ 52, 65}}, { 50,{ 52, 95}}, { 50,{ 52, 98}},
+    { 50,{ 52,100}}, { 50,{ 52,102}}, { 50,{ 52,103}}, { 50,{ 52,104}},
+    { 50,{ 52,108}}, { 50,{ 52,109}}, { 50,{ 52,110}}, { 50,{ 52,112}},
+    { 50,{ 52,114}}, { 50,{ 52,117}}, { 25,{ 52,  0}}, { 25,{ 52,  0}},
+    { 25,{ 52,  0}}, { 25,{ 52,  0}}, { 25,{ 52,  0}}, { 25,{ 52,  0}},
+    { 25,{ 52,  0}}, { 25,{ 52,  0}}, { 25,{ 52,  0}}, { 25,{ 52,  0}},
+    { 25,{ 52,  0}}, { 25,{ 52,  0}}, { 25,{ 52,  0}}, { 25,{ 52,  0}},
+    { 25,{ 52,  0}}, { 25,{ 52,  0}}, { 25,{ 52,  0}}, { 25,{ 52,  0}},
+    { 46,{ 53, 48}}, { 46,{ 53, 48}}, { 46,{ 53, 49}}, { 46,{ 53, 49}},
+    { 46,{ 53, 50}}, { 46,{ 53, 50}}, { 46,{ 53, 97}}, { 46,{ 53, 97}},
+    { 46,{ 53, 99}}, { 46,{ 53, 99}}, { 46,{ 53,101}}, { 46,{ 53,101}},
+    { 46,{ 53,105}}, { 46,{ 53,105}}, { 46,{ 53,111}}, { 46,{ 53,111}},
+    { 46,{ 53,115}}, { 46,{ 53,115}}, { 46,{ 53,116}}, { 46,{ 53,116}},
+    { 50,{ 53, 32}}, { 50,{ 53, 37}}, { 50,{ 53, 45}}, { 50,{ 53, 46}},
+    { 50,{ 53, 47}}, { 50,{ 53, 51}}, { 50,{ 53, 52}}, { 50,{ 53, 53}},
+    { 50,{ 53, 54}}, { 50,{ 53, 55}}, { 50,{ 53, 56}}, { 50,{ 53, 57}},
+    { 50,{ 53, 61}}, { 50,{ 53, 65}}, { 50,{ 53, 95}}, { 50,{ 53, 98}},
+    { 50,{ 53,100}}, { 50,{ 53,102}}, { 50,{ 53,103}}, { 50,{ 53,104}},
+    { 50,{ 53,108}}, { 50,{ 53,109}}, { 50,{ 53,110}}, { 50,{ 53,112}},
+    { 50,{ 53,114}}, { 50,{ 53,117}}, { 25,{ 53,  0}}, { 25,{ 53,  0}},
+    { 25,{ 53,  0}}, { 25,{ 53,  0}}, { 25,{ 53,  0}}, { 25,{ 53,  0}},
+    { 25,{ 53,  0}}, { 25,{ 53,  0}}, { 25,{ 53,  0}}, { 25,{ 53,  0}},
+    { 25,{ 53,  0}}, { 25,{ 53,  0}}, { 25,{ 53,  0}}, { 25,{ 53,  0}},
+    { 25,{ 53,  0}}, { 25,{ 53,  0}}, { 25,{ 53,  0}}, { 25,{ 53,  0}},
+    { 46,{ 54, 48}}, { 46,{ 54, 48}}, { 46,{ 54, 49}}, { 46,{ 54, 49}},
+    { 46,{ 54, 50}}, { 46,{ 54, 50}}, { 46,{ 54, 97}}, { 46,{ 54, 97}},
+    { 46,{ 54, 99}}, { 46,{ 54, 99}}, { 46,{ 54,101}}, { 46,{ 54,101}},
+    { 46,{ 54,105}}, { 46,{ 54,105}}, { 46,{ 54,111}}, { 46,{ 54,111}},
+    { 46,{ 54,115}}, { 46,{ 54,115}}, { 46,{ 54,116}}, { 46,{ 54,116}},
+    { 50,{ 54, 32}}, { 50,{ 54, 37}}, { 50,{ 54, 45}}, { 50,{ 54, 46}},
+    { 50,{ 54, 47}}, { 50,{ 54, 51}}, { 50,{ 54, 52}}, { 50,{ 54, 53}},
+    { 50,{ 54, 54}}, { 50,{ 54, 55}}, { 50,{ 54, 56}}, { 50,{ 54, 57}},
+    { 50,{ 54, 61}}, { 50,{ 54, 65}}, { 50,{ 54, 95}}, { 50,{ 54, 98}},
+    { 50,{ 54,100}}, { 50,{ 54,102}}, { 50,{ 54,103}}, { 50,{ 54,104}},
+    { 50,{ 54,108}}, { 50,{ 54,109}}, { 50,{ 54,110}}, { 50,{ 54,112}},
+    { 50,{ 54,114}}, { 50,{ 54,117}}, { 25,{ 54,  0}}, { 25,{ 54,  0}},
+    { 25,{ 54,  0}}, { 25,{ 54,  0}}, { 25,{ 54,  0}}, { 25,{ 54,  0}},
+    { 25,{ 54,  0}}, { 25,{ 54,  0}}, { 25,{ 54,  0}}, { 25,{ 54,  0}},
+    { 25,{ 54,  0}}, { 25,{ 54,  0}}, { 25,{ 54,  0}}, { 25,{ 54,  0}},
+    { 25,{ 54,  0}}, { 25,{ 54,  0}}, { 25,{ 54,  0}}, { 25,{ 54,  0}},
+    { 46,{ 55, 48}}, { 46,{ 55, 48}}, { 46,{ 55, 49}}, { 46,{ 55, 49}},
+    { 46,{ 55, 50}}, { 46,{ 55, 50}}, { 46,{ 55, 97}}, { 46,{ 55, 97}},
+    { 46,{ 55, 99}}, { 46,{ 55, 99}}, { 46,{ 55,101}}, { 46,{ 55,101}},
+    { 46,{ 55,105}}, { 46,{ 55,105}}, { 46,{ 55,111}}, { 46,{ 55,111}},
+    { 46,{ 55,115}}, { 46,{ 55,115}}, { 46,{ 55,116}}, { 46,{ 55,116}},
+    { 50,{ 55, 32}}, { 50,{ 55, 37}}, { 50,{ 55, 45}}, { 50,{ 55, 46}},
+    { 50,{ 55, 47}}, { 50,{ 55, 51}}, { 50,{ 55, 52}}, { 50,{ 55, 53}},
+    { 50,{ 55, 54}}, { 50,{ 55, 55}}, { 50,{ 55, 56}}, { 50,{ 55, 57}},
+    { 50,{ 55, 61}}, { 50,{ 55, 65}}, { 50,{ 55, 95}}, { 50,{ 55, 98}},
+    { 50,{ 55,100}}, { 50,{ 55,102}}, { 50,{ 55,103}}, { 50,{ 55,104}},
+    { 50,{ 55,108}}, { 50,{ 55,109}}, { 50,{ 55,110}}, { 50,{ 55,112}},
+    { 50,{ 55,114}}, { 50,{ 55,117}}, { 25,{ 55,  0}}, { 25,{ 55,  0}},
+    { 25,{ 55,  0}}, { 25,{ 55,  0}}, { 25,{ 55,  0}}, { 25,{ 55,  0}},
+    { 25,{ 55,  0}}, { 25,{ 55,  0}}, { 25,{ 55,  0}}, { 25,{ 55,  0}},
+    { 25,{ 55,  0}}, { 25,{ 55,  0}}, { 25,{ 55,  0}}, { 25,{ 55,  0}},
+    { 25,{ 55,  0}}, { 25,{ 55,  0}}, { 25,{ 55,  0}}, { 25,{ 55,  0}},
+    { 46,{ 56, 48}}, { 46,{ 56, 48}}, { 46,{ 56, 49}}, { 46,{ 56, 49}},
+    { 46,{ 56, 50}}, { 46,{ 56, 50}}, { 46,{ 56, 97}}, { 46,{ 56, 97}},
+    { 46,{ 56, 99}}, { 46,{ 56, 99}}, { 46,{ 56,101}}, { 46,{ 56,101}},
+    { 46,{ 56,105}}, { 46,{ 56,105}}, { 46,{ 56,111}}, { 46,{ 56,111}},
+    { 46,{ 56,115}}, { 46,{ 56,115}}, { 46,{ 56,116}}, { 46,{ 56,116}},
+    { 50,{ 56, 32}}, { 50,{ 56, 37}}, { 50,{ 56, 45}}, { 50,{ 56, 46}},
+    { 50,{ 56, 47}}, { 50,{ 56, 51}}, { 50,{ 56, 52}}, { 50,{ 56, 53}},
+    { 50,{ 56, 54}}, { 50,{ 56, 55}}, { 50,{ 56, 56}}, { 50,{ 56, 57}},
+    { 50,{ 56, 61}}, { 50,{ 56, 65}}, { 50,{ 56, 95}}, { 50,{ 56, 98}},
+    { 50,{ 56,100}}, { 50,{ 56,102}}, { 50,{ 56,103}}, { 50,{ 56,104}},
+    { 50,{ 56,108}}, { 50,{ 56,109}}, { 50,{ 56,110}}, { 50,{ 56,112}},
+    { 50,{ 56,114}}, { 50,{ 56,117}}, { 25,{ 56,  0}}, { 25,{ 56,  0}},
+    { 25,{ 56,  0}}, { 25,{ 56,  0}}, { 25,{ 56,  0}}, { 25,{ 56,  0}},
+    { 25,{ 56,  0}}, { 25,{ 56,  0}}, { 25,{ 56,  0}}, { 25,{ 56,  0}},
+    { 25,{ 56,  0}}, { 25,{ 56,  0}}, { 25,{ 56,  0}}, { 25,{ 56,  0}},
+    { 25,{ 56,  0}}, { 25,{ 56,  0}}, { 25,{ 56,  0}}, { 25,{ 56,  0}},
+    { 46,{ 57, 48}}, { 46,{ 57, 48}}, { 46,{ 57, 49}}, { 46,{ 57, 49}},
+    { 46,{ 57, 50}}, { 46,{ 57, 50}}, { 46,{ 57, 97}}, { 46,{ 57, 97}},
+    { 46,{ 57, 99}}, { 46,{ 57, 99}}, { 46,{ 57,101}}, { 46,{ 57,101}},
+    { 46,{ 57,105}}, { 46,{ 57,105}}, { 46,{ 57,111}}, { 46,{ 57,111}},
+    { 46,{ 57,115}}, { 46,{ 57,115}}, { 46,{ 57,116}}, { 46,{ 57,116}},
+    { 50,{ 57, 32}}, { 50,{ 57, 37}}, { 50,{ 57, 45}}, { 50,{ 57, 46}},
+    { 50,{ 57, 47}}, { 50,{ 57, 51}}, { 50,{ 57, 52}}, { 50,{ 57, 53}},
+    { 50,{ 57, 54}}, { 50,{ 57, 55}}, { 50,{ 57, 56}}, { 50,{ 57, 57}},
+    { 50,{ 57, 61}}, { 50,{ 57, 65}}, { 50,{ 57, 95}}, { 50,{ 57, 98}},
+    { 50,{ 57,100}}, { 50,{ 57,102}}, { 50,{ 57,103}}, { 50,{ 57,104}},
+    { 50,{ 57,108}}, { 50,{ 57,109}}, { 50,{ 57,110}}, { 50,{ 57,112}},
+    { 50,{ 57,114}}, { 50,{ 57,117}}, { 25,{ 57,  0}}, { 25,{ 57,  0}},
+    { 25,{ 57,  0}}, { 25,{ 57,  0}}, { 25,{ 57,  0}}, { 25,{ 57,  0}},
+    { 25,{ 57,  0}}, { 25,{ 57,  0}}, { 25,{ 57,  0}}, { 25,{ 57,  0}},
+    { 25,{ 57,  0}}, { 25,{ 57,  0}}, { 25,{ 57,  0}}, { 25,{ 57,  0}},
+    { 25,{ 57,  0}}, { 25,{ 57,  0}}, { 25,{ 57,  0}}, { 25,{ 57,  0}},
+    { 46,{ 61, 48}}, { 46,{ 61, 48}}, { 46,{ 61, 49}}, { 46,{ 61, 49}},
+    { 46,{ 61, 50}}, { 46,{ 61, 50}}, { 46,{ 61, 97}}, { 46,{ 61, 97}},
+    { 46,{ 61, 99}}, { 46,{ 61, 99}}, { 46,{ 61,101}}, { 46,{ 61,101}},
+    { 46,{ 61,105}}, { 46,{ 61,105}}, { 46,{ 61,111}}, { 46,{ 61,111}},
+    { 46,{ 61,115}}, { 46,{ 61,115}}, { 46,{ 61,116}}, { 46,{ 61,116}},
+    { 50,{ 61, 32}}, { 50,{ 61, 37}}, { 50,{ 61, 45}}, { 50,{ 61, 46}},
+    { 50,{ 61, 47}}, { 50,{ 61, 51}}, { 50,{ 61, 52}}, { 50,{ 61, 53}},
+    { 50,{ 61, 54}}, { 50,{ 61, 55}}, { 50,{ 61, 56}}, { 50,{ 61, 57}},
+    { 50,{ 61, 61}}, { 50,{ 61, 65}}, { 50,{ 61, 95}}, { 50,{ 61, 98}},
+    { 50,{ 61,100}}, { 50,{ 61,102}}, { 50,{ 61,103}}, { 50,{ 61,104}},
+    { 50,{ 61,108}}, { 50,{ 61,109}}, { 50,{ 61,110}}, { 50,{ 61,112}},
+    { 50,{ 61,114}}, { 50,{ 61,117}}, { 25,{ 61,  0}}, { 25,{ 61,  0}},
+    { 25,{ 61,  0}}, { 25,{ 61,  0}}, { 25,{ 61,  0}}, { 25,{ 61,  0}},
+    { 25,{ 61,  0}}, { 25,{ 61,  0}}, { 25,{ 61,  0}}, { 25,{ 61,  0}},
+    { 25,{ 61,  0}}, { 25,{ 61,  0}}, { 25,{ 61,  0}}, { 25,{ 61,  0}},
+    { 25,{ 61,  0}}, { 25,{ 61,  0}}, { 25,{ 61,  0}}, { 25,{ 61,  0}},
+    { 46,{ 65, 48}}, { 46,{ 65, 48}}, { 46,{ 65, 49}}, { 46,{ 65, 49}},
+    { 46,{ 65, 50}}, { 46,{ 65, 50}}, { 46,{ 65, 97}}, { 46,{ 65, 97}},
+    { 46,{ 65, 99}}, { 46,{ 65, 99}}, { 46,{ 65,101}}, { 46,{ 65,101}},
+    { 46,{ 65,105}}, { 46,{ 65,105}}, { 46,{ 65,111}}, { 46,{ 65,111}},
+    { 46,{ 65,115}}, { 46,{ 65,115}}, { 46,{ 65,116}}, { 46,{ 65,116}},
+    { 50,{ 65, 32}}, { 50,{ 65, 37}}, { 50,{ 65, 45}}, { 50,{ 65, 46}},
+    { 50,{ 65, 47}}, { 50,{ 65, 51}}, { 50,{ 65, 52}}, { 50,{ 65, 53}},
+    { 50,{ 65, 54}}, { 50,{ 65, 55}}, { 50,{ 65, 56}}, { 50,{ 65, 57}},
+    { 50,{ 65, 61}}, { 50,{ 65, 65}}, { 50,{ 65, 95}}, { 50,{ 65, 98}},
+    { 50,{ 65,100}}, { 50,{ 65,102}}, { 50,{ 65,103}}, { 50,{ 65,104}},
+    { 50,{ 65,108}}, { 50,{ 65,109}}, { 50,{ 65,110}}, { 50,{ 65,112}},
+    { 50,{ 65,114}}, { 50,{ 65,117}}, { 25,{ 65,  0}}, { 25,{ 65,  0}},
+    { 25,{ 65,  0}}, { 25,{ 65,  0}}, { 25,{ 65,  0}}, { 25,{ 65,  0}},
+    { 25,{ 65,  0}}, { 25,{ 65,  0}}, { 25,{ 65,  0}}, { 25,{ 65,  0}},
+    { 25,{ 65,  0}}, { 25,{ 65,  0}}, { 25,{ 65,  0}}, { 25,{ 65,  0}},
+    { 25,{ 65,  0}}, { 25,{ 65,  0}}, { 25,{ 65,  0}}, { 25,{ 65,  0}},
+    { 46,{ 95, 48}}, { 46,{ 95, 48}}, { 46,{ 95, 49}}, { 46,{ 95, 49}},
+    { 46,{ 95, 50}}, { 46,{ 95, 50}}, { 46,{ 95, 97}}, { 46,{ 95, 97}},
+    { 46,{ 95, 99}}, { 46,{ 95, 99}}, { 46,{ 95,101}}, { 46,{ 95,101}},
+    { 46,{ 95,105}}, { 46,{ 95,105}}, { 46,{ 95,111}}, { 46,{ 95,111}},
+    { 46,{ 95,115}}, { 46,{ 95,115}}, { 46,{ 95,116}}, { 46,{ 95,116}},
+    { 50,{ 95, 32}}, { 50,{ 95, 37}}, { 50,{ 95, 45}}, { 50,{ 95, 46}},
+    { 50,{ 95, 47}}, { 50,{ 95, 51}}, { 50,{ 95, 52}}, { 50,{ 95, 53}},
+    { 50,{ 95, 54}}, { 50,{ 95, 55}}, { 50,{ 95, 56}}, { 50,{ 95, 57}},
+    { 50,{ 95, 61}}, { 50,{ 95, 65}}, { 50,{ 95, 95}}, { 50,{ 95, 98}},
+    { 50,{ 95,100}}, { 50,{ 95,102}}, { 50,{ 95,103}}, { 50,{ 95,104}},
+    { 50,{ 95,108}}, { 50,{ 95,109}}, { 50,{ 95,110}}, { 50,{ 95,112}},
+    { 50,{ 95,114}}, { 50,{ 95,117}}, { 25,{ 95,  0}}, { 25,{ 95,  0}},
+    { 25,{ 95,  0}}, { 25,{ 95,  0}}, { 25,{ 95,  0}}, { 25,{ 95,  0}},
+    { 25,{ 95,  0}}, { 25,{ 95,  0}}, { 25,{ 95,  0}}, { 25,{ 95,  0}},
+    { 25,{ 95,  0}}, { 25,{ 95,  0}}, { 25,{ 95,  0}}, { 25,{ 95,  0}},
+    { 25,{ 95,  0}}, { 25,{ 95,  0}}, { 25,{ 95,  0}}, { 25,{ 95,  0}},
+    { 46,{ 98, 48}}, { 46,{ 98, 48}}, { 46,{ 98, 49}}, { 46,{ 98, 49}},
+    { 46,{ 98, 50}}, { 46,{ 98, 50}}, { 46,{ 98, 97}}, { 46,{ 98, 97}},
+    { 46,{ 98, 99}}, { 46,{ 98, 99}}, { 46,{ 98,101}}, { 46,{ 98,101}},
+    { 46,{ 98,105}}, { 46,{ 98,105}}, { 46,{ 98,111}}, { 46,{ 98,111}},
+    { 46,{ 98,115}}, { 46,{ 98,115}}, { 46,{ 98,116}}, { 46,{ 98,116}},
+    { 50,{ 98, 32}}, { 50,{ 98, 37}}, { 50,{ 98, 45}}, { 50,{ 98, 46}},
+    { 50,{ 98, 47}}, { 50,{ 98, 51}}, { 50,{ 98, 52}}, { 50,{ 98, 53}},
+    { 50,{ 98, 54}}, { 50,{ 98, 55}}, { 50,{ 98, 56}}, { 50,{ 98, 57}},
+    { 50,{ 98, 61}}, { 50,{ 98, 65}}, { 50,{ 98, 95}}, { 50,{ 98, 98}},
+    { 50,{ 98,100}}, { 50,{ 98,102}}, { 50,{ 98,103}}, { 50,{ 98,104}},
+    { 50,{ 98,108}}, { 50,{ 98,109}}, { 50,{ 98,110}}, { 50,{ 98,112}},
+    { 50,{ 98,114}}, { 50,{ 98,117}}, { 25,{ 98,  0}}, { 25,{ 98,  0}},
+    { 25,{ 98,  0}}, { 25,{ 98,  0}}, { 25,{ 98,  0}}, { 25,{ 98,  0}},
+    { 25,{ 98,  0}}, { 25,{ 98,  0}}, { 25,{ 98,  0}}, { 25,{ 98,  0}},
+    { 25,{ 98,  0}}, { 25,{ 98,  0}}, { 25,{ 98,  0}}, { 25,{ 98,  0}},
+    { 25,{ 98,  0}}, { 25,{ 98,  0}}, { 25,{ 98,  0}}, { 25,{ 98,  0}},
+    { 46,{100, 48}}, { 46,{100, 48}}, { 46,{100, 49}}, { 46,{100, 49}},
+    { 46,{100, 50}}, { 46,{100, 50}}, { 46,{100, 97}}, { 46,{100, 97}},
+    { 46,{100, 99}}, { 46,{100, 99}}, { 46,{100,101}}, { 46,{100,101}},
+    { 46,{100,105}}, { 46,{100,105}}, { 46,{100,111}}, { 46,{100,111}},
+    { 46,{100,115}}, { 46,{100,115}}, { 46,{100,116}}, { 46,{100,116}},
+    { 50,{100, 32}}, { 50,{100, 37}}, { 50,{100, 45}}, { 50,{100, 46}},
+    { 50,{100, 47}}, { 50,{100, 51}}, { 50,{100, 52}}, { 50,{100, 53}},
+    { 50,{100, 54}}, { 50,{100, 55}}, { 50,{100, 56}}, { 50,{100, 57}},
+    { 50,{100, 61}}, { 50,{100, 65}}, { 50,{100, 95}}, { 50,{100, 98}},
+    { 50,{100,100}}, { 50,{100,102}}, { 50,{100,103}}, { 50,{100,104}},
+    { 50,{100,108}}, { 50,{100,109}}, { 50,{100,110}}, { 50,{100,112}},
+    { 50,{100,114}}, { 50,{100,117}}, { 25,{100,  0}}, { 25,{100,  0}},
+    { 25,{100,  0}}, { 25,{100,  0}}, { 25,{100,  0}}, { 25,{100,  0}},
+    { 25,{100,  0}}, { 25,{100,  0}}, { 25,{100,  0}}, { 25,{100,  0}},
+    { 25,{100,  0}}, { 25,{100,  0}}, { 25,{100,  0}}, { 25,{100,  0}},
+    { 25,{100,  0}}, { 25,{100,  0}}, { 25,{100,  0}}, { 25,{100,  0}},
+    { 46,{102, 48}}, { 46,{102, 48}}, { 46,{102, 49}}, { 46,{102, 49}},
+    { 46,{102, 50}}, { 46,{102, 50}}, { 46,{102, 97}}, { 46,{102, 97}},
+    { 46,{102, 99}}, { 46,{102, 99}}, { 46,{102,101}}, { 46,{102,101}},
+    { 46,{102,105}}, { 46,{102,105}}, { 46,{102,111}}, { 46,{102,111}},
+    { 46,{102,115}}, { 46,{102,115}}, { 46,{102,116}}, { 46,{102,116}},
+    { 50,{102, 32}}, { 50,{102, 37}}, { 50,{102, 45}}, { 50,{102, 46}},
+    { 50,{102, 47}}, { 50,{102, 51}}, { 50,{102, 52}}, { 50,{102, 53}},
+    { 50,{102, 54}}, { 50,{102, 55}}, { 50,{102, 56}}, { 50,{102, 57}},
+    { 50,{102, 61}}, { 50,{102, 65}}, { 50,{102, 95}}, { 50,{102, 98}},
+    { 50,{102,100}}, { 50,{102,102}}, { 50,{102,103}}, { 50,{102,104}},
+    { 50,{102,108}}, { 50,{102,109}}, { 50,{102,110}}, { 50,{102,112}},
+    { 50,{102,114}}, { 50,{102,117}}, { 25,{102,  0}}, { 25,{102,  0}},
+    { 25,{102,  0}}, { 25,{102,  0}}, { 25,{102,  0}}, { 25,{102,  0}},
+    { 25,{102,  0}}, { 25,{102,  0}}, { 25,{102,  0}}, { 25,{102,  0}},
+    { 25,{102,  0}}, { 25,{102,  0}}, { 25,{102,  0}}, { 25,{102,  0}},
+    { 25,{102,  0}}, { 25,{102,  0}}, { 25,{102,  0}}, { 25,{102,  0}},
+    { 46,{103, 48}}, { 46,{103, 48}}, { 46,{103, 49}}, { 46,{103, 49}},
+    { 46,{103, 50}}, { 46,{103, 50}}, { 46,{103, 97}}, { 46,{103, 97}},
+    { 46,{103, 99}}, { 46,{103, 99}}, { 46,{103,101}}, { 46,{103,101}},
+    { 46,{103,105}}, { 46,{103,105}}, { 46,{103,111}}, { 46,{103,111}},
+    { 46,{103,115}}, { 46,{103,115}}, { 46,{103,116}}, { 46,{103,116}},
+    { 50,{103, 32}}, { 50,{103, 37}}, { 50,{103, 45}}, { 50,{103, 46}},
+    { 50,{103, 47}}, { 50,{103, 51}}, { 50,{103, 52}}, { 50,{103, 53}},
+    { 50,{103, 54}}, { 50,{103, 55}}, { 50,{103, 56}}, { 50,{103, 57}},
+    { 50,{103, 61}}, { 50,{103, 65}}, { 50,{103, 95}}, { 50,{103, 98}},
+    { 50,{103,100}}, { 50,{103,102}}, { 50,{103,103}}, { 50,{103,104}},
+    { 50,{103,108}}, { 50,{103,109}}, { 50,{103,110}}, { 50,{103,112}},
+    { 50,{103,114}}, { 50,{103,117}}, { 25,{103,  0}}, { 25,{103,  0}},
+    { 25,{103,  0}}, { 25,{103,  0}}, { 25,{103,  0}}, { 25,{103,  0}},
+    { 25,{103,  0}}, { 25,{103,  0}}, { 25,{103,  0}}, { 25,{103,  0}},
+    { 25,{103,  0}}, { 25,{103,  0}}, { 25,{103,  0}}, { 25,{103,  0}},
+    { 25,{103,  0}}, { 25,{103,  0}}, { 25,{103,  0}}, { 25,{103,  0}},
+    { 46,{104, 48}}, { 46,{104, 48}}, { 46,{104, 49}}, { 46,{104, 49}},
+    { 46,{104, 50}}, { 46,{104, 50}}, { 46,{104, 97}}, { 46,{104, 97}},
+    { 46,{104, 99}}, { 46,{104, 99}}, { 46,{104,101}}, { 46,{104,101}},
+    { 46,{104,105}}, { 46,{104,105}}, { 46,{104,111}}, { 46,{104,111}},
+    { 46,{104,115}}, { 46,{104,115}}, { 46,{104,116}}, { 46,{104,116}},
+    { 50,{104, 32}}, { 50,{104, 37}}, { 50,{104, 45}}, { 50,{104, 46}},
+    { 50,{104, 47}}, { 50,{104, 51}}, { 50,{104, 52}}, { 50,{104, 53}},
+    { 50,{104, 54}}, { 50,{104, 55}}, { 50,{104, 56}}, { 50,{104, 57}},
+    { 50,{104, 61}}, { 50,{104, 65}}, { 50,{104, 95}}, { 50,{104, 98}},
+    { 50,{104,100}}, { 50,{104,102}}, { 50,{104,103}}, { 50,{104,104}},
+    { 50,{104,108}}, { 50,{104,109}}, { 50,{104,110}}, { 50,{104,112}},
+    { 50,{104,114}}, { 50,{104,117}}, { 25,{104,  0}}, { 25,{104,  0}},
+    { 25,{104,  0}}, { 25,{104,  0}}, { 25,{104,  0}}, { 25,{104,  0}},
+    { 25,{104,  0}}, { 25,{104,  0}}, { 25,{104,  0}}, { 25,{104,  0}},
+    { 25,{104,  0}}, { 25,{104,  0}}, { 25,{104,  0}}, { 25,{104,  0}},
+    { 25,{104,  0}}, { 25,{104,  0}}, { 25,{104,  0}}, { 25,{104,  0}},
+    { 46,{108, 48}}, { 46,{108, 48}}, { 46,{108, 49}}, { 46,{108, 49}},
+    { 46,{108, 50}}, { 46,{108, 50}}, { 46,{108, 97}}, { 46,{108, 97}},
+    { 46,{108, 99}}, { 46,{108, 99}}, { 46,{108,101}}, { 46,{108,101}},
+    { 46,{108,105}}, { 46,{108,105}}, { 46,{108,111}}, { 46,{108,111}},
+    { 46,{108,115}}, { 46,{108,115}}, { 46,{108,116}}, { 46,{108,116}},
+    { 50,{108, 32}}, { 50,{108, 37}}, { 50,{108, 45}}, { 50,{108, 46}},
+    { 50,{108, 47}}, { 50,{108, 51}}, { 50,{108, 52}}, { 50,{108, 53}},
+    { 50,{108, 54}}, { 50,{108, 55}}, { 50,{108, 56}}, { 50,{108, 57}},
+    { 50,{108, 61}}, { 50,{108, 65}}, { 50,{108, 95}}, { 50,{108, 98}},
+    { 50,{108,100}}, { 50,{108,102}}, { 50,{108,103}}, { 50,{108,104}},
+    { 50,{108,108}}, { 50,{108,109}}, { 50,{108,110}}, { 50,{108,112}},
+    { 50,{108,114}}, { 50,{108,117}}, { 25,{108,  0}}, { 25,{108,  0}},
+    { 25,{108,  0}}, { 25,{108,  0}}, { 25,{108,  0}}, { 25,{108,  0}},
+    { 25,{108,  0}}, { 25,{108,  0}}, { 25,{108,  0}}, { 25,{108,  0}},
+    { 25,{108,  0}}, { 25,{108,  0}}, { 25,{108,  0}}, { 25,{108,  0}},
+    { 25,{108,  0}}, { 25,{108,  0}}, { 25,{108,  0}}, { 25,{108,  0}},
+    { 46,{109, 48}}, { 46,{109, 48}}, { 46,{109, 49}}, { 46,{109, 49}},
+    { 46,{109, 50}}, { 46,{109, 50}}, { 46,{109, 97}}, { 46,{109, 97}},
+    { 46,{109, 99}}, { 46,{109, 99}}, { 46,{109,101}}, { 46,{109,101}},
+    { 46,{109,105}}, { 46,{109,105}}, { 46,{109,111}}, { 46,{109,111}},
+    { 46,{109,115}}, { 46,{109,115}}, { 46,{109,116}}, { 46,{109,116}},
+    { 50,{109, 32}}, { 50,{109, 37}}, { 50,{109, 45}}, { 50,{109, 46}},
+    { 50,{109, 47}}, { 50,{109, 51}}, { 50,{109, 52}}, { 50,{109, 53}},
+    { 50,{109, 54}}, { 50,{109, 55}}, { 50,{109, 56}}, { 50,{109, 57}},
+    { 50,{109, 61}}, { 50,{109, 65}}, { 50,{109, 95}}, { 50,{109, 98}},
+    { 50,{109,100}}, { 50,{109,102}}, { 50,{109,103}}, { 50,{109,104}},
+    { 50,{109,108}}, { 50,{109,109}}, { 50,{109,110}}, { 50,{109,112}},
+    { 50,{109,114}}, { 50,{109,117}}, { 25,{109,  0}}, { 25,{109,  0}},
+    { 25,{109,  0}}, { 25,{109,  0}}, { 25,{109,  0}}, { 25,{109,  0}},
+    { 25,{109,  0}}, { 25,{109,  0}}, { 25,{109,  0}}, { 25,{109,  0}},
+    { 25,{109,  0}}, { 25,{109,  0}}, { 25,{109,  0}}, { 25,{109,  0}},
+    { 25,{109,  0}}, { 25,{109,  0}}, { 25,{109,  0}}, { 25,{109,  0}},
+    { 46,{110, 48}}, { 46,{110, 48}}, { 46,{110, 49}}, { 46,{110, 49}},
+    { 46,{110, 50}}, { 46,{110, 50}}, { 46,{110, 97}}, { 46,{110, 97}},
+    { 46,{110, 99}}, { 46,{110, 99}}, { 46,{110,101}}, { 46,{110,101}},
+    { 46,{110,105}}, { 46,{110,105}}, { 46,{110,111}}, { 46,{110,111}},
+    { 46,{110,115}}, { 46,{110,115}}, { 46,{110,116}}, { 46,{110,116}},
+    { 50,{110, 32}}, { 50,{110, 37}}, { 50,{110, 45}}, { 50,{110, 46}},
+    { 50,{110, 47}}, { 50,{110, 51}}, { 50,{110, 52}}, { 50,{110, 53}},
+    { 50,{110, 54}}, { 50,{110, 55}}, { 50,{110, 56}}, { 50,{110, 57}},
+    { 50,{110, 61}}, { 50,{110, 65}}, { 50,{110, 95}}, { 50,{110, 98}},
+    { 50,{110,100}}, { 50,{110,102}}, { 50,{110,103}}, { 50,{110,104}},
+    { 50,{110,108}}, { 50,{110,109}}, { 50,{110,110}}, { 50,{110,112}},
+    { 50,{110,114}}, { 50,{110,117}}, { 25,{110,  0}}, { 25,{110,  0}},
+    { 25,{110,  0}}, { 25,{110,  0}}, { 25,{110,  0}}, { 25,{110,  0}},
+    { 25,{110,  0}}, { 25,{110,  0}}, { 25,{110,  0}}, { 25,{110,  0}},
+    { 25,{110,  0}}, { 25,{110,  0}}, { 25,{110,  0}}, { 25,{110,  0}},
+    { 25,{110,  0}}, { 25,{110,  0}}, { 25,{110,  0}}, { 25,{110,  0}},
+    { 46,{112, 48}}, { 46,{112, 48}}, { 46,{112, 49}}, { 46,{112, 49}},
+    { 46,{112, 50}}, { 46,{112, 50}}, { 46,{112, 97}}, { 46,{112, 97}},
+    { 46,{112, 99}}, { 46,{112, 99}}, { 46,{112,101}}, { 46,{112,101}},
+    { 46,{112,105}}, { 46,{112,105}}, { 46,{112,111}}, { 46,{112,111}},
+    { 46,{112,115}}, { 46,{112,115}}, { 46,{112,116}}, { 46,{112,116}},
+    { 50,{112, 32}}, { 50,{112, 37}}, { 50,{112, 45}}, { 50,{112, 46}},
+    { 50,{112, 47}}, { 50,{112, 51}}, { 50,{112, 52}}, { 50,{112, 53}},
+    { 50,{112, 54}}, { 50,{112, 55}}, { 50,{112, 56}}, { 50,{112, 57}},
+    { 50,{112, 61}}, { 50,{112, 65}}, { 50,{112, 95}}, { 50,{112, 98}},
+    { 50,{112,100}}, { 50,{112,102}}, { 50,{112,103}}, { 50,{112,104}},
+    { 50,{112,108}}, { 50,{112,109}}, { 50,{112,110}}, { 50,{112,112}},
+    { 50,{112,114}}, { 50,{112,117}}, { 25,{112,  0}}, { 25,{112,  0}},
+    { 25,{112,  0}}, { 25,{112,  0}}, { 25,{112,  0}}, { 25,{112,  0}},
+    { 25,{112,  0}}, { 25,{112,  0}}, { 25,{112,  0}}, { 25,{112,  0}},
+    { 25,{112,  0}}, { 25,{112,  0}}, { 25,{112,  0}}, { 25,{112,  0}},
+    { 25,{112,  0}}, { 25,{112,  0}}, { 25,{112,  0}}, { 25,{112,  0}},
+    { 46,{114, 48}}, { 46,{114, 48}}, { 46,{114, 49}}, { 46,{114, 49}},
+    { 46,{114, 50}}, { 46,{114, 50}}, { 46,{114, 97}}, { 46,{114, 97}},
+    { 46,{114, 99}}, { 46,{114, 99}}, { 46,{114,101}}, { 46,{114,101}},
+    { 46,{114,105}}, { 46,{114,105}}, { 46,{114,111}}, { 46,{114,111}},
+    { 46,{114,115}}, { 46,{114,115}}, { 46,{114,116}}, { 46,{114,116}},
+    { 50,{114, 32}}, { 50,{114, 37}}, { 50,{114, 45}}, { 50,{114, 46}},
+    { 50,{114, 47}}, { 50,{114, 51}}, { 50,{114, 52}}, { 50,{114, 53}},
+    { 50,{114, 54}}, { 50,{114, 55}}, { 50,{114, 56}}, { 50,{114, 57}},
+    { 50,{114, 61}}, { 50,{114, 65}}, { 50,{114, 95}}, { 50,{114, 98}},
+    { 50,{114,100}}, { 50,{114,102}}, { 50,{114,103}}, { 50,{114,104}},
+    { 50,{114,108}}, { 50,{114,109}}, { 50,{114,110}}, { 50,{114,112}},
+    { 50,{114,114}}, { 50,{114,117}}, { 25,{114,  0}}, { 25,{114,  0}},
+    { 25,{114,  0}}, { 25,{114,  0}}, { 25,{114,  0}}, { 25,{114,  0}},
+    { 25,{114,  0}}, { 25,{114,  0}}, { 25,{114,  0}}, { 25,{114,  0}},
+    { 25,{114,  0}}, { 25,{114,  0}}, { 25,{114,  0}}, { 25,{114,  0}},
+    { 25,{114,  0}}, { 25,{114,  0}}, { 25,{114,  0}}, { 25,{114,  0}},
+    { 46,{117, 48}}, { 46,{117, 48}}, { 46,{117, 49}}, { 46,{117, 49}},
+    { 46,{117, 50}}, { 46,{117, 50}}, { 46,{117, 97}}, { 46,{117, 97}},
+    { 46,{117, 99}}, { 46,{117, 99}}, { 46,{117,101}}, { 46,{117,101}},
+    { 46,{117,105}}, { 46,{117,105}}, { 46,{117,111}}, { 46,{117,111}},
+    { 46,{117,115}}, { 46,{117,115}}, { 46,{117,116}}, { 46,{117,116}},
+    { 50,{117, 32}}, { 50,{117, 37}}, { 50,{117, 45}}, { 50,{117, 46}},
+    { 50,{117, 47}}, { 50,{117, 51}}, { 50,{117, 52}}, { 50,{117, 53}},
+    { 50,{117, 54}}, { 50,{117, 55}}, { 50,{117, 56}}, { 50,{117, 57}},
+    { 50,{117, 61}}, { 50,{117, 65}}, { 50,{117, 95}}, { 50,{117, 98}},
+    { 50,{117,100}}, { 50,{117,102}}, { 50,{117,103}}, { 50,{117,104}},
+    { 50,{117,108}}, { 50,{117,109}}, { 50,{117,110}}, { 50,{117,112}},
+    { 50,{117,114}}, { 50,{117,117}}, { 25,{117,  0}}, { 25,{117,  0}},
+    { 25,{117,  0}}, { 25,{117,  0}}, { 25,{117,  0}}, { 25,{117,  0}},
+    { 25,{117,  0}}, { 25,{117,  0}}, { 25,{117,  0}}, { 25,{117,  0}},
+    { 25,{117,  0}}, { 25,{117,  0}}, { 25,{117,  0}}, { 25,{117,  0}},
+    { 25,{117,  0}}, { 25,{117,  0}}, { 25,{117,  0}}, { 25,{117,  0}},
+    { 50,{ 58, 48}}, { 50,{ 58, 49}}, { 50,{ 58, 50}}, { 50,{ 58, 97}},
+    { 50,{ 58, 99}}, { 50,{ 58,101}}, { 50,{ 58,105}}, { 50,{ 58,111}},
+    { 50,{ 58,115}}, { 50,{ 58,116}}, { 29,{ 58,  0}}, { 29,{ 58,  0}},
+    { 29,{ 58,  0}}, { 29,{ 58,  0}}, { 29,{ 58,  0}}, { 29,{ 58,  0}},
+    { 29,{ 58,  0}}, { 29,{ 58,  0}}, { 29,{ 58,  0}}, { 29,{ 58,  0}},
+    { 29,{ 58,  0}}, { 29,{ 58,  0}}, { 29,{ 58,  0}}, { 29,{ 58,  0}},
+    { 29,{ 58,  0}}, { 29,{ 58,  0}}, { 29,{ 58,  0}}, { 29,{ 58,  0}},
+    { 29,{ 58,  0}}, { 29,{ 58,  0}}, { 29,{ 58,  0}}, { 29,{ 58,  0}},
+    { 50,{ 66, 48}}, { 50,{ 66, 49}}, { 50,{ 66, 50}}, { 50,{ 66, 97}},
+    { 50,{ 66, 99}}, { 50,{ 66,101}}, { 50,{ 66,105}}, { 50,{ 66,111}},
+    { 50,{ 66,115}}, { 50,{ 66,116}}, { 29,{ 66,  0}}, { 29,{ 66,  0}},
+    { 29,{ 66,  0}}, { 29,{ 66,  0}}, { 29,{ 66,  0}}, { 29,{ 66,  0}},
+    { 29,{ 66,  0}}, { 29,{ 66,  0}}, { 29,{ 66,  0}}, { 29,{ 66,  0}},
+    { 29,{ 66,  0}}, { 29,{ 66,  0}}, { 29,{ 66,  0}}, { 29,{ 66,  0}},
+    { 29,{ 66,  0}}, { 29,{ 66,  0}}, { 29,{ 66,  0}}, { 29,{ 66,  0}},
+    { 29,{ 66,  0}}, { 29,{ 66,  0}}, { 29,{ 66,  0}}, { 29,{ 66,  0}},
+    { 50,{ 67, 48}}, { 50,{ 67, 49}}, { 50,{ 67, 50}}, { 50,{ 67, 97}},
+    { 50,{ 67, 99}}, { 50,{ 67,101}}, { 50,{ 67,105}}, { 50,{ 67,111}},
+    { 50,{ 67,115}}, { 50,{ 67,116}}, { 29,{ 67,  0}}, { 29,{ 67,  0}},
+    { 29,{ 67,  0}}, { 29,{ 67,  0}}, { 29,{ 67,  0}}, { 29,{ 67,  0}},
+    { 29,{ 67,  0}}, { 29,{ 67,  0}}, { 29,{ 67,  0}}, { 29,{ 67,  0}},
+    { 29,{ 67,  0}}, { 29,{ 67,  0}}, { 29,{ 67,  0}}, { 29,{ 67,  0}},
+    { 29,{ 67,  0}}, { 29,{ 67,  0}}, { 29,{ 67,  0}}, { 29,{ 67,  0}},
+    { 29,{ 67,  0}}, { 29,{ 67,  0}}, { 29,{ 67,  0}}, { 29,{ 67,  0}},
+    { 50,{ 68, 48}}, { 50,{ 68, 49}}, { 50,{ 68, 50}}, { 50,{ 68, 97}},
+    { 50,{ 68, 99}}, { 50,{ 68,101}}, { 50,{ 68,105}}, { 50,{ 68,111}},
+    { 50,{ 68,115}}, { 50,{ 68,116}}, { 29,{ 68,  0}}, { 29,{ 68,  0}},
+    { 29,{ 68,  0}}, { 29,{ 68,  0}}, { 29,{ 68,  0}}, { 29,{ 68,  0}},
+    { 29,{ 68,  0}}, { 29,{ 68,  0}}, { 29,{ 68,  0}}, { 29,{ 68,  0}},
+    { 29,{ 68,  0}}, { 29,{ 68,  0}}, { 29,{ 68,  0}}, { 29,{ 68,  0}},
+    { 29,{ 68,  0}}, { 29,{ 68,  0}}, { 29,{ 68,  0}}, { 29,{ 68,  0}},
+    { 29,{ 68,  0}}, { 29,{ 68,  0}}, { 29,{ 68,  0}}, { 29,{ 68,  0}},
+    { 50,{ 69, 48}}, { 50,{ 69, 49}}, { 50,{ 69, 50}}, { 50,{ 69, 97}},
+    { 50,{ 69, 99}}, { 50,{ 69,101}}, { 50,{ 69,105}}, { 50,{ 69,111}},
+    { 50,{ 69,115}}, { 50,{ 69,116}}, { 29,{ 69,  0}}, { 29,{ 69,  0}},
+    { 29,{ 69,  0}}, { 29,{ 69,  0}}, { 29,{ 69,  0}}, { 29,{ 69,  0}},
+    { 29,{ 69,  0}}, { 29,{ 69,  0}}, { 29,{ 69,  0}}, { 29,{ 69,  0}},
+    { 29,{ 69,  0}}, { 29,{ 69,  0}}, { 29,{ 69,  0}}, { 29,{ 69,  0}},
+    { 29,{ 69,  0}}, { 29,{ 69,  0}}, { 29,{ 69,  0}}, { 29,{ 69,  0}},
+    { 29,{ 69,  0}}, { 29,{ 69,  0}}, { 29,{ 69,  0}}, { 29,{ 69,  0}},
+    { 50,{ 70, 48}}, { 50,{ 70, 49}}, { 50,{ 70, 50}}, { 50,{ 70, 97}},
+    { 50,{ 70, 99}}, { 50,{ 70,101}}, { 50,{ 70,105}}, { 50,{ 70,111}},
+    { 50,{ 70,115}}, { 50,{ 70,116}}, { 29,{ 70,  0}}, { 29,{ 70,  0}},
+    { 29,{ 70,  0}}, { 29,{ 70,  0}}, { 29,{ 70,  0}}, { 29,{ 70,  0}},
+    { 29,{ 70,  0}}, { 29,{ 70,  0}}, { 29,{ 70,  0}}, { 29,{ 70,  0}},
+    { 29,{ 70,  0}}, { 29,{ 70,  0}}, { 29,{ 70,  0}}, { 29,{ 70,  0}},
+    { 29,{ 70,  0}}, { 29,{ 70,  0}}, { 29,{ 70,  0}}, { 29,{ 70,  0}},
+    { 29,{ 70,  0}}, { 29,{ 70,  0}}, { 29,{ 70,  0}}, { 29,{ 70,  0}},
+    { 50,{ 71, 48}}, { 50,{ 71, 49}}, { 50,{ 71, 50}}, { 50,{ 71, 97}},
+    { 50,{ 71, 99}}, { 50,{ 71,101}}, { 50,{ 71,105}}, { 50,{ 71,111}},
+    { 50,{ 71,115}}, { 50,{ 71,116}}, { 29,{ 71,  0}}, { 29,{ 71,  0}},
+    { 29,{ 71,  0}}, { 29,{ 71,  0}}, { 29,{ 71,  0}}, { 29,{ 71,  0}},
+    { 29,{ 71,  0}}, { 29,{ 71,  0}}, { 29,{ 71,  0}}, { 29,{ 71,  0}},
+    { 29,{ 71,  0}}, { 29,{ 71,  0}}, { 29,{ 71,  0}}, { 29,{ 71,  0}},
+    { 29,{ 71,  0}}, { 29,{ 71,  0}}, { 29,{ 71,  0}}, { 29,{ 71,  0}},
+    { 29,{ 71,  0}}, { 29,{ 71,  0}}, { 29,{ 71,  0}}, { 29,{ 71,  0}},
+    { 50,{ 72, 48}}, { 50,{ 72, 49}}, { 50,{ 72, 50}}, { 50,{ 72, 97}},
+    { 50,{ 72, 99}}, { 50,{ 72,101}}, { 50,{ 72,105}}, { 50,{ 72,111}},
+    { 50,{ 72,115}}, { 50,{ 72,116}}, { 29,{ 72,  0}}, { 29,{ 72,  0}},
+    { 29,{ 72,  0}}, { 29,{ 72,  0}}, { 29,{ 72,  0}}, { 29,{ 72,  0}},
+    { 29,{ 72,  0}}, { 29,{ 72,  0}}, { 29,{ 72,  0}}, { 29,{ 72,  0}},
+    { 29,{ 72,  0}}, { 29,{ 72,  0}}, { 29,{ 72,  0}}, { 29,{ 72,  0}},
+    { 29,{ 72,  0}}, { 29,{ 72,  0}}, { 29,{ 72,  0}}, { 29,{ 72,  0}},
+    { 29,{ 72,  0}}, { 29,{ 72,  0}}, { 29,{ 72,  0}}, { 29,{ 72,  0}},
+    { 50,{ 73, 48}}, { 50,{ 73, 49}}, { 50,{ 73, 50}}, { 50,{ 73, 97}},
+    { 50,{ 73, 99}}, { 50,{ 73,101}}, { 50,{ 73,105}}, { 50,{ 73,111}},
+    { 50,{ 73,115}}, { 50,{ 73,116}}, { 29,{ 73,  0}}, { 29,{ 73,  0}},
+    { 29,{ 73,  0}}, { 29,{ 73,  0}}, { 29,{ 73,  0}}, { 29,{ 73,  0}},
+    { 29,{ 73,  0}}, { 29,{ 73,  0}}, { 29,{ 73,  0}}, { 29,{ 73,  0}},
+    { 29,{ 73,  0}}, { 29,{ 73,  0}}, { 29,{ 73,  0}}, { 29,{ 73,  0}},
+    { 29,{ 73,  0}}, { 29,{ 73,  0}}, { 29,{ 73,  0}}, { 29,{ 73,  0}},
+    { 29,{ 73,  0}}, { 29,{ 73,  0}}, { 29,{ 73,  0}}, { 29,{ 73,  0}},
+    { 50,{ 74, 48}}, { 50,{ 74, 49}}, { 50,{ 74, 50}}, { 50,{ 74, 97}},
+    { 50,{ 74, 99}}, { 50,{ 74,101}}, { 50,{ 74,105}}, { 50,{ 74,111}},
+    { 50,{ 74,115}}, { 50,{ 74,116}}, { 29,{ 74,  0}}, { 29,{ 74,  0}},
+    { 29,{ 74,  0}}, { 29,{ 74,  0}}, { 29,{ 74,  0}}, { 29,{ 74,  0}},
+    { 29,{ 74,  0}}, { 29,{ 74,  0}}, { 29,{ 74,  0}}, { 29,{ 74,  0}},
+    { 29,{ 74,  0}}, { 29,{ 74,  0}}, { 29,{ 74,  0}}, { 29,{ 74,  0}},
+    { 29,{ 74,  0}}, { 29,{ 74,  0}}, { 29,{ 74,  0}}, { 29,{ 74,  0}},
+    { 29,{ 74,  0}}, { 29,{ 74,  0}}, { 29,{ 74,  0}}, { 29,{ 74,  0}},
+    { 50,{ 75, 48}}, { 50,{ 75, 49}}, { 50,{ 75, 50}}, { 50,{ 75, 97}},
+    { 50,{ 75, 99}}, { 50,{ 75,101}}, { 50,{ 75,105}}, { 50,{ 75,111}},
+    { 50,{ 75,115}}, { 50,{ 75,116}}, { 29,{ 75,  0}}, { 29,{ 75,  0}},
+    { 29,{ 75,  0}}, { 29,{ 75,  0}}, { 29,{ 75,  0}}, { 29,{ 75,  0}},
+    { 29,{ 75,  0}}, { 29,{ 75,  0}}, { 29,{ 75,  0}}, { 29,{ 75,  0}},
+    { 29,{ 75,  0}}, { 29,{ 75,  0}}, { 29,{ 75,  0}}, { 29,{ 75,  0}},
+    { 29,{ 75,  0}}, { 29,{ 75,  0}}, { 29,{ 75,  0}}, { 29,{ 75,  0}},
+    { 29,{ 75,  0}}, { 29,{ 75,  0}}, { 29,{ 75,  0}}, { 29,{ 75,  0}},
+    { 50,{ 76, 48}}, { 50,{ 76, 49}}, { 50,{ 76, 50}}, { 50,{ 76, 97}},
+    { 50,{ 76, 99}}, { 50,{ 76,101}}, { 50,{ 76,105}}, { 50,{ 76,111}},
+    { 50,{ 76,115}}, { 50,{ 76,116}}, { 29,{ 76,  0}}, { 29,{ 76,  0}},
+    { 29,{ 76,  0}}, { 29,{ 76,  0}}, { 29,{ 76,  0}}, { 29,{ 76,  0}},
+    { 29,{ 76,  0}}, { 29,{ 76,  0}}, { 29,{ 76,  0}}, { 29,{ 76,  0}},
+    { 29,{ 76,  0}}, { 29,{ 76,  0}}, { 29,{ 76,  0}}, { 29,{ 76,  0}},
+    { 29,{ 76,  0}}, { 29,{ 76,  0}}, { 29,{ 76,  0}}, { 29,{ 76,  0}},
+    { 29,{ 76,  0}}, { 29,{ 76,  0}}, { 29,{ 76,  0}}, { 29,{ 76,  0}},
+    { 50,{ 77, 48}}, { 50,{ 77, 49}}, { 50,{ 77, 50}}, { 50,{ 77, 97}},
+    { 50,{ 77, 99}}, { 50,{ 77,101}}, { 50,{ 77,105}}, { 50,{ 77,111}},
+    { 50,{ 77,115}}, { 50,{ 77,116}}, { 29,{ 77,  0}}, { 29,{ 77,  0}},
+    { 29,{ 77,  0}}, { 29,{ 77,  0}}, { 29,{ 77,  0}}, { 29,{ 77,  0}},
+    { 29,{ 77,  0}}, { 29,{ 77,  0}}, { 29,{ 77,  0}}, { 29,{ 77,  0}},
+    { 29,{ 77,  0}}, { 29,{ 77,  0}}, { 29,{ 77,  0}}, { 29,{ 77,  0}},
+    { 29,{ 77,  0}}, { 29,{ 77,  0}}, { 29,{ 77,  0}}, { 29,{ 77,  0}},
+    { 29,{ 77,  0}}, { 29,{ 77,  0}}, { 29,{ 77,  0}}, { 29,{ 77,  0}},
+    { 50,{ 78, 48}}, { 50,{ 78, 49}}, { 50,{ 78, 50}}, { 50,{ 78, 97}},
+    { 50,{ 78, 99}}, { 50,{ 78,101}}, { 50,{ 78,105}}, { 50,{ 78,111}},
+    { 50,{ 78,115}}, { 50,{ 78,116}}, { 29,{ 78,  0}}, { 29,{ 78,  0}},
+    { 29,{ 78,  0}}, { 29,{ 78,  0}}, { 29,{ 78,  0}}, { 29,{ 78,  0}},
+    { 29,{ 78,  0}}, { 29,{ 78,  0}}, { 29,{ 78,  0}}, { 29,{ 78,  0}},
+    { 29,{ 78,  0}}, { 29,{ 78,  0}}, { 29,{ 78,  0}}, { 29,{ 78,  0}},
+    { 29,{ 78,  0}}, { 29,{ 78,  0}}, { 29,{ 78,  0}}, { 29,{ 78,  0}},
+    { 29,{ 78,  0}}, { 29,{ 78,  0}}, { 29,{ 78,  0}}, { 29,{ 78,  0}},
+    { 50,{ 79, 48}}, { 50,{ 79, 49}}, { 50,{ 79, 50}}, { 50,{ 79, 97}},
+    { 50,{ 79, 99}}, { 50,{ 79,101}}, { 50,{ 79,105}}, { 50,{ 79,111}},
+    { 50,{ 79,115}}, { 50,{ 79,116}}, { 29,{ 79,  0}}, { 29,{ 79,  0}},
+    { 29,{ 79,  0}}, { 29,{ 79,  0}}, { 29,{ 79,  0}}, { 29,{ 79,  0}},
+    { 29,{ 79,  0}}, { 29,{ 79,  0}}, { 29,{ 79,  0}}, { 29,{ 79,  0}},
+    { 29,{ 79,  0}}, { 29,{ 79,  0}}, { 29,{ 79,  0}}, { 29,{ 79,  0}},
+    { 29,{ 79,  0}}, { 29,{ 79,  0}}, { 29,{ 79,  0}}, { 29,{ 79,  0}},
+    { 29,{ 79,  0}}, { 29,{ 79,  0}}, { 29,{ 79,  0}}, { 29,{ 79,  0}},
+    { 50,{ 80, 48}}, { 50,{ 80, 49}}, { 50,{ 80, 50}}, { 50,{ 80, 97}},
+    { 50,{ 80, 99}}, { 50,{ 80,101}}, { 50,{ 80,105}}, { 50,{ 80,111}},
+    { 50,{ 80,115}}, { 50,{ 80,116}}, { 29,{ 80,  0}}, { 29,{ 80,  0}},
+    { 29,{ 80,  0}}, { 29,{ 80,  0}}, { 29,{ 80,  0}}, { 29,{ 80,  0}},
+    { 29,{ 80,  0}}, { 29,{ 80,  0}}, { 29,{ 80,  0}}, { 29,{ 80,  0}},
+    { 29,{ 80,  0}}, { 29,{ 80,  0}}, { 29,{ 80,  0}}, { 29,{ 80,  0}},
+    { 29,{ 80,  0}}, { 29,{ 80,  0}}, { 29,{ 80,  0}}, { 29,{ 80,  0}},
+    { 29,{ 80,  0}}, { 29,{ 80,  0}}, { 29,{ 80,  0}}, { 29,{ 80,  0}},
+    { 50,{ 81, 48}}, { 50,{ 81, 49}}, { 50,{ 81, 50}}, { 50,{ 81, 97}},
+    { 50,{ 81, 99}}, { 50,{ 81,101}}, { 50,{ 81,105}}, { 50,{ 81,111}},
+    { 50,{ 81,115}}, { 50,{ 81,116}}, { 29,{ 81,  0}}, { 29,{ 81,  0}},
+    { 29,{ 81,  0}}, { 29,{ 81,  0}}, { 29,{ 81,  0}}, { 29,{ 81,  0}},
+    { 29,{ 81,  0}}, { 29,{ 81,  0}}, { 29,{ 81,  0}}, { 29,{ 81,  0}},
+    { 29,{ 81,  0}}, { 29,{ 81,  0}}, { 29,{ 81,  0}}, { 29,{ 81,  0}},
+    { 29,{ 81,  0}}, { 29,{ 81,  0}}, { 29,{ 81,  0}}, { 29,{ 81,  0}},
+    { 29,{ 81,  0}}, { 29,{ 81,  0}}, { 29,{ 81,  0}}, { 29,{ 81,  0}},
+    { 50,{ 82, 48}}, { 50,{ 82, 49}}, { 50,{ 82, 50}}, { 50,{ 82, 97}},
+    { 50,{ 82, 99}}, { 50,{ 82,101}}, { 50,{ 82,105}}, { 50,{ 82,111}},
+    { 50,{ 82,115}}, { 50,{ 82,116}}, { 29,{ 82,  0}}, { 29,{ 82,  0}},
+    { 29,{ 82,  0}}, { 29,{ 82,  0}}, { 29,{ 82,  0}}, { 29,{ 82,  0}},
+    { 29,{ 82,  0}}, { 29,{ 82,  0}}, { 29,{ 82,  0}}, { 29,{ 82,  0}},
+    { 29,{ 82,  0}}, { 29,{ 82,  0}}, { 29,{ 82,  0}}, { 29,{ 82,  0}},
+    { 29,{ 82,  0}}, { 29,{ 82,  0}}, { 29,{ 82,  0}}, { 29,{ 82,  0}},
+    { 29,{ 82,  0}}, { 29,{ 82,  0}}, { 29,{ 82,  0}}, { 29,{ 82,  0}},
+    { 50,{ 83, 48}}, { 50,{ 83, 49}}, { 50,{ 83, 50}}, { 50,{ 83, 97}},
+    { 50,{ 83, 99}}, { 50,{ 83,101}}, { 50,{ 83,105}}, { 50,{ 83,111}},
+    { 50,{ 83,115}}, { 50,{ 83,116}}, { 29,{ 83,  0}}, { 29,{ 83,  0}},
+    { 29,{ 83,  0}}, { 29,{ 83,  0}}, { 29,{ 83,  0}}, { 29,{ 83,  0}},
+    { 29,{ 83,  0}}, { 29,{ 83,  0}}, { 29,{ 83,  0}}, { 29,{ 83,  0}},
+    { 29,{ 83,  0}}, { 29,{ 83,  0}}, { 29,{ 83,  0}}, { 29,{ 83,  0}},
+    { 29,{ 83,  0}}, { 29,{ 83,  0}}, { 29,{ 83,  0}}, { 29,{ 83,  0}},
+    { 29,{ 83,  0}}, { 29,{ 83,  0}}, { 29,{ 83,  0}}, { 29,{ 83,  0}},
+    { 50,{ 84, 48}}, { 50,{ 84, 49}}, { 50,{ 84, 50}}, { 50,{ 84, 97}},
+    { 50,{ 84, 99}}, { 50,{ 84,101}}, { 50,{ 84,105}}, { 50,{ 84,111}},
+    { 50,{ 84,115}}, { 50,{ 84,116}}, { 29,{ 84,  0}}, { 29,{ 84,  0}},
+    { 29,{ 84,  0}}, { 29,{ 84,  0}}, { 29,{ 84,  0}}, { 29,{ 84,  0}},
+    { 29,{ 84,  0}}, { 29,{ 84,  0}}, { 29,{ 84,  0}}, { 29,{ 84,  0}},
+    { 29,{ 84,  0}}, { 29,{ 84,  0}}, { 29,{ 84,  0}}, { 29,{ 84,  0}},
+    { 29,{ 84,  0}}, { 29,{ 84,  0}}, { 29,{ 84,  0}}, { 29,{ 84,  0}},
+    { 29,{ 84,  0}}, { 29,{ 84,  0}}, { 29,{ 84,  0}}, { 29,{ 84,  0}},
+    { 50,{ 85, 48}}, { 50,{ 85, 49}}, { 50,{ 85, 50}}, { 50,{ 85, 97}},
+    { 50,{ 85, 99}}, { 50,{ 85,101}}, { 50,{ 85,105}}, { 50,{ 85,111}},
+    { 50,{ 85,115}}, { 50,{ 85,116}}, { 29,{ 85,  0}}, { 29,{ 85,  0}},
+    { 29,{ 85,  0}}, { 29,{ 85,  0}}, { 29,{ 85,  0}}, { 29,{ 85,  0}},
+    { 29,{ 85,  0}}, { 29,{ 85,  0}}, { 29,{ 85,  0}}, { 29,{ 85,  0}},
+    { 29,{ 85,  0}}, { 29,{ 85,  0}}, { 29,{ 85,  0}}, { 29,{ 85,  0}},
+    { 29,{ 85,  0}}, { 29,{ 85,  0}}, { 29,{ 85,  0}}, { 29,{ 85,  0}},
+    { 29,{ 85,  0}}, { 29,{ 85,  0}}, { 29,{ 85,  0}}, { 29,{ 85,  0}},
+    { 50,{ 86, 48}}, { 50,{ 86, 49}}, { 50,{ 86, 50}}, { 50,{ 86, 97}},
+    { 50,{ 86, 99}}, { 50,{ 86,101}}, { 50,{ 86,105}}, { 50,{ 86,111}},
+    { 50,{ 86,115}}, { 50,{ 86,116}}, { 29,{ 86,  0}}, { 29,{ 86,  0}},
+    { 29,{ 86,  0}}, { 29,{ 86,  0}}, { 29,{ 86,  0}}, { 29,{ 86,  0}},
+    { 29,{ 86,  0}}, { 29,{ 86,  0}}, { 29,{ 86,  0}}, { 29,{ 86,  0}},
+    { 29,{ 86,  0}}, { 29,{ 86,  0}}, { 29,{ 86,  0}}, { 29,{ 86,  0}},
+    { 29,{ 86,  0}}, { 29,{ 86,  0}}, { 29,{ 86,  0}}, { 29,{ 86,  0}},
+    { 29,{ 86,  0}}, { 29,{ 86,  0}}, { 29,{ 86,  0}}, { 29,{ 86,  0}},
+    { 50,{ 87, 48}}, { 50,{ 87, 49}}, { 50,{ 87, 50}}, { 50,{ 87, 97}},
+    { 50,{ 87, 99}}, { 50,{ 87,101}}, { 50,{ 87,105}}, { 50,{ 87,111}},
+    { 50,{ 87,115}}, { 50,{ 87,116}}, { 29,{ 87,  0}}, { 29,{ 87,  0}},
+    { 29,{ 87,  0}}, { 29,{ 87,  0}}, { 29,{ 87,  0}}, { 29,{ 87,  0}},
+    { 29,{ 87,  0}}, { 29,{ 87,  0}}, { 29,{ 87,  0}}, { 29,{ 87,  0}},
+    { 29,{ 87,  0}}, { 29,{ 87,  0}}, { 29,{ 87,  0}}, { 29,{ 87,  0}},
+    { 29,{ 87,  0}}, { 29,{ 87,  0}}, { 29,{ 87,  0}}, { 29,{ 87,  0}},
+    { 29,{ 87,  0}}, { 29,{ 87,  0}}, { 29,{ 87,  0}}, { 29,{ 87,  0}},
+    { 50,{ 89, 48}}, { 50,{ 89, 49}}, { 50,{ 89, 50}}, { 50,{ 89, 97}},
+    { 50,{ 89, 99}}, { 50,{ 89,101}}, { 50,{ 89,105}}, { 50,{ 89,111}},
+    { 50,{ 89,115}}, { 50,{ 89,116}}, { 29,{ 89,  0}}, { 29,{ 89,  0}},
+    { 29,{ 89,  0}}, { 29,{ 89,  0}}, { 29,{ 89,  0}}, { 29,{ 89,  0}},
+    { 29,{ 89,  0}}, { 29,{ 89,  0}}, { 29,{ 89,  0}}, { 29,{ 89,  0}},
+    { 29,{ 89,  0}}, { 29,{ 89,  0}}, { 29,{ 89,  0}}, { 29,{ 89,  0}},
+    { 29,{ 89,  0}}, { 29,{ 89,  0}}, { 29,{ 89,  0}}, { 29,{ 89,  0}},
+    { 29,{ 89,  0}}, { 29,{ 89,  0}}, { 29,{ 89,  0}}, { 29,{ 89,  0}},
+    { 50,{106, 48}}, { 50,{106, 49}}, { 50,{106, 50}}, { 50,{106, 97}},
+    { 50,{106, 99}}, { 50,{106,101}}, { 50,{106,105}}, { 50,{106,111}},
+    { 50,{106,115}}, { 50,{106,116}}, { 29,{106,  0}}, { 29,{106,  0}},
+    { 29,{106,  0}}, { 29,{106,  0}}, { 29,{106,  0}}, { 29,{106,  0}},
+    { 29,{106,  0}}, { 29,{106,  0}}, { 29,{106,  0}}, { 29,{106,  0}},
+    { 29,{106,  0}}, { 29,{106,  0}}, { 29,{106,  0}}, { 29,{106,  0}},
+    { 29,{106,  0}}, { 29,{106,  0}}, { 29,{106,  0}}, { 29,{106,  0}},
+    { 29,{106,  0}}, { 29,{106,  0}}, { 29,{106,  0}}, { 29,{106,  0}},
+    { 50,{107, 48}}, { 50,{107, 49}}, { 50,{107, 50}}, { 50,{107, 97}},
+    { 50,{107, 99}}, { 50,{107,101}}, { 50,{107,105}}, { 50,{107,111}},
+    { 50,{107,115}}, { 50,{107,116}}, { 29,{107,  0}}, { 29,{107,  0}},
+    { 29,{107,  0}}, { 29,{107,  0}}, { 29,{107,  0}}, { 29,{107,  0}},
+    { 29,{107,  0}}, { 29,{107,  0}}, { 29,{107,  0}}, { 29,{107,  0}},
+    { 29,{107,  0}}, { 29,{107,  0}}, { 29,{107,  0}}, { 29,{107,  0}},
+    { 29,{107,  0}}, { 29,{107,  0}}, { 29,{107,  0}}, { 29,{107,  0}},
+    { 29,{107,  0}}, { 29,{107,  0}}, { 29,{107,  0}}, { 29,{107,  0}},
+    { 50,{113, 48}}, { 50,{113, 49}}, { 50,{113, 50}}, { 50,{113, 97}},
+    { 50,{113, 99}}, { 50,{113,101}}, { 50,{113,105}}, { 50,{113,111}},
+    { 50,{113,115}}, { 50,{113,116}}, { 29,{113,  0}}, { 29,{113,  0}},
+    { 29,{113,  0}}, { 29,{113,  0}}, { 29,{113,  0}}, { 29,{113,  0}},
+    { 29,{113,  0}}, { 29,{113,  0}}, { 29,{113,  0}}, { 29,{113,  0}},
+    { 29,{113,  0}}, { 29,{113,  0}}, { 29,{113,  0}}, { 29,{113,  0}},
+    { 29,{113,  0}}, { 29,{113,  0}}, { 29,{113,  0}}, { 29,{113,  0}},
+    { 29,{113,  0}}, { 29,{113,  0}}, { 29,{113,  0}}, { 29,{113,  0}},
+    { 50,{118, 48}}, { 50,{118, 49}}, { 50,{118, 50}}, { 50,{118, 97}},
+    { 50,{118, 99}}, { 50,{118,101}}, { 50,{118,105}}, { 50,{118,111}},
+    { 50,{118,115}}, { 50,{118,116}}, { 29,{118,  0}}, { 29,{118,  0}},
+    { 29,{118,  0}}, { 29,{118,  0}}, { 29,{118,  0}}, { 29,{118,  0}},
+    { 29,{118,  0}}, { 29,{118,  0}}, { 29,{118,  0}}, { 29,{118,  0}},
+    { 29,{118,  0}}, { 29,{118,  0}}, { 29,{118,  0}}, { 29,{118,  0}},
+    { 29,{118,  0}}, { 29,{118,  0}}, { 29,{118,  0}}, { 29,{118,  0}},
+    { 29,{118,  0}}, { 29,{118,  0}}, { 29,{118,  0}}, { 29,{118,  0}},
+    { 50,{119, 48}}, { 50,{119, 49}}, { 50,{119, 50}}, { 50,{119, 97}},
+    { 50,{119, 99}}, { 50,{119,101}}, { 50,{119,105}}, { 50,{119,111}},
+    { 50,{119,115}}, { 50,{119,116}}, { 29,{119,  0}}, { 29,{119,  0}},
+    { 29,{119,  0}}, { 29,{119,  0}}, { 29,{119,  0}}, { 29,{119,  0}},
+    { 29,{119,  0}}, { 29,{119,  0}}, { 29,{119,  0}}, { 29,{119,  0}},
+    { 29,{119,  0}}, { 29,{119,  0}}, { 29,{119,  0}}, { 29,{119,  0}},
+    { 29,{119,  0}}, { 29,{119,  0}}, { 29,{119,  0}}, { 29,{119,  0}},
+    { 29,{119,  0}}, { 29,{119,  0}}, { 29,{119,  0}}, { 29,{119,  0}},
+    { 50,{120, 48}}, { 50,{120, 49}}, { 50,{120, 50}}, { 50,{120, 97}},
+    { 50,{120, 99}}, { 50,{120,101}}, { 50,{120,105}}, { 50,{120,111}},
+    { 50,{120,115}}, { 50,{120,116}}, { 29,{120,  0}}, { 29,{120,  0}},
+    { 29,{120,  0}}, { 29,{120,  0}}, { 29,{120,  0}}, { 29,{120,  0}},
+    { 29,{120,  0}}, { 29,{120,  0}}, { 29,{120,  0}}, { 29,{120,  0}},
+    { 29,{120,  0}}, { 29,{120,  0}}, { 29,{120,  0}}, { 29,{120,  0}},
+    { 29,{120,  0}}, { 29,{120,  0}}, { 29,{120,  0}}, { 29,{120,  0}},
+    { 29,{120,  0}}, { 29,{120,  0}}, { 29,{120,  0}}, { 29,{120,  0}},
+    { 50,{121, 48}}, { 50,{121, 49}}, { 50,{121, 50}}, { 50,{121, 97}},
+    { 50,{121, 99}}, { 50,{121,101}}, { 50,{121,105}}, { 50,{121,111}},
+    { 50,{121,115}}, { 50,{121,116}}, { 29,{121,  0}}, { 29,{121,  0}},
+    { 29,{121,  0}}, { 29,{121,  0}}, { 29,{121,  0}}, { 29,{121,  0}},
+    { 29,{121,  0}}, { 29,{121,  0}}, { 29,{121,  0}}, { 29,{121,  0}},
+    { 29,{121,  0}}, { 29,{121,  0}}, { 29,{121,  0}}, { 29,{121,  0}},
+    { 29,{121,  0}}, { 29,{121,  0}}, { 29,{121,  0}}, { 29,{121,  0}},
+    { 29,{121,  0}}, { 29,{121,  0}}, { 29,{121,  0}}, { 29,{121,  0}},
+    { 50,{122, 48}}, { 50,{122, 49}}, { 50,{122, 50}}, { 50,{122, 97}},
+    { 50,{122, 99}}, { 50,{122,101}}, { 50,{122,105}}, { 50,{122,111}},
+    { 50,{122,115}}, { 50,{122,116}}, { 29,{122,  0}}, { 29,{122,  0}},
+    { 29,{122,  0}}, { 29,{122,  0}}, { 29,{122,  0}}, { 29,{122,  0}},
+    { 29,{122,  0}}, { 29,{122,  0}}, { 29,{122,  0}}, { 29,{122,  0}},
+    { 29,{122,  0}}, { 29,{122,  0}}, { 29,{122,  0}}, { 29,{122,  0}},
+    { 29,{122,  0}}, { 29,{122,  0}}, { 29,{122,  0}}, { 29,{122,  0}},
+    { 29,{122,  0}}, { 29,{122,  0}}, { 29,{122,  0}}, { 29,{122,  0}},
+    { 33,{ 38,  0}}, { 33,{ 38,  0}}, { 33,{ 38,  0}}, { 33,{ 38,  0}},
+    { 33,{ 38,  0}}, { 33,{ 38,  0}}, { 33,{ 38,  0}}, { 33,{ 38,  0}},
+    { 33,{ 38,  0}}, { 33,{ 38,  0}}, { 33,{ 38,  0}}, { 33,{ 38,  0}},
+    { 33,{ 38,  0}}, { 33,{ 38,  0}}, { 33,{ 38,  0}}, { 33,{ 38,  0}},
+    { 33,{ 42,  0}}, { 33,{ 42,  0}}, { 33,{ 42,  0}}, { 33,{ 42,  0}},
+    { 33,{ 42,  0}}, { 33,{ 42,  0}}, { 33,{ 42,  0}}, { 33,{ 42,  0}},
+    { 33,{ 42,  0}}, { 33,{ 42,  0}}, { 33,{ 42,  0}}, { 33,{ 42,  0}},
+    { 33,{ 42,  0}}, { 33,{ 42,  0}}, { 33,{ 42,  0}}, { 33,{ 42,  0}},
+    { 33,{ 44,  0}}, { 33,{ 44,  0}}, { 33,{ 44,  0}}, { 33,{ 44,  0}},
+    { 33,{ 44,  0}}, { 33,{ 44,  0}}, { 33,{ 44,  0}}, { 33,{ 44,  0}},
+    { 33,{ 44,  0}}, { 33,{ 44,  0}}, { 33,{ 44,  0}}, { 33,{ 44,  0}},
+    { 33,{ 44,  0}}, { 33,{ 44,  0}}, { 33,{ 44,  0}}, { 33,{ 44,  0}},
+    { 33,{ 59,  0}}, { 33,{ 59,  0}}, { 33,{ 59,  0}}, { 33,{ 59,  0}},
+    { 33,{ 59,  0}}, { 33,{ 59,  0}}, { 33,{ 59,  0}}, { 33,{ 59,  0}},
+    { 33,{ 59,  0}}, { 33,{ 59,  0}}, { 33,{ 59,  0}}, { 33,{ 59,  0}},
+    { 33,{ 59,  0}}, { 33,{ 59,  0}}, { 33,{ 59,  0}}, { 33,{ 59,  0}},
+    { 33,{ 88,  0}}, { 33,{ 88,  0}}, { 33,{ 88,  0}}, { 33,{ 88,  0}},
+    { 33,{ 88,  0}}, { 33,{ 88,  0}}, { 33,{ 88,  0}}, { 33,{ 88,  0}},
+    { 33,{ 88,  0}}, { 33,{ 88,  0}}, { 33,{ 88,  0}}, { 33,{ 88,  0}},
+    { 33,{ 88,  0}}, { 33,{ 88,  0}}, { 33,{ 88,  0}}, { 33,{ 88,  0}},
+    { 33,{ 90,  0}}, { 33,{ 90,  0}}, { 33,{ 90,  0}}, { 33,{ 90,  0}},
+    { 33,{ 90,  0}}, { 33,{ 90,  0}}, { 33,{ 90,  0}}, { 33,{ 90,  0}},
+    { 33,{ 90,  0}}, { 33,{ 90,  0}}, { 33,{ 90,  0}}, { 33,{ 90,  0}},
+    { 33,{ 90,  0}}, { 33,{ 90,  0}}, { 33,{ 90,  0}}, { 33,{ 90,  0}},
+    { 41,{ 33,  0}}, { 41,{ 33,  0}}, { 41,{ 33,  0}}, { 41,{ 33,  0}},
+    { 41,{ 34,  0}}, { 41,{ 34,  0}}, { 41,{ 34,  0}}, { 41,{ 34,  0}},
+    { 41,{ 40,  0}}, { 41,{ 40,  0}}, { 41,{ 40,  0}}, { 41,{ 40,  0}},
+    { 41,{ 41,  0}}, { 41,{ 41,  0}}, { 41,{ 41,  0}}, { 41,{ 41,  0}},
+    { 41,{ 63,  0}}, { 41,{ 63,  0}}, { 41,{ 63,  0}}, { 41,{ 63,  0}},
+    { 45,{ 39,  0}}, { 45,{ 39,  0}}, { 45,{ 43,  0}}, { 45,{ 43,  0}},
+    { 45,{124,  0}}, { 45,{124,  0}}, { 49,{ 35,  0}}, { 49,{ 62,  0}},
+    {  0,{  0,  0}}, {  0,{  0,  0}}, {  0,{  0,  0}}, {  0,{  0,  0}}
+};
+#endif
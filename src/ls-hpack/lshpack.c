@@ -1414,10 +1414,6 @@ hdec_huff_dec4bits (uint8_t src_4bits, unsigned char *dst,
 }
 
 
-#if !LS_HPACK_USE_LARGE_TABLES
-#define lshpack_dec_huff_decode_full lshpack_dec_huff_decode
-#endif
-
 static int
 lshpack_dec_huff_decode_full (const unsigned char *src, int src_len,
                                             unsigned char *dst, int dst_len)
@@ -2076,6 +2072,62 @@ lshpack_dec_huff_decode (const unsigned char *src, int src_len,
     else
         return r;
 }
+#else
+/*(lighttpd customization)*/
+/* Decode with 16 KB (12-bit) hdecs12[] table, outputting 1 or 2 bytes per
+ * lookup, instead of 4 bits at a time in lshpack_dec_huff_decode_full().
+ * Each 64-bit load of input provides at least 57 bits, enough for 4 lookups.
+ *
+ * Codes longer than 12 bits, final bytes of input (EOS padding), and end of
+ * dst are handled by lshpack_dec_huff_decode_full(), restarting at previous
+ * byte boundary.
+ */
+static int
+lshpack_dec_huff_decode (const unsigned char *src, int src_len,
+                                            unsigned char *dst, int dst_len)
+{
+    unsigned char *const orig_dst = dst;
+    const unsigned char *const src_end = src + src_len;
+    unsigned char *const dst_end = dst + dst_len;
+    int bits = 0; /* bits consumed in src[0] */
+    struct hdec12 hdec;
+    uint64_t x;
+    int r, i;
+
+    while (src_end - src >= 8 && dst_end - dst >= 8)
+    {
+        x = (uint64_t)src[0] << 56 | (uint64_t)src[1] << 48
+          | (uint64_t)src[2] << 40 | (uint64_t)src[3] << 32
+          | (uint64_t)src[4] << 24 | (uint64_t)src[5] << 16
+          | (uint64_t)src[6] <<  8 | (uint64_t)src[7];
+        x <<= bits;
+        for (i = 0; i < 4; ++i)
+        {
+            hdec = hdecs12[x >> 52];
+            if (0 == hdec.lens)
+                break; /* code longer than 12 bits */
+            dst[0] = hdec.out[0];
+            dst[1] = hdec.out[1];
+            dst += hdec.lens & 3;
+            x <<= hdec.lens >> 2;
+            bits += hdec.lens >> 2;
+        }
+        src += bits >> 3;
+        bits &= 7;
+        if (i < 4)
+            break;
+    }
+
+    /* Find previous byte boundary and finish decoding thence. */
+    while (bits & 7)
+        bits -= encode_table[ *--dst ].bits;
+    src += bits / 8; /*(bits <= 0)*/
+    r = lshpack_dec_huff_decode_full(src, src_end - src, dst, dst_end - dst);
+    if (r >= 0)
+        return dst - orig_dst + r;
+    else
+        return r;
+}
 #endif
 #if __GNUC__ && (__clang__ || __GNUC__ >= 5) && !defined(__COVERITY__)
 #pragma GCC diagnostic pop  /* -Wunknown-pragmas */
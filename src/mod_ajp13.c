@@ -642,7 +642,7 @@ ajp13_create_env (handler_ctx * const hctx)
         ajp13_stdin_append_n(hctx, AJP13_MAX_PACKET_SIZE-4);
         hctx->request_id = 0; /* overloaded value; see ajp13_stdin_append_n() */
 
-        plugin_stats_inc("ajp13.requests");
+        ++(*hctx->host->stats_requests); /* "ajp13.requests" */
         return HANDLER_GO_ON;
     } while (0);
 
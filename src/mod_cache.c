@@ -0,0 +1,888 @@
+/*
+ * mod_cache - cache of responses (e.g. from backends) in memory and on disk
+ *
+ * Copyright(c) 2026 lighttpd contributors  All rights reserved
+ * License: BSD 3-clause (same as lighttpd)
+ */
+#include "first.h"
+
+#include <sys/types.h>
+#include "sys-dirent.h"
+#include "sys-stat.h"
+#include "sys-unistd.h" /* unlink() */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "algo_splaytree.h"
+#include "array.h"
+#include "base.h"
+#include "buffer.h"
+#include "chunk.h"
+#include "fdevent.h"
+#include "http_chunk.h"
+#include "http_date.h"
+#include "http_header.h"
+#include "log.h"
+#include "plugin.h"
+#include "response.h"
+
+/**
+ * cache responses which are explicitly cacheable by a shared cache
+ * (Cache-Control s-maxage or max-age, or Expires, or validators ETag or
+ *  Last-Modified for revalidation), honoring Vary.  Small responses are
+ * stored in memory and larger responses on disk (if cache.dir is set),
+ * each tier limited to a byte budget with least-recently-used eviction.
+ *
+ * Cache hits are sent from handle_uri_clean, so mod_cache must be listed
+ * in server.modules after modules which restrict access (e.g. mod_access,
+ * mod_auth) and before modules which handle requests in handle_uri_clean
+ * (e.g. mod_proxy).  Responses are stored from handle_response_start and
+ * only if the complete response is available then (i.e. not streamed).
+ * Only responses from handler modules (e.g. mod_proxy, mod_fastcgi,
+ * mod_magnet) are stored; static files are already served efficiently.
+ *
+ * Conditional request headers added by mod_cache to revalidate a stale
+ * entry are removed when the backend response is received, so that they
+ * are not seen by other modules (e.g. mod_accesslog) afterwards.
+ *
+ * The disk tier must be enabled with cache.disk-enable.  Cache files are
+ * written when the response is stored, which blocks the server while
+ * writing, so cache.dir should be on fast local storage.  Cache files
+ * left in cache.dir by previous server instances are removed at startup
+ * (only regular files owned by the server user, named as by mod_cache).
+ *
+ * Each process has its own cache (e.g. if server.max-worker is set)
+ *
+ * cache.enable         = "enable"         # (default: disable)
+ * cache.max-entry-size = 4096             # KB (default: 4096)
+ * cache.max-memory     = 64               # MB (default: 64) (global)
+ * cache.max-memory-entry-size = 64        # KB (default: 64) (global)
+ * cache.disk-enable    = "enable"         # (default: disable) (global)
+ * cache.dir            = "/var/cache/lighttpd/mod_cache" (global)
+ * cache.max-disk       = 1024             # MB (default: 1024) (global)
+ */
+
+typedef struct mod_cache_entry {
+    struct mod_cache_entry *next;      /* entries with same hash */
+    struct mod_cache_entry *lru_prev;
+    struct mod_cache_entry *lru_next;
+    int32_t hash;
+    uint8_t on_disk;
+    uint8_t has_validator;
+    uint8_t detached;                  /* removed from cache while pinned */
+    uint32_t refcnt;                   /* pinned by requests revalidating */
+    off_t size;                        /* body size */
+    off_t tsize;                       /* size accounted in tier */
+    unix_time64_t ctime;               /* (epoch) time stored or revalidated */
+    unix_time64_t expires;             /* (epoch) time when stale */
+    unix_time64_t lmtime;              /* Last-Modified */
+    buffer key;                        /* scheme://authority/target */
+    buffer vkey;                       /* request header values (Vary) */
+    buffer body;                       /* (!on_disk) */
+    buffer fn;                         /* (on_disk) */
+    array *headers;
+} mod_cache_entry;
+
+typedef struct {
+    mod_cache_entry *head;             /* most recently used */
+    mod_cache_entry *tail;             /* least recently used */
+    off_t bytes;
+    off_t max_bytes;
+} mod_cache_tier;
+
+typedef struct {
+    unsigned short enable;
+    unsigned int max_entry_size;       /* KB */
+} plugin_config;
+
+typedef struct {
+    PLUGIN_DATA;
+    plugin_config defaults;
+    plugin_config conf;
+
+    splay_tree *sptree; /* data in nodes of tree are (mod_cache_entry *) */
+    mod_cache_tier mem;
+    mod_cache_tier disk;
+    off_t max_mem_entry_size;
+    const buffer *cache_dir;
+    uint32_t seq;
+} plugin_data;
+
+enum {
+  MOD_CACHE_MISS,
+  MOD_CACHE_REVALIDATE,
+  MOD_CACHE_HIT
+};
+
+typedef struct {
+    int state;
+    int32_t hash;
+    buffer key;
+    mod_cache_entry *ce;               /* (MOD_CACHE_REVALIDATE) */
+} handler_ctx;
+
+__attribute_malloc__
+__attribute_returns_nonnull__
+static handler_ctx * handler_ctx_init(void) {
+    return ck_calloc(1, sizeof(handler_ctx));
+}
+
+static void mod_cache_entry_free (mod_cache_entry * const ce);
+
+static void handler_ctx_free(handler_ctx *hctx) {
+    mod_cache_entry * const ce = hctx->ce;
+    if (ce && 0 == --ce->refcnt && ce->detached)
+        mod_cache_entry_free(ce);
+    free(hctx->key.ptr);
+    free(hctx);
+}
+
+
+static void mod_cache_entry_free (mod_cache_entry * const ce) {
+    if (ce->on_disk && !buffer_is_blank(&ce->fn))
+        unlink(ce->fn.ptr);
+    free(ce->key.ptr);
+    free(ce->vkey.ptr);
+    free(ce->body.ptr);
+    free(ce->fn.ptr);
+    array_free(ce->headers);
+    free(ce);
+}
+
+
+static mod_cache_tier * mod_cache_entry_tier (plugin_data * const p, const mod_cache_entry * const ce) {
+    return ce->on_disk ? &p->disk : &p->mem;
+}
+
+
+static void mod_cache_lru_unlink (mod_cache_tier * const t, mod_cache_entry * const ce) {
+    if (ce->lru_prev) ce->lru_prev->lru_next = ce->lru_next;
+    else t->head = ce->lru_next;
+    if (ce->lru_next) ce->lru_next->lru_prev = ce->lru_prev;
+    else t->tail = ce->lru_prev;
+    ce->lru_prev = ce->lru_next = NULL;
+}
+
+
+static void mod_cache_lru_push (mod_cache_tier * const t, mod_cache_entry * const ce) {
+    ce->lru_prev = NULL;
+    ce->lru_next = t->head;
+    if (t->head) t->head->lru_prev = ce;
+    else t->tail = ce;
+    t->head = ce;
+}
+
+
+static void mod_cache_entry_remove (plugin_data * const p, mod_cache_entry * const ce) {
+    splay_tree *sptree = splaytree_splay_nonnull(p->sptree, ce->hash);
+    mod_cache_entry **e = (mod_cache_entry **)&sptree->data;
+    while (*e != ce) e = &(*e)->next;
+    *e = ce->next;
+    if (NULL == sptree->data)
+        sptree = splaytree_delete_splayed_node(sptree);
+    p->sptree = sptree;
+
+    mod_cache_tier * const t = mod_cache_entry_tier(p, ce);
+    mod_cache_lru_unlink(t, ce);
+    t->bytes -= ce->tsize;
+    if (ce->refcnt) /* free when no longer pinned by request revalidating */
+        ce->detached = 1;
+    else
+        mod_cache_entry_free(ce);
+}
+
+
+static void mod_cache_tier_evict (plugin_data * const p, mod_cache_tier * const t, const off_t sz) {
+    while (t->tail && t->bytes + sz > t->max_bytes)
+        mod_cache_entry_remove(p, t->tail);
+}
+
+
+static int mod_cache_vary_key (const request_st * const r, const buffer * const vary, buffer * const vkey) {
+    /* concatenate request header values for header names listed in Vary */
+    buffer_clear(vkey);
+    if (NULL == vary) return 1;
+    const char *s = vary->ptr;
+    do {
+        while (*s == ' ' || *s == '\t' || *s == ',') ++s;
+        if (*s == '\0') break;
+        const char *e = s;
+        while (*e && *e != ',' && *e != ' ' && *e != '\t') ++e;
+        const uint32_t klen = (uint32_t)(e - s);
+        if (1 == klen && *s == '*') return 0; /* Vary: * not cacheable */
+        const enum http_header_e id = http_header_hkey_get(s, klen);
+        const buffer * const vb = http_header_request_get(r, id, s, klen);
+        buffer_append_str2(vkey, s, klen, CONST_STR_LEN(":"));
+        if (vb) buffer_append_string_len(vkey, BUF_PTR_LEN(vb));
+        buffer_append_string_len(vkey, CONST_STR_LEN("\n"));
+        s = e;
+    } while (*s);
+    return 1;
+}
+
+
+static mod_cache_entry * mod_cache_lookup (plugin_data * const p, request_st * const r, const handler_ctx * const hctx) {
+    p->sptree = splaytree_splay(p->sptree, hctx->hash);
+    if (NULL == p->sptree || p->sptree->key != hctx->hash) return NULL;
+    buffer * const vkey = r->tmp_buf;
+    for (mod_cache_entry *ce = p->sptree->data; ce; ce = ce->next) {
+        if (!buffer_is_equal(&ce->key, &hctx->key)) continue;
+        const data_string * const vary = (const data_string *)
+          array_get_element_klen_ext(ce->headers, HTTP_HEADER_VARY,
+                                     CONST_STR_LEN("Vary"));
+        if (!mod_cache_vary_key(r, vary ? &vary->value : NULL, vkey))
+            continue;
+        if (buffer_is_equal(&ce->vkey, vkey)) return ce;
+    }
+    return NULL;
+}
+
+
+static handler_t mod_cache_entry_send (plugin_data * const p, request_st * const r, mod_cache_entry * const ce) {
+    if (ce->on_disk) {
+        const int fd = fdevent_open_cloexec(ce->fn.ptr, 1, O_RDONLY, 0);
+        if (-1 == fd) { /* file removed from cache dir? */
+            if (!ce->detached) mod_cache_entry_remove(p, ce);
+            return HANDLER_GO_ON;
+        }
+        if (0 != http_chunk_append_file_fd(r, &ce->fn, fd, ce->size)) {
+            if (!ce->detached) mod_cache_entry_remove(p, ce);
+            return HANDLER_GO_ON;
+        }
+    }
+    else if (ce->size)
+        http_chunk_append_mem(r, ce->body.ptr, (size_t)ce->size);
+
+    /* move entry to head of least-recently-used list */
+    if (!ce->detached) {
+        mod_cache_tier * const t = mod_cache_entry_tier(p, ce);
+        mod_cache_lru_unlink(t, ce);
+        mod_cache_lru_push(t, ce);
+    }
+
+    r->http_status = 200;
+    const array * const a = ce->headers;
+    for (uint32_t i = 0; i < a->used; ++i) {
+        const data_string * const ds = (const data_string *)a->data[i];
+        http_header_response_insert(r, ds->ext, BUF_PTR_LEN(&ds->key),
+                                    BUF_PTR_LEN(&ds->value));
+        if (NULL != strchr(ds->value.ptr, '\n'))
+            r->resp_header_repeated = 1;
+    }
+    const unix_time64_t age = log_epoch_secs - ce->ctime;
+    buffer_append_int(
+      http_header_response_set_ptr(r, HTTP_HEADER_AGE, CONST_STR_LEN("Age")),
+      age > 0 ? age : 0);
+
+    r->resp_body_finished = 1;
+    r->handler_module = NULL;
+    http_response_handle_cachable(r, NULL, ce->lmtime);
+    return HANDLER_FINISHED;
+}
+
+
+static void mod_cache_revalidate_unset (request_st * const r) {
+    /* remove conditional request headers added by mod_cache for revalidation
+     * (not sent by client; revalidation is skipped if client sent any) */
+    http_header_request_unset(r, HTTP_HEADER_IF_NONE_MATCH,
+                              CONST_STR_LEN("If-None-Match"));
+    http_header_request_unset(r, HTTP_HEADER_IF_MODIFIED_SINCE,
+                              CONST_STR_LEN("If-Modified-Since"));
+}
+
+
+static void mod_cache_response_replace (plugin_data * const p, request_st * const r, mod_cache_entry * const ce) {
+    /* replace 304 Not Modified response to revalidation with cached entry */
+    r->resp_htags = 0;
+    array_reset_data_strings(&r->resp_headers);
+    http_response_body_clear(r, 0);
+    if (HANDLER_FINISHED != mod_cache_entry_send(p, r, ce)) {
+        /*(should not happen unless cache file removed; send 502)*/
+        r->http_status = 502;
+        r->resp_body_finished = 1;
+    }
+}
+
+
+static int mod_cache_freshness (const request_st * const r, unix_time64_t * const expires) {
+    /* returns 1 if response may be stored, 0 if not
+     * (sets *expires to time when response is stale) */
+    const buffer * const vb =
+      http_header_response_get(r, HTTP_HEADER_CACHE_CONTROL,
+                               CONST_STR_LEN("Cache-Control"));
+    long long max_age = -1, s_maxage = -1;
+    if (vb) {
+        const char *s = vb->ptr;
+        do {
+            while (*s == ' ' || *s == '\t' || *s == ',') ++s;
+            if (*s == '\0') break;
+            const char *e = s;
+            while (*e && *e != ',') ++e;
+            const uint32_t n = (uint32_t)(e - s);
+            if (buffer_eq_icase_ssn(s, CONST_STR_LEN("no-store"))
+                || buffer_eq_icase_ssn(s, CONST_STR_LEN("no-cache"))
+                || buffer_eq_icase_ssn(s, CONST_STR_LEN("private")))
+                return 0;
+            if (n > 9 && buffer_eq_icase_ssn(s, CONST_STR_LEN("s-maxage=")))
+                s_maxage = strtoll(s+9, NULL, 10);
+            else if (n > 8 && buffer_eq_icase_ssn(s, CONST_STR_LEN("max-age=")))
+                max_age = strtoll(s+8, NULL, 10);
+            s = e;
+        } while (*s);
+    }
+
+    const unix_time64_t cur_ts = log_epoch_secs;
+    if (s_maxage >= 0)
+        *expires = cur_ts + s_maxage;
+    else if (max_age >= 0)
+        *expires = cur_ts + max_age;
+    else {
+        const buffer * const exp =
+          http_header_response_get(r, HTTP_HEADER_EXPIRES,
+                                   CONST_STR_LEN("Expires"));
+        *expires = exp ? http_date_str_to_time(BUF_PTR_LEN(exp)) : -1;
+        if (*expires < cur_ts) *expires = cur_ts; /*(includes parse error)*/
+    }
+    return 1;
+}
+
+
+static int mod_cache_store_disk (plugin_data * const p, request_st * const r, mod_cache_entry * const ce) {
+    buffer * const fn = &ce->fn;
+    buffer_copy_path_len2(fn, BUF_PTR_LEN(p->cache_dir), CONST_STR_LEN("c-"));
+    buffer_append_uint_hex(fn, (uint32_t)ce->hash);
+    buffer_append_char(fn, '-');
+    buffer_append_int(fn, getpid());
+    buffer_append_char(fn, '-');
+    buffer_append_int(fn, ++p->seq);
+
+    const int fd = fdevent_open_cloexec(fn->ptr, 1,
+                                        O_WRONLY|O_CREAT|O_TRUNC|O_EXCL, 0600);
+    if (-1 == fd) {
+        log_perror(r->conf.errh, __FILE__, __LINE__, "open() %s", fn->ptr);
+        return 0;
+    }
+    ce->on_disk = 1; /*(unlink() fn if error)*/
+
+    chunkqueue tq = {0,0,0,0,0,0};
+    chunkqueue_append_cq_range(&tq, &r->write_queue, 0, ce->size);
+    while (!chunkqueue_is_empty(&tq)) {
+        const ssize_t wr = chunkqueue_write_chunk(fd, &tq, r->conf.errh);
+        if (wr <= 0) break;
+        chunkqueue_mark_written(&tq, wr);
+    }
+    const int rc = chunkqueue_is_empty(&tq);
+    chunkqueue_reset(&tq);
+    if (0 != close(fd) || !rc) {
+        log_error(r->conf.errh, __FILE__, __LINE__,
+          "writing cache file %s failed", fn->ptr);
+        return 0;
+    }
+    return 1;
+}
+
+
+static void mod_cache_store (plugin_data * const p, request_st * const r, const handler_ctx * const hctx) {
+    if (r->http_method != HTTP_METHOD_GET) return;
+    if (NULL == r->handler_module) return; /* e.g. static file */
+    if (r->resp_htags & (light_bshift(HTTP_HEADER_SET_COOKIE)
+                        |light_bshift(HTTP_HEADER_TRANSFER_ENCODING)))
+        return;
+
+    const off_t len = chunkqueue_length(&r->write_queue);
+    if (len > ((off_t)p->conf.max_entry_size << 10)) return;
+
+    const int on_disk = (len > p->max_mem_entry_size);
+    if (on_disk && NULL == p->cache_dir) return;
+
+    unix_time64_t expires;
+    if (!mod_cache_freshness(r, &expires)) return;
+
+    const buffer * const etag =
+      http_header_response_get(r, HTTP_HEADER_ETAG, CONST_STR_LEN("ETag"));
+    const buffer * const lmod =
+      http_header_response_get(r, HTTP_HEADER_LAST_MODIFIED,
+                               CONST_STR_LEN("Last-Modified"));
+    const unix_time64_t cur_ts = log_epoch_secs;
+    if (expires <= cur_ts && NULL == etag && NULL == lmod)
+        return; /* not fresh and can not be revalidated */
+
+    mod_cache_entry * const ce = ck_calloc(1, sizeof(*ce));
+    const buffer * const vary =
+      http_header_response_get(r, HTTP_HEADER_VARY, CONST_STR_LEN("Vary"));
+    if (!mod_cache_vary_key(r, vary, &ce->vkey)) {
+        free(ce->vkey.ptr);
+        free(ce);
+        return;
+    }
+    ce->hash = hctx->hash;
+    ce->size = len;
+    ce->ctime = cur_ts;
+    ce->expires = expires;
+    ce->has_validator = (NULL != etag || NULL != lmod);
+    ce->lmtime = lmod ? http_date_str_to_time(BUF_PTR_LEN(lmod)) : 0;
+    buffer_copy_buffer(&ce->key, &hctx->key);
+    ce->headers = array_init(r->resp_headers.used);
+    off_t hsz = 0;
+    for (uint32_t i = 0; i < r->resp_headers.used; ++i) {
+        const data_string * const ds =
+          (const data_string *)r->resp_headers.data[i];
+        switch (ds->ext) {
+          case HTTP_HEADER_AGE:
+          case HTTP_HEADER_CONNECTION:
+          case HTTP_HEADER_CONTENT_LENGTH:
+          case HTTP_HEADER_TRANSFER_ENCODING:
+          case HTTP_HEADER_UPGRADE:
+            continue;
+          default:
+            break;
+        }
+        buffer_copy_buffer(
+          array_get_buf_ptr_ext(ce->headers, ds->ext, BUF_PTR_LEN(&ds->key)),
+          &ds->value);
+        hsz += buffer_clen(&ds->key) + buffer_clen(&ds->value);
+    }
+
+    if (on_disk) {
+        if (!mod_cache_store_disk(p, r, ce)) {
+            mod_cache_entry_free(ce);
+            return;
+        }
+        ce->tsize = len;
+    }
+    else {
+        if (len) {
+            chunkqueue tq = {0,0,0,0,0,0};
+            chunkqueue_append_cq_range(&tq, &r->write_queue, 0, len);
+            char * const data = buffer_string_prepare_copy(&ce->body, len);
+            const int rc = chunkqueue_read_data(&tq, data, (uint32_t)len,
+                                                r->conf.errh);
+            chunkqueue_reset(&tq);
+            if (0 != rc) {
+                mod_cache_entry_free(ce);
+                return;
+            }
+            buffer_commit(&ce->body, len);
+        }
+        ce->tsize = (off_t)sizeof(*ce) + len + hsz
+                  + buffer_clen(&ce->key) + buffer_clen(&ce->vkey);
+    }
+
+    mod_cache_tier * const t = mod_cache_entry_tier(p, ce);
+    if (ce->tsize > t->max_bytes) {
+        mod_cache_entry_free(ce);
+        return;
+    }
+
+    /* replace existing entry for same key and variant */
+    mod_cache_entry * const old = mod_cache_lookup(p, r, hctx);
+    if (old) mod_cache_entry_remove(p, old);
+
+    mod_cache_tier_evict(p, t, ce->tsize);
+    t->bytes += ce->tsize;
+    mod_cache_lru_push(t, ce);
+
+    p->sptree = splaytree_splay(p->sptree, ce->hash);
+    if (NULL == p->sptree || p->sptree->key != ce->hash)
+        p->sptree = splaytree_insert_splayed(p->sptree, ce->hash, ce);
+    else {
+        ce->next = p->sptree->data;
+        p->sptree->data = ce;
+    }
+}
+
+
+static int mod_cache_dir_fn_match (const char *s) {
+    /* "c-<hash (hex)>-<pid>-<seq>" (see mod_cache_store_disk()) */
+    if (s[0] != 'c' || s[1] != '-') return 0;
+    s += 2;
+    const char *b = s;
+    while (light_isxdigit(*s)) ++s;
+    if (s == b || *s != '-') return 0;
+    for (int i = 0; i < 2; ++i) {
+        b = ++s;
+        while (light_isdigit(*s)) ++s;
+        if (s == b || *s != (i ? '\0' : '-')) return 0;
+    }
+    return 1;
+}
+
+
+static void mod_cache_dir_clean (server * const srv, const buffer * const dir) {
+    /* remove cache files left from previous server instances
+     * (e.g. after crash; files are otherwise removed when entry is evicted)
+     * (only files which might have been created by mod_cache are removed) */
+    DIR * const dp = opendir(dir->ptr);
+    if (NULL == dp) {
+        log_perror(srv->errh, __FILE__, __LINE__, "opendir %s", dir->ptr);
+        return;
+    }
+    buffer * const fn = srv->tmp_buf;
+    struct dirent *de;
+    while (NULL != (de = readdir(dp))) {
+        if (!mod_cache_dir_fn_match(de->d_name)) continue;
+        buffer_copy_path_len2(fn, BUF_PTR_LEN(dir),
+                              de->d_name, strlen(de->d_name));
+        struct stat st;
+        if (0 != lstat(fn->ptr, &st) || !S_ISREG(st.st_mode))
+            continue;
+      #ifndef _WIN32
+        if (st.st_uid != geteuid())
+            continue;
+      #endif
+        if (0 != unlink(fn->ptr) && errno != ENOENT)
+            log_perror(srv->errh, __FILE__, __LINE__, "unlink %s", fn->ptr);
+    }
+    closedir(dp);
+}
+
+
+INIT_FUNC(mod_cache_init) {
+    return ck_calloc(1, sizeof(plugin_data));
+}
+
+FREE_FUNC(mod_cache_free) {
+    plugin_data * const p = p_d;
+    splay_tree *sptree = p->sptree;
+    while (sptree) {
+        for (mod_cache_entry *ce = sptree->data, *next; ce; ce = next) {
+            next = ce->next;
+            mod_cache_entry_free(ce);
+        }
+        sptree = splaytree_delete_splayed_node(sptree);
+    }
+    p->sptree = NULL;
+}
+
+static void mod_cache_merge_config_cpv(plugin_config * const pconf, const config_plugin_value_t * const cpv) {
+    switch (cpv->k_id) { /* index into static config_plugin_keys_t cpk[] */
+      case 0: /* cache.enable */
+        pconf->enable = (unsigned short)cpv->v.u;
+        break;
+      case 1: /* cache.max-entry-size */
+        pconf->max_entry_size = cpv->v.u;
+        break;
+      case 2: /* cache.max-memory */
+      case 3: /* cache.max-memory-entry-size */
+      case 4: /* cache.dir */
+      case 5: /* cache.max-disk */
+      case 6: /* cache.disk-enable */
+        break;
+      default:/* should not happen */
+        return;
+    }
+}
+
+static void mod_cache_merge_config(plugin_config * const pconf, const config_plugin_value_t *cpv) {
+    do {
+        mod_cache_merge_config_cpv(pconf, cpv);
+    } while ((++cpv)->k_id != -1);
+}
+
+static void mod_cache_patch_config(request_st * const r, plugin_data * const p) {
+    p->conf = p->defaults; /* copy small struct instead of memcpy() */
+    /*memcpy(&p->conf, &p->defaults, sizeof(plugin_config));*/
+    for (int i = 1, used = p->nconfig; i < used; ++i) {
+        if (config_check_cond(r, (uint32_t)p->cvlist[i].k_id))
+            mod_cache_merge_config(&p->conf, p->cvlist + p->cvlist[i].v.u2[0]);
+    }
+}
+
+SETDEFAULTS_FUNC(mod_cache_set_defaults) {
+    static const config_plugin_keys_t cpk[] = {
+      { CONST_STR_LEN("cache.enable"),
+        T_CONFIG_BOOL,
+        T_CONFIG_SCOPE_CONNECTION }
+     ,{ CONST_STR_LEN("cache.max-entry-size"),
+        T_CONFIG_INT,
+        T_CONFIG_SCOPE_CONNECTION }
+     ,{ CONST_STR_LEN("cache.max-memory"),
+        T_CONFIG_INT,
+        T_CONFIG_SCOPE_SERVER }
+     ,{ CONST_STR_LEN("cache.max-memory-entry-size"),
+        T_CONFIG_INT,
+        T_CONFIG_SCOPE_SERVER }
+     ,{ CONST_STR_LEN("cache.dir"),
+        T_CONFIG_STRING,
+        T_CONFIG_SCOPE_SERVER }
+     ,{ CONST_STR_LEN("cache.max-disk"),
+        T_CONFIG_INT,
+        T_CONFIG_SCOPE_SERVER }
+     ,{ CONST_STR_LEN("cache.disk-enable"),
+        T_CONFIG_BOOL,
+        T_CONFIG_SCOPE_SERVER }
+     ,{ NULL, 0,
+        T_CONFIG_UNSET,
+        T_CONFIG_SCOPE_UNSET }
+    };
+
+    plugin_data * const p = p_d;
+    if (!config_plugin_values_init(srv, p, cpk, "mod_cache"))
+        return HANDLER_ERROR;
+
+    p->defaults.max_entry_size = 4096;  /* KB */
+    p->mem.max_bytes = (off_t)64 << 20; /* 64 MB */
+    p->disk.max_bytes = (off_t)1024 << 20; /* 1 GB */
+    p->max_mem_entry_size = (off_t)64 << 10; /* 64 KB */
+    int disk_enable = 0;
+
+    /* process and validate config directives
+     * (init i to 0 if global context; to 1 to skip empty global context) */
+    for (int i = !p->cvlist[0].v.u2[1]; i < p->nconfig; ++i) {
+        config_plugin_value_t *cpv = p->cvlist + p->cvlist[i].v.u2[0];
+        for (; -1 != cpv->k_id; ++cpv) {
+            switch (cpv->k_id) {
+              case 0: /* cache.enable */
+              case 1: /* cache.max-entry-size */
+                break;
+              case 2: /* cache.max-memory */
+                p->mem.max_bytes = (off_t)cpv->v.u << 20;
+                break;
+              case 3: /* cache.max-memory-entry-size */
+                p->max_mem_entry_size = (off_t)cpv->v.u << 10;
+                break;
+              case 4: /* cache.dir */
+                if (!buffer_is_blank(cpv->v.b)) {
+                    buffer *b;
+                    *(const buffer **)&b = cpv->v.b;
+                    const uint32_t len = buffer_clen(b);
+                    if (len > 0 && '/' == b->ptr[len-1])
+                        buffer_truncate(b, len-1); /*remove end slash*/
+                    struct stat st;
+                    if (0 != stat(b->ptr, &st) || !S_ISDIR(st.st_mode)) {
+                        log_perror(srv->errh, __FILE__, __LINE__,
+                          "can't stat %s %s", cpk[cpv->k_id].k, b->ptr);
+                        return HANDLER_ERROR;
+                    }
+                    p->cache_dir = b;
+                }
+                break;
+              case 5: /* cache.max-disk */
+                p->disk.max_bytes = (off_t)cpv->v.u << 20;
+                break;
+              case 6: /* cache.disk-enable */
+                disk_enable = (int)cpv->v.u;
+                break;
+              default:/* should not happen */
+                break;
+            }
+        }
+    }
+
+    /* initialize p->defaults from global config context */
+    if (p->nconfig > 0 && p->cvlist->v.u2[1]) {
+        const config_plugin_value_t *cpv = p->cvlist + p->cvlist->v.u2[0];
+        if (-1 != cpv->k_id)
+            mod_cache_merge_config(&p->defaults, cpv);
+    }
+
+    if (!disk_enable)
+        p->cache_dir = NULL;
+    else if (NULL == p->cache_dir) {
+        log_error(srv->errh, __FILE__, __LINE__,
+          "cache.disk-enable requires cache.dir");
+        return HANDLER_ERROR;
+    }
+
+    if (p->cache_dir)
+        mod_cache_dir_clean(srv, p->cache_dir);
+
+    return HANDLER_GO_ON;
+}
+
+
+static int mod_cache_request_cacheable (const request_st * const r) {
+    if (!http_method_get_or_head(r->http_method)) return 0;
+    if (0 != r->reqbody_length) return 0;
+    /* (shared cache; do not store or send for requests with credentials) */
+    if (r->rqst_htags & (light_bshift(HTTP_HEADER_AUTHORIZATION)
+                        |light_bshift(HTTP_HEADER_COOKIE)
+                        |light_bshift(HTTP_HEADER_UPGRADE)))
+        return 0;
+    const buffer * const vb =
+      http_header_request_get(r, HTTP_HEADER_CACHE_CONTROL,
+                              CONST_STR_LEN("Cache-Control"));
+    return NULL == vb
+        || !http_header_str_contains_token(BUF_PTR_LEN(vb),
+                                           CONST_STR_LEN("no-store"));
+}
+
+
+URIHANDLER_FUNC(mod_cache_uri_handler) {
+    plugin_data * const p = p_d;
+    if (NULL != r->plugin_ctx[p->id]) return HANDLER_GO_ON;
+    if (NULL != r->handler_module) return HANDLER_GO_ON;
+
+    mod_cache_patch_config(r, p);
+    if (!p->conf.enable) return HANDLER_GO_ON;
+    if (!mod_cache_request_cacheable(r)) return HANDLER_GO_ON;
+
+    handler_ctx * const hctx = handler_ctx_init();
+    r->plugin_ctx[p->id] = hctx;
+    buffer_copy_string_len(&hctx->key, BUF_PTR_LEN(&r->uri.scheme));
+    buffer_append_str3(&hctx->key, CONST_STR_LEN("://"),
+                                   BUF_PTR_LEN(&r->uri.authority),
+                                   BUF_PTR_LEN(&r->target));
+    hctx->hash = splaytree_djbhash(BUF_PTR_LEN(&hctx->key));
+
+    const buffer * const vb =
+      http_header_request_get(r, HTTP_HEADER_CACHE_CONTROL,
+                              CONST_STR_LEN("Cache-Control"));
+    if (vb && http_header_str_contains_token(BUF_PTR_LEN(vb),
+                                             CONST_STR_LEN("no-cache")))
+        return HANDLER_GO_ON; /* MOD_CACHE_MISS (response may be stored) */
+
+    mod_cache_entry * const ce = mod_cache_lookup(p, r, hctx);
+    if (NULL == ce) return HANDLER_GO_ON;
+
+    if (ce->expires > log_epoch_secs) {
+        const handler_t rc = mod_cache_entry_send(p, r, ce);
+        if (rc == HANDLER_FINISHED) hctx->state = MOD_CACHE_HIT;
+        return rc;
+    }
+
+    if (!ce->has_validator) {
+        mod_cache_entry_remove(p, ce);
+        return HANDLER_GO_ON;
+    }
+
+    /* revalidate stale entry with backend (unless client sent conditional
+     * request, in which case response is passed through and may be stored)*/
+    if (r->rqst_htags & (light_bshift(HTTP_HEADER_IF_MATCH)
+                        |light_bshift(HTTP_HEADER_IF_MODIFIED_SINCE)
+                        |light_bshift(HTTP_HEADER_IF_NONE_MATCH)
+                        |light_bshift(HTTP_HEADER_IF_RANGE)
+                        |light_bshift(HTTP_HEADER_IF_UNMODIFIED_SINCE)
+                        |light_bshift(HTTP_HEADER_RANGE)))
+        return HANDLER_GO_ON;
+
+    const data_string *ds;
+    ds = (const data_string *)
+      array_get_element_klen_ext(ce->headers, HTTP_HEADER_ETAG,
+                                 CONST_STR_LEN("ETag"));
+    if (ds)
+        http_header_request_set(r, HTTP_HEADER_IF_NONE_MATCH,
+                                CONST_STR_LEN("If-None-Match"),
+                                BUF_PTR_LEN(&ds->value));
+    ds = (const data_string *)
+      array_get_element_klen_ext(ce->headers, HTTP_HEADER_LAST_MODIFIED,
+                                 CONST_STR_LEN("Last-Modified"));
+    if (ds)
+        http_header_request_set(r, HTTP_HEADER_IF_MODIFIED_SINCE,
+                                CONST_STR_LEN("If-Modified-Since"),
+                                BUF_PTR_LEN(&ds->value));
+    hctx->state = MOD_CACHE_REVALIDATE;
+    hctx->ce = ce; /* pin entry (in case evicted or replaced meanwhile) */
+    ++ce->refcnt;
+    return HANDLER_GO_ON;
+}
+
+
+REQUEST_FUNC(mod_cache_handle_response_start) {
+    plugin_data * const p = p_d;
+    handler_ctx * const hctx = r->plugin_ctx[p->id];
+    if (NULL == hctx || hctx->state == MOD_CACHE_HIT) return HANDLER_GO_ON;
+
+    if (hctx->state == MOD_CACHE_REVALIDATE) {
+        /* (conditional request headers were for backend request only) */
+        mod_cache_revalidate_unset(r);
+        hctx->state = MOD_CACHE_MISS;
+        if (r->http_status == 304) {
+            mod_cache_entry * const ce = hctx->ce;
+            unix_time64_t expires;
+            ce->ctime = log_epoch_secs;
+            if (mod_cache_freshness(r, &expires))
+                ce->expires = expires;
+            hctx->state = MOD_CACHE_HIT;
+            mod_cache_response_replace(p, r, ce);
+            return HANDLER_GO_ON;
+        }
+    }
+
+    if (!r->resp_body_finished) return HANDLER_GO_ON;
+
+    mod_cache_patch_config(r, p);
+
+    if (r->http_status == 200)
+        mod_cache_store(p, r, hctx);
+
+    return HANDLER_GO_ON;
+}
+
+
+REQUEST_FUNC(mod_cache_handle_request_reset) {
+    void ** const hctx = r->plugin_ctx+((plugin_data_base *)p_d)->id;
+    if (*hctx) { handler_ctx_free(*hctx); *hctx = NULL; }
+    return HANDLER_GO_ON;
+}
+
+
+/* walk though cache, collect expired ids, and remove them in a second loop */
+static void
+mod_cache_tag_old_entries (splay_tree * const t, int * const keys, int * const ndx, const unix_time64_t cur_ts)
+{
+    if (*ndx == 8192) return; /*(must match num array entries in keys[])*/
+    if (t->left)
+        mod_cache_tag_old_entries(t->left, keys, ndx, cur_ts);
+    if (t->right)
+        mod_cache_tag_old_entries(t->right, keys, ndx, cur_ts);
+    if (*ndx == 8192) return; /*(must match num array entries in keys[])*/
+
+    for (const mod_cache_entry *ce = t->data; ce; ce = ce->next) {
+        if (ce->expires <= cur_ts && !ce->has_validator) {
+            keys[(*ndx)++] = t->key;
+            break;
+        }
+    }
+}
+
+TRIGGER_FUNC(mod_cache_periodic)
+{
+    plugin_data * const p = p_d;
+    const unix_time64_t cur_ts = log_monotonic_secs;
+    if (cur_ts & 0xf) return HANDLER_GO_ON; /*(continue once each 16 sec)*/
+    UNUSED(srv);
+
+    /* remove stale entries which can not be revalidated */
+    const unix_time64_t epoch_ts = log_epoch_secs;
+    int max_ndx, i;
+    int keys[8192]; /* 32k size on stack */
+    do {
+        if (!p->sptree) break;
+        max_ndx = 0;
+        mod_cache_tag_old_entries(p->sptree, keys, &max_ndx, epoch_ts);
+        for (i = 0; i < max_ndx; ++i) {
+            p->sptree = splaytree_splay_nonnull(p->sptree, keys[i]);
+            for (mod_cache_entry *ce = p->sptree->data, *next; ce; ce = next) {
+                next = ce->next;
+                if (ce->expires <= epoch_ts && !ce->has_validator)
+                    mod_cache_entry_remove(p, ce); /*(might modify p->sptree)*/
+                if (NULL == p->sptree || p->sptree->key != keys[i]) break;
+            }
+        }
+    } while (max_ndx == sizeof(keys)/sizeof(int));
+
+    return HANDLER_GO_ON;
+}
+
+
+__attribute_cold__
+__declspec_dllexport__
+int mod_cache_plugin_init(plugin *p);
+int mod_cache_plugin_init(plugin *p) {
+	p->version     = LIGHTTPD_VERSION_ID;
+	p->name        = "cache";
+
+	p->init        = mod_cache_init;
+	p->cleanup     = mod_cache_free;
+	p->set_defaults= mod_cache_set_defaults;
+	p->handle_uri_clean      = mod_cache_uri_handler;
+	p->handle_response_start = mod_cache_handle_response_start;
+	p->handle_request_reset  = mod_cache_handle_request_reset;
+	p->handle_trigger        = mod_cache_periodic;
+
+	return 0;
+}
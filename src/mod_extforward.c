@@ -62,27 +62,17 @@ typedef enum {
 	PROXY_FORWARDED_REMOTE_USER  = 0x10
 } proxy_forwarded_t;
 
-struct sock_addr_mask {
-  sock_addr addr;
-  int bits;
-};
-
 struct forwarder_cfg {
   const array *forwarder;
   int forward_all;
   uint32_t addrs_used;
- #if defined(__STDC_VERSION__) && __STDC_VERSION__-0 >= 199901L /* C99 */
-  struct sock_addr_mask addrs[];
- #else
-  struct sock_addr_mask addrs[1];
- #endif
+  sock_addr_cidr addrs; /* trusted CIDR masks */
 };
 
 typedef struct {
     const array *forwarder;
     int forward_all;
-    uint32_t forward_masks_used;
-    const struct sock_addr_mask *forward_masks;
+    const sock_addr_cidr *forward_masks; /* (NULL if no CIDR masks) */
     const array *headers;
     unsigned int opts;
     char hap_PROXY;
@@ -159,7 +149,11 @@ FREE_FUNC(mod_extforward_free) {
         for (; -1 != cpv->k_id; ++cpv) {
             switch (cpv->k_id) {
               case 0: /* extforward.forwarder */
-                if (cpv->vtype == T_CONFIG_LOCAL) free(cpv->v.v);
+                if (cpv->vtype == T_CONFIG_LOCAL) {
+                    struct forwarder_cfg * const fwd = cpv->v.v;
+                    sock_addr_cidr_free(&fwd->addrs);
+                    free(fwd);
+                }
                 break;
               default:
                 break;
@@ -175,8 +169,7 @@ static void mod_extforward_merge_config_cpv(plugin_config * const pconf, const c
             const struct forwarder_cfg * const fwd = cpv->v.v;
             pconf->forwarder = fwd->forwarder;
             pconf->forward_all = fwd->forward_all;
-            pconf->forward_masks_used = fwd->addrs_used;
-            pconf->forward_masks = fwd->addrs;
+            pconf->forward_masks = fwd->addrs_used ? &fwd->addrs : NULL;
         }
         break;
       case 1: /* extforward.headers */
@@ -217,20 +210,17 @@ static void * mod_extforward_parse_forwarder(server *srv, const array *forwarder
     const int forward_all = (NULL == allds)
       ? 0
       : buffer_eq_icase_slen(&allds->value, CONST_STR_LEN("trust")) ? 1 : -1;
-    uint32_t nmasks = 0;
     for (uint32_t j = 0; j < forwarder->used; ++j) {
         data_string * const ds = (data_string *)forwarder->data[j];
         char * const nm_slash = strchr(ds->key.ptr, '/');
-        if (NULL != nm_slash) ++nmasks;
         if (!buffer_eq_icase_slen(&ds->value, CONST_STR_LEN("trust"))) {
             if (!buffer_eq_icase_slen(&ds->value, CONST_STR_LEN("untrusted")))
                 log_error(srv->errh, __FILE__, __LINE__,
                   "ERROR: expect \"trust\", not \"%s\" => \"%s\"; "
                   "treating as untrusted", ds->key.ptr, ds->value.ptr);
             if (NULL != nm_slash) {
-                /* future: consider adding member next to bits in sock_addr_mask
-                 *         with bool trusted/untrusted member */
-                --nmasks;
+                /* future: consider untrusted CIDR masks in separate trie
+                 *         (checked before trusted CIDR masks) */
                 log_error(srv->errh, __FILE__, __LINE__,
                   "ERROR: untrusted CIDR masks are ignored (\"%s\" => \"%s\")",
                   ds->key.ptr, ds->value.ptr);
@@ -240,9 +230,7 @@ static void * mod_extforward_parse_forwarder(server *srv, const array *forwarder
         }
     }
 
-    struct forwarder_cfg * const fwd =
-      ck_calloc(1, sizeof(struct forwarder_cfg)
-                 + sizeof(struct sock_addr_mask)*nmasks);
+    struct forwarder_cfg * const fwd = ck_calloc(1, sizeof(*fwd));
     fwd->forwarder = forwarder;
     fwd->forward_all = forward_all;
     fwd->addrs_used = 0;
@@ -259,25 +247,27 @@ static void * mod_extforward_parse_forwarder(server *srv, const array *forwarder
         if (*err || nm_bits <= 0 || !light_isdigit(nm_slash[1])) {
             log_error(srv->errh, __FILE__, __LINE__,
               "ERROR: invalid netmask: %s %s", ds->key.ptr, err);
+            sock_addr_cidr_free(&fwd->addrs);
             free(fwd);
             return NULL;
         }
-        struct sock_addr_mask * const sm = fwd->addrs + fwd->addrs_used++;
-        sm->bits = nm_bits;
+        sock_addr addr;
         *nm_slash = '\0';
         if (ds->key.ptr[0] == '['
             && ds->key.ptr+1 < nm_slash && nm_slash[-1] == ']') {
             nm_slash[-1] = '\0';
-            rc = sock_addr_from_str_numeric(&sm->addr,ds->key.ptr+1,srv->errh);
+            rc = sock_addr_from_str_numeric(&addr, ds->key.ptr+1, srv->errh);
             nm_slash[-1] = ']';
         }
         else
-            rc = sock_addr_from_str_numeric(&sm->addr,ds->key.ptr,  srv->errh);
+            rc = sock_addr_from_str_numeric(&addr, ds->key.ptr,   srv->errh);
         *nm_slash = '/';
-        if (1 != rc) {
+        if (1 != rc || 0 != sock_addr_cidr_insert(&fwd->addrs, &addr, nm_bits)) {
+            sock_addr_cidr_free(&fwd->addrs);
             free(fwd);
             return NULL;
         }
+        ++fwd->addrs_used;
         buffer_clear(&ds->value);
         /* empty is untrusted,
          * e.g. if subnet (incorrectly) appears in X-Forwarded-For */
@@ -503,9 +493,7 @@ static int is_proxy_trusted(plugin_data *p, const char * const ip, size_t iplen)
       (const data_string *)array_get_element_klen(p->conf.forwarder, ip, iplen);
     if (NULL != ds) return !buffer_is_blank(&ds->value);
 
-    if (p->conf.forward_masks_used) {
-        const struct sock_addr_mask * const addrs = p->conf.forward_masks;
-        const uint32_t aused = p->conf.forward_masks_used;
+    if (p->conf.forward_masks) {
         sock_addr addr;
         /* C funcs inet_aton(), inet_pton() require '\0'-terminated IP str */
         char addrstr[64]; /*(larger than INET_ADDRSTRLEN and INET6_ADDRSTRLEN)*/
@@ -516,10 +504,7 @@ static int is_proxy_trusted(plugin_data *p, const char * const ip, size_t iplen)
         if (1 != sock_addr_inet_pton(&addr, addrstr, AF_INET,  0)
          && 1 != sock_addr_inet_pton(&addr, addrstr, AF_INET6, 0)) return 0;
 
-        for (uint32_t i = 0; i < aused; ++i) {
-            if (sock_addr_is_addr_eq_bits(&addr, &addrs[i].addr, addrs[i].bits))
-                return 1;
-        }
+        return sock_addr_cidr_match(p->conf.forward_masks, &addr);
     }
 
     return 0;
@@ -255,7 +255,8 @@ static handler_t fcgi_create_env(handler_ctx *hctx) {
 	fcgi_header(&(beginRecord.header), FCGI_BEGIN_REQUEST, request_id, sizeof(beginRecord.body), 0);
 	beginRecord.body.roleB0 = hctx->gw_mode;
 	beginRecord.body.roleB1 = 0;
-	beginRecord.body.flags = 0;
+	beginRecord.body.flags =
+	  (host->keep_conn && !hctx->opts.upgrade) ? FCGI_KEEP_CONN : 0;
 	memset(beginRecord.body.reserved, 0, sizeof(beginRecord.body.reserved));
 	fcgi_header(&header, FCGI_PARAMS, request_id, 0, 0); /*(set aside space to fill in later)*/
 	buffer_append_str2(b, (const char *)&beginRecord, sizeof(beginRecord),
@@ -290,7 +291,7 @@ static handler_t fcgi_create_env(handler_ctx *hctx) {
 	}
 	fcgi_stdin_append(hctx);
 
-	plugin_stats_inc("fastcgi.requests");
+	++(*hctx->host->stats_requests); /* "fastcgi.requests" */
 	return HANDLER_GO_ON;
 }
 
@@ -322,29 +323,61 @@ static int fastcgi_get_packet(handler_ctx *hctx, fastcgi_response_packet *packet
 	if (ptr != (char *)&header) /* copy into aligned struct */
 		memcpy(&header, ptr, sizeof(FCGI_Header));
 
-	/* we have at least a header, now check how much we have to fetch */
-	packet->len = (header.contentLengthB0 | (header.contentLengthB1 << 8)) + header.paddingLength;
+	/* we have at least a header, now check how much we have to fetch
+	 * (padding is not required to be received before processing packet;
+	 *  padding is skipped in fastcgi_skip_padding() after packet content) */
+	packet->len = (header.contentLengthB0 | (header.contentLengthB1 << 8));
 	packet->request_id = (header.requestIdB0 | (header.requestIdB1 << 8));
 	packet->type = header.type;
 	packet->padding = header.paddingLength;
 
 	if (packet->len > (unsigned int)rblen-sizeof(FCGI_Header)) {
-		return -1; /* we didn't get the full packet */
+		/* we didn't get the full packet; return num bytes missing */
+		return (int)(packet->len - (rblen-sizeof(FCGI_Header)));
 	}
 
 	chunkqueue_mark_written(hctx->rb, sizeof(FCGI_Header));
 	return 0;
 }
 
+static void fastcgi_skip_padding(handler_ctx * const hctx, uint32_t padding) {
+	/* discard packet padding received, and note padding not yet received */
+	const off_t rblen = chunkqueue_length(hctx->rb);
+	if ((off_t)padding > rblen) {
+		hctx->rb_skip = padding - (uint32_t)rblen;
+		padding = (uint32_t)rblen;
+	}
+	if (padding) chunkqueue_mark_written(hctx->rb, padding);
+}
+
 static void fastcgi_get_packet_body(buffer * const b, handler_ctx * const hctx, const fastcgi_response_packet * const packet) {
     /* copy content; hctx->rb must contain at least packet->len content */
-    /* (read entire packet and then truncate padding, if present) */
-    const uint32_t blen = buffer_clen(b);
     if (chunkqueue_read_data(hctx->rb,
                              buffer_string_prepare_append(b, packet->len),
                              packet->len, hctx->r->conf.errh) < 0)
         return; /*(should not happen; should all be in memory)*/
-    buffer_truncate(b, blen + packet->len - packet->padding);
+    buffer_commit(b, packet->len);
+}
+
+static void fastcgi_end_request_keep_conn(handler_ctx * const hctx, const fastcgi_response_packet * const packet) {
+	/* backend connection may be reused if FCGI_KEEP_CONN was sent, request
+	 * completed, and nothing further is pending to send or to receive */
+	FCGI_EndRequestBody body;
+	if (hctx->opts.upgrade) return; /*(FCGI_KEEP_CONN not sent)*/
+	if (packet->len != sizeof(body)) return;
+	if (hctx->wb.bytes_out != hctx->wb_reqlen) return;
+	char *ptr = (char *)&body;
+	uint32_t rd = sizeof(body);
+	if (chunkqueue_peek_data(hctx->rb,&ptr,&rd,hctx->r->conf.errh,0) < 0)
+		return;
+	if (rd != sizeof(body))
+		return;
+	if (ptr != (char *)&body) /* copy into aligned struct */
+		memcpy(&body, ptr, sizeof(body));
+	if (body.protocolStatus != FCGI_REQUEST_COMPLETE) return;
+	chunkqueue_mark_written(hctx->rb, packet->len);
+	if (chunkqueue_length(hctx->rb) != packet->padding) return;
+	hctx->keep_conn = 1;
 }
 
 __attribute_cold__
@@ -366,9 +399,17 @@ static handler_t fcgi_recv_parse_loop(request_st * const r, handler_ctx * const
 	 */
 	fastcgi_response_packet packet;
 	int fin = 0;
+	int missing;
+
+	if (hctx->rb_skip) { /* discard remaining padding from prior packet */
+		const uint32_t padding = hctx->rb_skip;
+		hctx->rb_skip = 0;
+		fastcgi_skip_padding(hctx, padding);
+	}
+
 	do {
 		/* check if we have at least one packet */
-		if (0 != fastcgi_get_packet(hctx, &packet)) {
+		if (0 != (missing = fastcgi_get_packet(hctx, &packet))) {
 			/* no full packet */
 			break;
 		}
@@ -424,13 +465,12 @@ static handler_t fcgi_recv_parse_loop(request_st * const r, handler_ctx * const
 				}
 			  #endif
 			} else if (hctx->send_content_body) {
-				if (0 != http_response_transfer_cqlen(r, hctx->rb, (size_t)(packet.len - packet.padding))) {
+				if (0 != http_response_transfer_cqlen(r, hctx->rb, (size_t)packet.len)) {
 					/* error writing to tempfile;
 					 * truncate response or send 500 if nothing sent yet */
 					hctx->send_content_body = 0;
 					fin = 1;
 				}
-				if (packet.padding) chunkqueue_mark_written(hctx->rb, packet.padding);
 			} else {
 				chunkqueue_mark_written(hctx->rb, packet.len);
 			}
@@ -447,6 +487,8 @@ static handler_t fcgi_recv_parse_loop(request_st * const r, handler_ctx * const
 		case FCGI_END_REQUEST:
 			hctx->request_id = -1; /*(flag request ended)*/
 			fin = 1;
+			if (hctx->host->keep_conn)
+				fastcgi_end_request_keep_conn(hctx, &packet);
 			break;
 		default:
 			log_error(r->conf.errh, __FILE__, __LINE__,
@@ -454,8 +496,19 @@ static handler_t fcgi_recv_parse_loop(request_st * const r, handler_ctx * const
 			chunkqueue_mark_written(hctx->rb, packet.len);
 			break;
 		}
+
+		if (packet.padding) fastcgi_skip_padding(hctx, packet.padding);
 	} while (0 == fin);
 
+	/* Limit next read to end of FCGI_STDOUT packet content if partially
+	 * received, so that packet content ends at the end of a read chunk.
+	 * Chunks of packet content are then moved to r->write_queue without
+	 * copying (see chunkqueue_steal()) instead of copying partial chunks. */
+	hctx->opts.max_per_read =
+	  (missing > 0 && packet.type == FCGI_STDOUT && r->resp_body_started)
+	    ? (uint32_t)missing
+	    : sizeof(FCGI_Header)+FCGI_MAX_LENGTH+1;
+
 	return 0 == fin ? HANDLER_GO_ON : HANDLER_FINISHED;
 }
 
@@ -35,6 +35,13 @@
  *         "GEOIP_CITY_LONGITUDE" => "location/longitude",
  *     )
  *
+ *     Lookup results are cached per connection and in a per-process cache
+ *     keyed by client address, so that repeated requests from the same
+ *     client (on same or different connections) do not repeat db lookups.
+ *     The per-process cache holds up to 8192 entries; when full, the least
+ *     recently used entry is evicted to cache the result for a new client.
+ *     Entries not used for 60 secs are also removed (checked every 8 secs).
+ *
  * Installation Instructions:
  *     https://redmine.lighttpd.net/projects/lighttpd/wiki/Docs_ModGeoip
  *
@@ -60,6 +67,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "algo_splaytree.h"
 #include "base.h"
 #include "buffer.h"
 #include "http_header.h"
@@ -75,6 +83,7 @@ INIT_FUNC(mod_maxminddb_init);
 FREE_FUNC(mod_maxminddb_free);
 REQUEST_FUNC(mod_maxminddb_request_env_handler);
 CONNECTION_FUNC(mod_maxminddb_handle_con_close);
+TRIGGER_FUNC(mod_maxminddb_periodic);
 
 __attribute_cold__
 __declspec_dllexport__
@@ -88,6 +97,7 @@ int mod_maxminddb_plugin_init(plugin *p) {
     p->cleanup                   = mod_maxminddb_free;
     p->handle_request_env        = mod_maxminddb_request_env_handler;
     p->handle_connection_close   = mod_maxminddb_handle_con_close;
+    p->handle_trigger            = mod_maxminddb_periodic;
 
     return 0;
 }
@@ -102,8 +112,34 @@ typedef struct {
 typedef struct {
     PLUGIN_DATA;
     plugin_config defaults;
+    splay_tree *sptree; /* data in nodes of tree are (mmdb_cache_entry *) */
+    struct mmdb_cache_entry *lru_head; /* most recently used */
+    struct mmdb_cache_entry *lru_tail; /* least recently used */
+    uint32_t cache_used;
 } plugin_data;
 
+/* cache lookup results by client address
+ * (LRU; least recently used entry evicted when MMDB_CACHE_MAX_ENTRIES are
+ *  cached, and entries not used for MMDB_CACHE_MAX_AGE secs are removed by
+ *  periodic cleanup every 8 secs) */
+#define MMDB_CACHE_MAX_AGE 60
+#define MMDB_CACHE_MAX_ENTRIES 8192
+
+typedef struct mmdb_cache_entry {
+  #ifdef HAVE_IPV6
+    struct sockaddr_in6 addr;
+  #else
+    struct sockaddr_in addr;
+  #endif
+    const struct MMDB_s *mmdb; /*(lookup results differ by db and by env)*/
+    const char ***cenv;
+    unix_time64_t atime;
+    array *env;
+    int ndx;                   /* key in p->sptree */
+    struct mmdb_cache_entry *lru_prev;
+    struct mmdb_cache_entry *lru_next;
+} mmdb_cache_entry;
+
 typedef struct {
     const array *env;
     const char ***cenv;
@@ -124,9 +160,22 @@ INIT_FUNC(mod_maxminddb_init)
 }
 
 
+static void
+mod_maxminddb_cache_entry_free (mmdb_cache_entry * const ce)
+{
+    array_free(ce->env);
+    free(ce);
+}
+
+
 FREE_FUNC(mod_maxminddb_free)
 {
     plugin_data * const p = p_d;
+    splay_tree *sptree = p->sptree;
+    while (sptree) {
+        mod_maxminddb_cache_entry_free(sptree->data);
+        sptree = splaytree_delete_splayed_node(sptree);
+    }
     if (NULL == p->cvlist) return;
     /* (init i to 0 if global context; to 1 to skip empty global context) */
     for (int i = !p->cvlist[0].v.u2[1], used = p->nconfig; i < used; ++i) {
@@ -345,7 +394,7 @@ SETDEFAULTS_FUNC(mod_maxminddb_set_defaults)
 
 
 static void
-geoip2_env_set (request_st * const r, array * const env,
+geoip2_env_set (array * const env,
                 const buffer * const kb, MMDB_entry_data_s * const data)
 {
     /* GeoIP2 database interfaces return pointers directly into database,
@@ -401,14 +450,12 @@ geoip2_env_set (request_st * const r, array * const env,
         return;
     }
 
-    http_header_env_set(r, BUF_PTR_LEN(kb), v, vlen);
-    if (env)
-        array_set_key_value(env, BUF_PTR_LEN(kb), v, vlen);
+    array_set_key_value(env, BUF_PTR_LEN(kb), v, vlen);
 }
 
 
 static void
-mod_maxminddb_geoip2 (request_st * const r, array * const env,
+mod_maxminddb_geoip2 (array * const env,
                       const struct sockaddr * const dst_addr,
                       plugin_config * const pconf)
 {
@@ -425,12 +472,151 @@ mod_maxminddb_geoip2 (request_st * const r, array * const env,
     for (size_t i = 0, used = pconf->env->used; i < used; ++i) {
         if (MMDB_SUCCESS == MMDB_aget_value(entry, &data, cenv[i])
             && data.has_data) {
-            geoip2_env_set(r, env, &names[i]->key, &data);
+            geoip2_env_set(env, &names[i]->key, &data);
         }
     }
 }
 
 
+static void
+mod_maxminddb_env_apply (request_st * const r, const array * const env)
+{
+    for (uint32_t i = 0; i < env->used; ++i) {
+        /* note: replaces values which may have been set by mod_openssl
+         *(when mod_extforward listed after mod_openssl in server.modules)*/
+        const data_string * const ds = (data_string *)env->data[i];
+        http_header_env_set(r, BUF_PTR_LEN(&ds->key), BUF_PTR_LEN(&ds->value));
+    }
+}
+
+
+static void
+mod_maxminddb_env_copy (array * const dst, const array * const env)
+{
+    for (uint32_t i = 0; i < env->used; ++i) {
+        const data_string * const ds = (data_string *)env->data[i];
+        array_set_key_value(dst, BUF_PTR_LEN(&ds->key), BUF_PTR_LEN(&ds->value));
+    }
+}
+
+
+__attribute_pure__
+static int
+mod_maxminddb_cache_hash (const sock_addr * const addr,
+                          const plugin_config * const pconf)
+{
+    /* (similar to splaytree_djbhash(), but with db, env, and addr hashed) */
+    uint32_t h = /*(hash pointer values)*/
+      djbhash((const char *)&pconf->mmdb, sizeof(pconf->mmdb), DJBHASH_INIT);
+    h = djbhash((const char *)&pconf->cenv, sizeof(pconf->cenv), h);
+    if (sock_addr_get_family(addr) == AF_INET)
+        h = djbhash((const char *)&addr->ipv4.sin_addr,
+                    sizeof(addr->ipv4.sin_addr), h);
+  #ifdef HAVE_IPV6
+    else
+        h = djbhash((const char *)&addr->ipv6.sin6_addr,
+                    sizeof(addr->ipv6.sin6_addr), h);
+  #endif
+    return (int32_t)h;
+}
+
+
+static void
+mod_maxminddb_lru_unlink (plugin_data * const p, mmdb_cache_entry * const ce)
+{
+    if (ce->lru_prev) ce->lru_prev->lru_next = ce->lru_next;
+    else p->lru_head = ce->lru_next;
+    if (ce->lru_next) ce->lru_next->lru_prev = ce->lru_prev;
+    else p->lru_tail = ce->lru_prev;
+    ce->lru_prev = ce->lru_next = NULL;
+}
+
+
+static void
+mod_maxminddb_lru_push (plugin_data * const p, mmdb_cache_entry * const ce)
+{
+    ce->lru_prev = NULL;
+    ce->lru_next = p->lru_head;
+    if (p->lru_head) p->lru_head->lru_prev = ce;
+    else p->lru_tail = ce;
+    p->lru_head = ce;
+}
+
+
+static void
+mod_maxminddb_cache_remove (plugin_data * const p, mmdb_cache_entry * const ce)
+{
+    mod_maxminddb_lru_unlink(p, ce);
+    p->sptree = splaytree_splay_nonnull(p->sptree, ce->ndx);
+    p->sptree = splaytree_delete_splayed_node(p->sptree);
+    --p->cache_used;
+    mod_maxminddb_cache_entry_free(ce);
+}
+
+
+static mmdb_cache_entry *
+mod_maxminddb_cache_query (plugin_data * const p, const int ndx,
+                           const sock_addr * const addr,
+                           const plugin_config * const pconf)
+{
+    p->sptree = splaytree_splay(p->sptree, ndx);
+    if (NULL == p->sptree || p->sptree->key != ndx) return NULL;
+    mmdb_cache_entry * const ce = p->sptree->data;
+    return (ce->mmdb == pconf->mmdb && ce->cenv == pconf->cenv
+            && sock_addr_is_addr_eq((sock_addr *)&ce->addr, addr))
+      ? ce
+      : NULL; /*(hash collision)*/
+}
+
+
+static void
+mod_maxminddb_cache_insert (plugin_data * const p, const int ndx,
+                            mmdb_cache_entry * const ce)
+{
+    ce->ndx = ndx;
+    /*(not necessary to re-splay (with current usage) since single-threaded
+     * and splaytree has not been modified since cache query)*/
+    if (NULL == p->sptree || p->sptree->key != ndx) {
+        if (p->cache_used >= MMDB_CACHE_MAX_ENTRIES) {
+            /* cache full; evict least recently used entry */
+            mod_maxminddb_cache_remove(p, p->lru_tail);
+            p->sptree = splaytree_splay(p->sptree, ndx);
+        }
+        p->sptree = splaytree_insert_splayed(p->sptree, ndx, ce);
+        ++p->cache_used;
+    }
+    else { /* collision; replace old entry */
+        mmdb_cache_entry * const oce = p->sptree->data;
+        mod_maxminddb_lru_unlink(p, oce);
+        mod_maxminddb_cache_entry_free(oce);
+        p->sptree->data = ce;
+    }
+    mod_maxminddb_lru_push(p, ce);
+}
+
+
+__attribute_noinline__
+static void
+mod_maxminddb_periodic_cleanup (plugin_data * const p, const unix_time64_t ts)
+{
+    /* remove entries not used since ts (from least recently used) */
+    while (p->lru_tail && p->lru_tail->atime < ts)
+        mod_maxminddb_cache_remove(p, p->lru_tail);
+}
+
+
+TRIGGER_FUNC(mod_maxminddb_periodic)
+{
+    plugin_data * const p = p_d;
+    const unix_time64_t cur_ts = log_monotonic_secs;
+    if (cur_ts & 0x7) return HANDLER_GO_ON; /*(continue once each 8 sec)*/
+    UNUSED(srv);
+    if (p->sptree)
+        mod_maxminddb_periodic_cleanup(p, cur_ts - MMDB_CACHE_MAX_AGE);
+    return HANDLER_GO_ON;
+}
+
+
 REQUEST_FUNC(mod_maxminddb_request_env_handler)
 {
     plugin_config pconf;
@@ -450,9 +636,13 @@ REQUEST_FUNC(mod_maxminddb_request_env_handler)
      * initial request env */
     if (!pconf.cache) { /*(not implemented)*/
         const int sa_family = sock_addr_get_family(dst_addr);
-        if (sa_family == AF_INET && sa_family == AF_INET6)
-            mod_maxminddb_geoip2(r, NULL,
-                                 (const struct sockaddr *)dst_addr, &pconf);
+        if (sa_family == AF_INET || sa_family == AF_INET6) {
+            array * const env = array_init(pconf.env->used);
+            mod_maxminddb_geoip2(env, (const struct sockaddr *)dst_addr,
+                                 &pconf);
+            mod_maxminddb_env_apply(r, env);
+            array_free(env);
+        }
         return HANDLER_GO_ON;
     }
   #endif
@@ -460,17 +650,14 @@ REQUEST_FUNC(mod_maxminddb_request_env_handler)
     handler_ctx ** const hctx = (handler_ctx **)&r->con->plugin_ctx[p->id];
 
     if (*hctx && sock_addr_is_addr_eq((sock_addr *)&(*hctx)->addr, dst_addr)) {
-        const array * const env = (*hctx)->env;
-        for (uint32_t i = 0; i < env->used; ++i) {
-            /* note: replaces values which may have been set by mod_openssl
-             *(when mod_extforward listed after mod_openssl in server.modules)*/
-            const data_string * const ds = (data_string *)env->data[i];
-            http_header_env_set(r, BUF_PTR_LEN(&ds->key),
-                                   BUF_PTR_LEN(&ds->value));
-        }
+        mod_maxminddb_env_apply(r, (*hctx)->env);
         return HANDLER_GO_ON;
     }
 
+    const int sa_family = sock_addr_get_family(dst_addr);
+    if (sa_family != AF_INET && sa_family != AF_INET6)
+        return HANDLER_GO_ON;
+
     array *env = NULL;
     if (*hctx && r->http_version <= HTTP_VERSION_1_1) {
         env = (*hctx)->env;
@@ -483,9 +670,6 @@ REQUEST_FUNC(mod_maxminddb_request_env_handler)
     }
 
     if (env) { /* then (env == (*hctx)->env) else (env == NULL) */
-        const int sa_family = sock_addr_get_family(dst_addr);
-        if (sa_family != AF_INET && sa_family != AF_INET6)
-            return HANDLER_GO_ON;
         if (sa_family == AF_INET)
             memcpy(&(*hctx)->addr, dst_addr, sizeof(dst_addr->ipv4));
       #ifdef HAVE_IPV6
@@ -494,7 +678,31 @@ REQUEST_FUNC(mod_maxminddb_request_env_handler)
       #endif
     }
 
-    mod_maxminddb_geoip2(r, env, (const struct sockaddr *)dst_addr, &pconf);
+    /* check per-process cache of lookup results by client address */
+    const int ndx = mod_maxminddb_cache_hash(dst_addr, &pconf);
+    mmdb_cache_entry *ce = mod_maxminddb_cache_query(p, ndx, dst_addr, &pconf);
+    if (NULL == ce) {
+        ce = ck_malloc(sizeof(mmdb_cache_entry));
+        if (sa_family == AF_INET)
+            memcpy(&ce->addr, dst_addr, sizeof(dst_addr->ipv4));
+      #ifdef HAVE_IPV6
+        else
+            memcpy(&ce->addr, dst_addr, sizeof(dst_addr->ipv6));
+      #endif
+        ce->mmdb = pconf.mmdb;
+        ce->cenv = pconf.cenv;
+        ce->env = array_init(pconf.env->used);
+        mod_maxminddb_geoip2(ce->env, (const struct sockaddr *)dst_addr, &pconf);
+        mod_maxminddb_cache_insert(p, ndx, ce);
+    }
+    else if (ce != p->lru_head) {
+        mod_maxminddb_lru_unlink(p, ce);
+        mod_maxminddb_lru_push(p, ce);
+    }
+    ce->atime = log_monotonic_secs;
+
+    mod_maxminddb_env_apply(r, ce->env);
+    if (env) mod_maxminddb_env_copy(env, ce->env);
 
     return HANDLER_GO_ON;
 }
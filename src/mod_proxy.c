@@ -3,11 +3,17 @@
 #include <string.h>
 #include <stdlib.h>
 
+#include "sys-socket.h"
+#include "sys-unistd.h" /* <unistd.h> */
+#include <errno.h>
+
 #include "gw_backend.h"
 #include "base.h"
 #include "array.h"
 #include "buffer.h"
+#include "chunk.h"
 #include "fdevent.h"
+#include "h2.h"
 #include "http_kv.h"
 #include "http_header.h"
 #include "log.h"
@@ -30,6 +36,7 @@ typedef struct http_header_remap_opts {
     int https_remap;
     int upgrade;
     int connect_method;
+    int h2c;
     /*(not used in plugin_config, but used in handler_ctx)*/
     const buffer *http_host;
     const buffer *forwarded_host;
@@ -61,9 +68,18 @@ typedef struct {
 
 static int proxy_check_extforward;
 
-typedef struct {
+struct proxy_h2con;     /* declaration */
+
+typedef struct handler_ctx {
 	gw_handler_ctx gw;
 	plugin_config conf;
+	struct proxy_h2con *h2c;    /* HTTP/2 connection carrying stream */
+	struct handler_ctx *h2next; /* next stream on h2c */
+	uint32_t h2id;              /* HTTP/2 stream id */
+	 int32_t h2swin;            /* stream send window */
+	 int32_t h2rwin;            /* stream recv window */
+	uint8_t h2;                 /* send request to backend over HTTP/2 */
+	uint8_t h2state;            /* PROXY_H2_* stream flags */
 } handler_ctx;
 
 
@@ -91,8 +107,11 @@ static void mod_proxy_free_config(plugin_data * const p)
 }
 
 
+static void proxy_h2con_free_all(void);
+
 FREE_FUNC(mod_proxy_free) {
     plugin_data * const p = p_d;
+    proxy_h2con_free_all();
     mod_proxy_free_config(p);
     gw_free(p);
 }
@@ -240,6 +259,17 @@ static http_header_remap_opts * mod_proxy_parse_header_opts(server *srv, const a
             header.connect_method = val;
             continue;
         }
+        else if (buffer_eq_slen(&da->key, CONST_STR_LEN("h2c"))) {
+            int val = config_plugin_value_tobool((data_unset *)da, 2);
+            if (2 == val) {
+                log_error(srv->errh, __FILE__, __LINE__,
+                  "unexpected value for proxy.header; "
+                  "expected \"h2c\" => \"enable\" or \"disable\"");
+                return NULL;
+            }
+            header.h2c = val;
+            continue;
+        }
         if (da->type != TYPE_ARRAY || !array_is_kvstring(&da->value)) {
             log_error(srv->errh, __FILE__, __LINE__,
               "unexpected value for proxy.header; "
@@ -1036,7 +1066,7 @@ static handler_t proxy_create_env(gw_handler_ctx *gwhctx) {
 			chunkqueue_append_chunkqueue(&hctx->gw.wb, &r->reqbody_queue);
 	}
 
-	plugin_stats_inc("proxy.requests");
+	++(*hctx->gw.host->stats_requests); /* "proxy.requests" */
 	return HANDLER_GO_ON;
 }
 
@@ -1049,7 +1079,7 @@ static handler_t proxy_create_env_connect(gw_handler_ctx *gwhctx) {
 	gw_set_transparent(&hctx->gw);
 	http_response_upgrade_read_body_unknown(r);
 
-	plugin_stats_inc("proxy.requests");
+	++(*hctx->gw.host->stats_requests); /* "proxy.requests" */
 	return HANDLER_GO_ON;
 }
 
@@ -1088,6 +1118,1192 @@ static handler_t proxy_response_headers(request_st * const r, struct http_respon
     return HANDLER_GO_ON;
 }
 
+/* HTTP/2 upstream (h2c with prior knowledge)
+ *
+ * proxy.header += ( "h2c" => "enable" ) sends requests (except CONNECT and
+ * requests with Upgrade) to the backend as streams multiplexed over one or
+ * more HTTP/2 connections per backend proc.  A connection is shared by up to
+ * peer SETTINGS_MAX_CONCURRENT_STREAMS requests and is kept open while idle
+ * for up to the host "idle-timeout".  Response headers are decoded into
+ * HTTP/1.1 header text and processed by http_response_parse_headers(), same
+ * as responses from HTTP/1.x backends.
+ */
+
+#define PROXY_H2_STREAM_WINDOW 262144   /* SETTINGS_INITIAL_WINDOW_SIZE */
+#define PROXY_H2_CONN_WINDOW   16777216 /* connection recv window */
+#define PROXY_H2_MAX_FRAME     16384    /* SETTINGS_MAX_FRAME_SIZE (default) */
+
+enum {
+  PROXY_H2_SENT_END  = 0x01, /* END_STREAM sent */
+  PROXY_H2_RECV_HDRS = 0x02, /* response headers received (in hctx->gw.response) */
+  PROXY_H2_RECV_END  = 0x04, /* END_STREAM received */
+  PROXY_H2_RESET     = 0x08, /* stream reset or connection closed */
+  PROXY_H2_RETRY     = 0x10, /* stream was not processed by backend */
+  PROXY_H2_TIMEOUT   = 0x20  /* stream reset due to read timeout */
+};
+
+typedef struct proxy_h2con {
+    struct proxy_h2con *next;
+    handler_ctx *streams;
+    gw_host *host;
+    gw_proc *proc;
+    server *srv;
+    fdnode *fdn;
+    int fd;
+    pid_t pid;
+    uint8_t connected;
+    uint8_t goaway;           /* no new streams on connection */
+    uint8_t hb_flags;         /* HEADERS flags awaiting CONTINUATION */
+    uint32_t hb_id;           /* HEADERS stream id awaiting CONTINUATION */
+    uint32_t next_id;
+    uint32_t nstreams;
+    uint32_t s_max_concurrent_streams;
+     int32_t s_initial_window_size;
+    uint32_t s_max_frame_size;
+     int32_t swin;            /* connection send window */
+     int32_t rwin;            /* connection recv window */
+    unix_time64_t write_ts;
+    unix_time64_t idle_ts;
+    buffer *hb;               /* header block (HEADERS + CONTINUATION) */
+    chunkqueue rq;
+    chunkqueue wq;
+    struct lshpack_dec decoder;
+    struct lshpack_enc encoder;
+} proxy_h2con;
+
+static proxy_h2con *proxy_h2cons;
+
+
+static uint32_t proxy_h2_u24 (const uint8_t * const s) {
+    return ((uint32_t)s[0] << 16) | ((uint32_t)s[1] << 8) | s[2];
+}
+
+
+static uint32_t proxy_h2_u31 (const uint8_t * const s) {
+    return ((uint32_t)(s[0] & 0x7f) << 24) | ((uint32_t)s[1] << 16)
+         | ((uint32_t)s[2] << 8) | s[3];
+}
+
+
+static void proxy_h2_frame_hdr (char * const s, const uint32_t len, const int type, const int flags, const uint32_t id) {
+    s[0] = (char)(len >> 16);
+    s[1] = (char)(len >> 8);
+    s[2] = (char)len;
+    s[3] = (char)type;
+    s[4] = (char)flags;
+    s[5] = (char)(id >> 24);
+    s[6] = (char)(id >> 16);
+    s[7] = (char)(id >> 8);
+    s[8] = (char)id;
+}
+
+
+static void proxy_h2_send_u32 (proxy_h2con * const h2c, const int type, const uint32_t id, const uint32_t v) {
+    /* WINDOW_UPDATE or RST_STREAM */
+    char s[13];
+    proxy_h2_frame_hdr(s, 4, type, 0, id);
+    s[9]  = (char)(v >> 24);
+    s[10] = (char)(v >> 16);
+    s[11] = (char)(v >> 8);
+    s[12] = (char)v;
+    chunkqueue_append_mem_min(&h2c->wq, s, sizeof(s));
+}
+
+
+static void proxy_h2_send_goaway (proxy_h2con * const h2c, const uint32_t e) {
+    char s[17];
+    proxy_h2_frame_hdr(s, 8, H2_FTYPE_GOAWAY, 0, 0);
+    memset(s+9, 0, 4); /* last-stream-id 0 (no streams initiated by peer) */
+    s[13] = (char)(e >> 24);
+    s[14] = (char)(e >> 16);
+    s[15] = (char)(e >> 8);
+    s[16] = (char)e;
+    chunkqueue_append_mem_min(&h2c->wq, s, sizeof(s));
+    h2c->goaway = 1;
+}
+
+
+static void proxy_h2_send_hpack (proxy_h2con * const h2c, const uint32_t id, const buffer * const hb, int flags) {
+    /* send header block in HEADERS frame and CONTINUATION frame(s) */
+    const char *data = hb->ptr;
+    uint32_t dlen = buffer_clen(hb);
+    const uint32_t fsize = h2c->s_max_frame_size;
+    buffer * const b =
+      chunkqueue_append_buffer_open_sz(&h2c->wq, dlen + (dlen/fsize+1)*9 + 1);
+    char *ptr = b->ptr;
+    int type = H2_FTYPE_HEADERS;
+    do {
+        const uint32_t len = dlen < fsize ? dlen : fsize;
+        if (len == dlen)
+            flags |= H2_FLAG_END_HEADERS;
+        proxy_h2_frame_hdr(ptr, len, type, flags, id);
+        memcpy(ptr+9, data, len);
+        ptr  += 9 + len;
+        data += len;
+        dlen -= len;
+        type = H2_FTYPE_CONTINUATION;
+        flags = 0;
+    } while (dlen);
+    buffer_truncate(b, (uint32_t)(ptr - b->ptr));
+    chunkqueue_append_buffer_commit(&h2c->wq);
+}
+
+
+static int proxy_h2_hpack (proxy_h2con * const h2c, buffer * const hb, const buffer * const tb, const uint32_t klen) {
+    /* encode header from tb (lowercase field-name followed by field-value)*/
+    const uint32_t tlen = buffer_clen(tb);
+    if (tlen > LSXPACK_MAX_STRLEN) return 0;
+    lsxpack_header_t lsx;
+    memset(&lsx, 0, sizeof(lsxpack_header_t));
+    lsx.buf = tb->ptr;
+    lsx.name_offset = 0;
+    lsx.name_len = klen;
+    lsx.val_offset = klen;
+    lsx.val_len = tlen - klen;
+    /* (encoded length is at most a few bytes more than field length) */
+    buffer_string_prepare_append(hb, tlen + 16);
+    unsigned char * const dst = (unsigned char *)hb->ptr + buffer_clen(hb);
+    unsigned char * const end = (unsigned char *)hb->ptr + hb->size - 1;
+    unsigned char * const n = lshpack_enc_encode(&h2c->encoder, dst, end, &lsx);
+    buffer_commit(hb, (size_t)(n - dst));
+    return (n != dst);
+}
+
+
+static void proxy_h2_tb_kv (buffer * const tb, const char * const k, const uint32_t klen, const char * const v, const uint32_t vlen) {
+    /* HTTP/2 requires lowercase field-names */
+    char * const s = buffer_string_prepare_copy(tb, klen + vlen);
+    for (uint32_t j = 0; j < klen; ++j)
+        s[j] = !light_isupper(k[j]) ? k[j] : (k[j] | 0x20);
+    memcpy(s+klen, v, vlen);
+    buffer_commit(tb, klen + vlen);
+}
+
+
+static int proxy_h2_send_headers (proxy_h2con * const h2c, handler_ctx * const hctx, request_st * const r, const int flags) {
+    const int remap_headers = (NULL != hctx->conf.header.urlpaths
+                               || NULL != hctx->conf.header.hosts_request);
+    buffer * const hb = chunk_buffer_acquire();
+    buffer * const tb = chunk_buffer_acquire();
+    int ok;
+
+    const buffer * const m = http_method_buf(r->http_method);
+    proxy_h2_tb_kv(tb, CONST_STR_LEN(":method"), BUF_PTR_LEN(m));
+    ok = proxy_h2_hpack(h2c, hb, tb, sizeof(":method")-1);
+
+    proxy_h2_tb_kv(tb, CONST_STR_LEN(":scheme"), CONST_STR_LEN("http"));
+    ok &= proxy_h2_hpack(h2c, hb, tb, sizeof(":scheme")-1);
+
+    if (hctx->conf.replace_http_host && !buffer_is_blank(hctx->gw.host->id)) {
+        proxy_h2_tb_kv(tb, CONST_STR_LEN(":authority"),
+                           BUF_PTR_LEN(hctx->gw.host->id));
+        ok &= proxy_h2_hpack(h2c, hb, tb, sizeof(":authority")-1);
+    }
+    else if (r->http_host && !buffer_is_unset(r->http_host)) {
+        proxy_h2_tb_kv(tb, CONST_STR_LEN(":authority"),
+                           BUF_PTR_LEN(r->http_host));
+        if (remap_headers)
+            http_header_remap_host(tb, sizeof(":authority")-1,
+                                   &hctx->conf.header, 1,
+                                   buffer_clen(r->http_host));
+        ok &= proxy_h2_hpack(h2c, hb, tb, sizeof(":authority")-1);
+    }
+
+    proxy_h2_tb_kv(tb, CONST_STR_LEN(":path"), BUF_PTR_LEN(&r->target));
+    if (remap_headers)
+        http_header_remap_uri(tb, sizeof(":path")-1, &hctx->conf.header, 1);
+    ok &= proxy_h2_hpack(h2c, hb, tb, sizeof(":path")-1);
+
+    for (uint32_t i = 0, used = r->rqst_headers.used; i < used; ++i) {
+        const data_string * const ds = (data_string *)r->rqst_headers.data[i];
+        int remap = 0;
+        switch (ds->ext) {
+        default:
+            break;
+        case HTTP_HEADER_HOST:          /*(sent as :authority)*/
+        case HTTP_HEADER_CONNECTION:    /*(connection-specific headers)*/
+        case HTTP_HEADER_TRANSFER_ENCODING:
+        case HTTP_HEADER_UPGRADE:
+        case HTTP_HEADER_HTTP2_SETTINGS:
+        case HTTP_HEADER_SET_COOKIE:    /*(response header only)*/
+            continue;
+        case HTTP_HEADER_TE:
+            /* ignore if not exactly "trailers" */
+            if (!buffer_eq_icase_slen(&ds->value, CONST_STR_LEN("trailers")))
+                continue;
+            break;
+        case HTTP_HEADER_CONTENT_LOCATION:
+            remap = remap_headers;
+            break;
+        case HTTP_HEADER_OTHER:
+            switch (buffer_clen(&ds->key)) {
+              case 5:
+                /* Do not emit HTTP_PROXY in environment.
+                 * Some executables use HTTP_PROXY to configure
+                 * outgoing proxy.  See also https://httpoxy.org/ */
+                if (buffer_eq_icase_slen(&ds->key, CONST_STR_LEN("Proxy")))
+                    continue;
+                break;
+              case 10:
+                if (buffer_eq_icase_slen(&ds->key,CONST_STR_LEN("Keep-Alive")))
+                    continue;
+                break;
+              case 11: /* "Destination" is WebDAV request header */
+                if (buffer_eq_icase_slen(&ds->key,CONST_STR_LEN("Destination")))
+                    remap = remap_headers;
+                break;
+              case 16:
+                if (buffer_eq_icase_slen(&ds->key,
+                                         CONST_STR_LEN("Proxy-Connection")))
+                    continue;
+                break;
+              default:
+                break;
+            }
+            break;
+        }
+
+        const uint32_t klen = buffer_clen(&ds->key);
+        const uint32_t vlen = buffer_clen(&ds->value);
+        if (0 == klen || 0 == vlen) continue;
+        proxy_h2_tb_kv(tb, ds->key.ptr, klen, ds->value.ptr, vlen);
+        if (remap)
+            http_header_remap_uri(tb, klen, &hctx->conf.header, 1);
+        ok &= proxy_h2_hpack(h2c, hb, tb, klen);
+    }
+
+    if (ok)
+        proxy_h2_send_hpack(h2c, hctx->h2id, hb, flags);
+    else /*(encoder state no longer matches peer decoder; no new streams)*/
+        h2c->goaway = 1;
+
+    chunk_buffer_release(tb);
+    chunk_buffer_release(hb);
+    return ok;
+}
+
+
+static int proxy_h2_reqbody_done (const request_st * const r) {
+    return r->reqbody_length >= 0
+        && r->reqbody_queue.bytes_in == r->reqbody_length;
+}
+
+
+static void proxy_h2_send_data (proxy_h2con * const h2c, handler_ctx * const hctx) {
+    /* send request body from hctx->gw.wb within flow control windows */
+    request_st * const r = hctx->gw.r;
+    chunkqueue * const cq = &hctx->gw.wb;
+    const int done = proxy_h2_reqbody_done(r)
+                  && chunkqueue_is_empty(&r->reqbody_queue);
+    off_t len = chunkqueue_length(cq);
+    while (len > 0) {
+        off_t n = len;
+        if (n > hctx->h2swin)          n = hctx->h2swin;
+        if (n > h2c->swin)             n = h2c->swin;
+        if (n > h2c->s_max_frame_size) n = h2c->s_max_frame_size;
+        if (n <= 0) return;
+        len -= n;
+        char s[9];
+        proxy_h2_frame_hdr(s, (uint32_t)n, H2_FTYPE_DATA,
+                           (done && 0 == len) ? H2_FLAG_END_STREAM : 0,
+                           hctx->h2id);
+        chunkqueue_append_mem_min(&h2c->wq, s, sizeof(s));
+        chunkqueue_steal(&h2c->wq, cq, n);
+        hctx->h2swin -= (int32_t)n;
+        h2c->swin -= (int32_t)n;
+        if (done && 0 == len) {
+            hctx->h2state |= PROXY_H2_SENT_END;
+            return;
+        }
+    }
+    if (done) {
+        char s[9];
+        proxy_h2_frame_hdr(s, 0, H2_FTYPE_DATA, H2_FLAG_END_STREAM, hctx->h2id);
+        chunkqueue_append_mem_min(&h2c->wq, s, sizeof(s));
+        hctx->h2state |= PROXY_H2_SENT_END;
+    }
+}
+
+
+static void proxy_h2_stream_detach (handler_ctx * const hctx) {
+    proxy_h2con * const h2c = hctx->h2c;
+    handler_ctx **h = &h2c->streams;
+    while (*h != hctx) h = &(*h)->h2next;
+    *h = hctx->h2next;
+    hctx->h2next = NULL;
+    hctx->h2c = NULL;
+    if (0 == --h2c->nstreams)
+        h2c->idle_ts = log_monotonic_secs;
+}
+
+
+static void proxy_h2_stream_reset (handler_ctx * const hctx, const int flags) {
+    hctx->h2state |= PROXY_H2_RESET | flags;
+    proxy_h2_stream_detach(hctx);
+    joblist_append(hctx->gw.con);
+}
+
+
+static handler_ctx * proxy_h2_stream_get (const proxy_h2con * const h2c, const uint32_t id) {
+    handler_ctx *hctx = h2c->streams;
+    while (hctx && hctx->h2id != id) hctx = hctx->h2next;
+    return hctx;
+}
+
+
+static void proxy_h2con_close (proxy_h2con * const h2c) {
+    /* requests on connection are retried if nothing was received from peer*/
+    const int retry = (0 == h2c->rq.bytes_in) ? PROXY_H2_RETRY : 0;
+    while (h2c->streams)
+        proxy_h2_stream_reset(h2c->streams, retry);
+
+    proxy_h2con **h = &proxy_h2cons;
+    while (*h != h2c) h = &(*h)->next;
+    *h = h2c->next;
+
+    fdevent_fdnode_event_del(h2c->srv->ev, h2c->fdn);
+    fdevent_sched_close(h2c->srv->ev, h2c->fdn);
+    buffer_free(h2c->hb);
+    chunkqueue_reset(&h2c->rq);
+    chunkqueue_reset(&h2c->wq);
+    lshpack_enc_cleanup(&h2c->encoder);
+    lshpack_dec_cleanup(&h2c->decoder);
+    free(h2c);
+}
+
+
+static void proxy_h2con_free_all (void) {
+    while (proxy_h2cons)
+        proxy_h2con_close(proxy_h2cons);
+}
+
+
+static int proxy_h2con_write (proxy_h2con * const h2c) {
+    if (!h2c->connected) return 0; /*(FDEVENT_OUT set while connecting)*/
+    if (!chunkqueue_is_empty(&h2c->wq)) {
+        server * const srv = h2c->srv;
+        if (srv->network_backend_write(h2c->fd, &h2c->wq, MAX_WRITE_LIMIT,
+                                       srv->errh) < 0)
+            return -1;
+        h2c->write_ts = log_monotonic_secs;
+    }
+    if (chunkqueue_is_empty(&h2c->wq))
+        fdevent_fdnode_event_clr(h2c->srv->ev, h2c->fdn, FDEVENT_OUT);
+    else
+        fdevent_fdnode_event_add(h2c->srv->ev, h2c->fdn, FDEVENT_OUT);
+    return 0;
+}
+
+
+static void proxy_h2con_send_pending (proxy_h2con * const h2c) {
+    /* send request body blocked by flow control after window increased */
+    for (handler_ctx *hctx = h2c->streams; hctx; hctx = hctx->h2next) {
+        if (hctx->h2state & PROXY_H2_SENT_END) continue;
+        if (chunkqueue_is_empty(&hctx->gw.wb)
+            && !proxy_h2_reqbody_done(hctx->gw.r)) continue;
+        proxy_h2_send_data(h2c, hctx);
+        joblist_append(hctx->gw.con); /*(to read more request body)*/
+    }
+}
+
+
+static int proxy_h2_hdr_invalid (const char * const s, const uint32_t len) {
+    for (uint32_t i = 0; i < len; ++i) {
+        if (s[i] == '\r' || s[i] == '\n' || s[i] == '\0') return 1;
+    }
+    return 0;
+}
+
+
+static int proxy_h2_hdr_name_invalid (const char * const s, const uint32_t len) {
+    /* HTTP/2 field names must be lowercase; ':' only leads pseudo-headers
+     * (RFC 9113 Section 8.2.1) */
+    for (uint32_t i = 0; i < len; ++i) {
+        if (light_isupper(s[i]) || s[i] == ':') return 1;
+    }
+    return proxy_h2_hdr_invalid(s, len);
+}
+
+
+static int proxy_h2_recv_headers (proxy_h2con * const h2c, handler_ctx * const hctx, const unsigned char *src, const unsigned char * const end) {
+    /* decode header block into HTTP/1.1 response header text
+     * (header block must be decoded even if stream is not active in order
+     *  to keep decoder state in sync with peer encoder) */
+    /*(proxy_h2con_open() resized srv->tmp_buf to 64k, as in h2_init_con())*/
+    buffer * const tb = h2c->srv->tmp_buf;
+    buffer * const b = (NULL != hctx && !(hctx->h2state & PROXY_H2_RECV_HDRS))
+      ? hctx->gw.response
+      : NULL; /*(trailers are discarded)*/
+    const uint32_t blen = b ? buffer_clen(b) : 0;
+    const lsxpack_strlen_t tbsz = (tb->size <= LSXPACK_MAX_STRLEN)
+      ? tb->size
+      : LSXPACK_MAX_STRLEN;
+    int status = 0, malformed = 0;
+    lsxpack_header_t lsx;
+    while (src < end) {
+        memset(&lsx, 0, sizeof(lsxpack_header_t));
+        lsx.buf = tb->ptr;
+        lsx.val_len = tbsz;
+        if (LSHPACK_OK != lshpack_dec_decode(&h2c->decoder, &src, end, &lsx)
+            || 0 == lsx.name_len)
+            return 0; /* COMPRESSION_ERROR */
+        if (NULL == b || malformed) continue;
+        const char * const k = lsx.buf + lsx.name_offset;
+        const char * const v = lsx.buf + lsx.val_offset;
+        if (k[0] == ':') {
+            if (0 == status && lsx.name_len == 7 && 0 == memcmp(k, ":status", 7)
+                && lsx.val_len == 3 && light_isdigit(v[0])
+                && light_isdigit(v[1]) && light_isdigit(v[2])) {
+                status = v[0];
+                buffer_append_str3(b, CONST_STR_LEN("HTTP/1.1 "), v, 3,
+                                      CONST_STR_LEN("\r\n"));
+            }
+            else
+                malformed = 1;
+        }
+        else if (0 == status
+                 || proxy_h2_hdr_name_invalid(k, lsx.name_len)
+                 || proxy_h2_hdr_invalid(v, lsx.val_len))
+            malformed = 1;
+        else {
+            buffer_append_str3(b, k, lsx.name_len, CONST_STR_LEN(": "),
+                                  v, lsx.val_len);
+            buffer_append_string_len(b, CONST_STR_LEN("\r\n"));
+        }
+    }
+
+    if (NULL == b) return 1;
+    if (malformed || 0 == status) {
+        buffer_truncate(b, blen);
+        proxy_h2_send_u32(h2c, H2_FTYPE_RST_STREAM, hctx->h2id,
+                          H2_E_PROTOCOL_ERROR);
+        proxy_h2_stream_reset(hctx, 0);
+    }
+    else if (status == '1') /* discard 1xx informational response */
+        buffer_truncate(b, blen);
+    else {
+        buffer_append_string_len(b, CONST_STR_LEN("\r\n"));
+        hctx->h2state |= PROXY_H2_RECV_HDRS;
+        hctx->gw.read_ts = log_monotonic_secs;
+        joblist_append(hctx->gw.con);
+    }
+    return 1;
+}
+
+
+static void proxy_h2_recv_end_stream (proxy_h2con * const h2c, handler_ctx * const hctx) {
+    hctx->h2state |= PROXY_H2_RECV_END;
+    if (!(hctx->h2state & PROXY_H2_SENT_END)) {
+        /* response complete before request body was sent; close stream */
+        proxy_h2_send_u32(h2c, H2_FTYPE_RST_STREAM, hctx->h2id, H2_E_NO_ERROR);
+        hctx->h2state |= PROXY_H2_SENT_END;
+    }
+    proxy_h2_stream_detach(hctx);
+    joblist_append(hctx->gw.con);
+}
+
+
+static int proxy_h2_recv_header_block (proxy_h2con * const h2c, const uint8_t * const s, const uint32_t flen) {
+    /* s is complete HEADERS frame (or HEADERS with CONTINUATION collected) */
+    const uint32_t id = proxy_h2_u31(s+5);
+    const uint8_t flags = s[4];
+    const unsigned char *psrc = s + 9;
+    uint32_t alen = flen;
+    if (0 == id || !(id & 1)) return 0; /* PROTOCOL_ERROR */
+    if (flags & H2_FLAG_PADDED) {
+        if (0 == alen || alen - 1 < s[9]) return 0;
+        alen -= 1 + s[9];
+        ++psrc;
+    }
+    if (flags & H2_FLAG_PRIORITY) {
+        if (alen < 5) return 0;
+        alen -= 5;
+        psrc += 5;
+    }
+
+    handler_ctx * const hctx = proxy_h2_stream_get(h2c, id);
+    if (!proxy_h2_recv_headers(h2c, hctx, psrc, psrc + alen))
+        return 0;
+    if ((flags & H2_FLAG_END_STREAM) && hctx && hctx->h2c)
+        proxy_h2_recv_end_stream(h2c, hctx);
+    return 1;
+}
+
+
+static int proxy_h2_recv_settings (proxy_h2con * const h2c, const uint8_t * const s, const uint32_t flen) {
+    if (s[4] & H2_FLAG_ACK) return 1;
+    if (flen % 6) return 0; /* FRAME_SIZE_ERROR */
+    for (uint32_t i = 9; i < 9 + flen; i += 6) {
+        const uint32_t v = ((uint32_t)s[i+2] << 24) | ((uint32_t)s[i+3] << 16)
+                         | ((uint32_t)s[i+4] << 8) | s[i+5];
+        switch (((uint32_t)s[i] << 8) | s[i+1]) {
+          case H2_SETTINGS_HEADER_TABLE_SIZE:
+            lshpack_enc_set_max_capacity(&h2c->encoder, v < 4096 ? v : 4096);
+            break;
+          case H2_SETTINGS_MAX_CONCURRENT_STREAMS:
+            h2c->s_max_concurrent_streams = v;
+            break;
+          case H2_SETTINGS_INITIAL_WINDOW_SIZE:
+            if (v > INT32_MAX) { /* FLOW_CONTROL_ERROR */
+                proxy_h2_send_goaway(h2c, H2_E_FLOW_CONTROL_ERROR);
+                return 0;
+            }
+            for (handler_ctx *hctx = h2c->streams; hctx; hctx = hctx->h2next){
+                if ((int64_t)hctx->h2swin + v - h2c->s_initial_window_size
+                    > INT32_MAX) {
+                    proxy_h2_send_goaway(h2c, H2_E_FLOW_CONTROL_ERROR);
+                    return 0;
+                }
+            }
+            for (handler_ctx *hctx = h2c->streams; hctx; hctx = hctx->h2next)
+                hctx->h2swin += (int32_t)v - h2c->s_initial_window_size;
+            h2c->s_initial_window_size = (int32_t)v;
+            break;
+          case H2_SETTINGS_MAX_FRAME_SIZE:
+            if (v < 16384 || v > 16777215) return 0; /* PROTOCOL_ERROR */
+            h2c->s_max_frame_size = v;
+            break;
+          default:
+            break;
+        }
+    }
+    char ack[9];
+    proxy_h2_frame_hdr(ack, 0, H2_FTYPE_SETTINGS, H2_FLAG_ACK, 0);
+    chunkqueue_append_mem_min(&h2c->wq, ack, sizeof(ack));
+    proxy_h2con_send_pending(h2c);
+    return 1;
+}
+
+
+static int proxy_h2_recv_frame (proxy_h2con * const h2c, const uint8_t * const s, const uint32_t flen) {
+    /* process (small) frame other than DATA or HEADERS */
+    const uint32_t id = proxy_h2_u31(s+5);
+    switch (s[3]) { /* frame type */
+      case H2_FTYPE_SETTINGS:
+        if (0 != id) return 0;
+        return proxy_h2_recv_settings(h2c, s, flen);
+      case H2_FTYPE_PING:
+        if (0 != id || 8 != flen) return 0;
+        if (!(s[4] & H2_FLAG_ACK)) {
+            char pong[17];
+            proxy_h2_frame_hdr(pong, 8, H2_FTYPE_PING, H2_FLAG_ACK, 0);
+            memcpy(pong+9, s+9, 8);
+            chunkqueue_append_mem_min(&h2c->wq, pong, sizeof(pong));
+        }
+        return 1;
+      case H2_FTYPE_WINDOW_UPDATE:
+        if (4 != flen) return 0;
+        {
+            /* 0 increment is PROTOCOL_ERROR and window above 2^31-1 is
+             * FLOW_CONTROL_ERROR (RFC 9113 Section 6.9); stream errors for
+             * stream window, connection errors for connection window */
+            const int32_t incr = (int32_t)proxy_h2_u31(s+9);
+            if (0 == id) {
+                if (0 == incr || h2c->swin > INT32_MAX - incr) {
+                    proxy_h2_send_goaway(h2c, 0 == incr
+                                              ? H2_E_PROTOCOL_ERROR
+                                              : H2_E_FLOW_CONTROL_ERROR);
+                    return 0;
+                }
+                h2c->swin += incr;
+                proxy_h2con_send_pending(h2c);
+            }
+            else {
+                handler_ctx * const hctx = proxy_h2_stream_get(h2c, id);
+                if (hctx && (0 == incr || hctx->h2swin > INT32_MAX - incr)) {
+                    proxy_h2_send_u32(h2c, H2_FTYPE_RST_STREAM, id, 0 == incr
+                                      ? H2_E_PROTOCOL_ERROR
+                                      : H2_E_FLOW_CONTROL_ERROR);
+                    proxy_h2_stream_reset(hctx, 0);
+                }
+                else if (hctx) {
+                    hctx->h2swin += incr;
+                    if (!(hctx->h2state & PROXY_H2_SENT_END)) {
+                        proxy_h2_send_data(h2c, hctx);
+                        joblist_append(hctx->gw.con);
+                    }
+                }
+            }
+        }
+        return 1;
+      case H2_FTYPE_RST_STREAM:
+        if (4 != flen || 0 == id) return 0;
+        {
+            handler_ctx * const hctx = proxy_h2_stream_get(h2c, id);
+            if (hctx) {
+                const uint32_t e = proxy_h2_u31(s+9);
+                proxy_h2_stream_reset(hctx, e == H2_E_REFUSED_STREAM
+                                            ? PROXY_H2_RETRY
+                                            : 0);
+            }
+        }
+        return 1;
+      case H2_FTYPE_GOAWAY:
+        if (flen < 8 || 0 != id) return 0;
+        {
+            /* streams above last-stream-id were not processed by peer */
+            const uint32_t last_id = proxy_h2_u31(s+9);
+            h2c->goaway = 1;
+            for (handler_ctx *hctx = h2c->streams, *next; hctx; hctx = next) {
+                next = hctx->h2next;
+                if (hctx->h2id > last_id)
+                    proxy_h2_stream_reset(hctx, PROXY_H2_RETRY);
+            }
+        }
+        return 1;
+      case H2_FTYPE_PUSH_PROMISE: /*(SETTINGS_ENABLE_PUSH 0)*/
+      case H2_FTYPE_CONTINUATION: /*(handled with HEADERS)*/
+        return 0;
+      default: /* ignore PRIORITY and unknown frame types */
+        return 1;
+    }
+}
+
+
+static int proxy_h2_recv_data (proxy_h2con * const h2c, chunkqueue * const cq, const uint8_t * const s, uint32_t flen) {
+    const uint32_t id = proxy_h2_u31(s+5);
+    const uint8_t flags = s[4];
+    uint32_t pad = 0;
+    if (0 == id) return 0;
+    h2c->rwin -= (int32_t)flen;
+    handler_ctx * const hctx = proxy_h2_stream_get(h2c, id);
+    if (hctx) hctx->h2rwin -= (int32_t)flen;
+    if (flags & H2_FLAG_PADDED) {
+        if (0 == flen) return 0;
+        pad = s[9];
+        if (pad >= flen) return 0;
+        flen -= 1 + pad;
+        chunkqueue_mark_written(cq, 10);
+    }
+    else
+        chunkqueue_mark_written(cq, 9);
+
+    if (hctx) {
+        chunkqueue_steal(hctx->gw.rb, cq, (off_t)flen);
+        hctx->gw.read_ts = log_monotonic_secs;
+        if (flags & H2_FLAG_END_STREAM)
+            proxy_h2_recv_end_stream(h2c, hctx);
+        else if (flen)
+            joblist_append(hctx->gw.con);
+    }
+    else
+        chunkqueue_mark_written(cq, (off_t)flen);
+    chunkqueue_mark_written(cq, (off_t)pad);
+
+    if (h2c->rwin <= PROXY_H2_CONN_WINDOW/2) {
+        proxy_h2_send_u32(h2c, H2_FTYPE_WINDOW_UPDATE, 0,
+                          (uint32_t)(PROXY_H2_CONN_WINDOW - h2c->rwin));
+        h2c->rwin = PROXY_H2_CONN_WINDOW;
+    }
+    return 1;
+}
+
+
+static int proxy_h2_recv_continuation (proxy_h2con * const h2c, const uint8_t * const s, const uint32_t flen) {
+    /* collect header block fragments in h2c->hb */
+    if (proxy_h2_u31(s+5) != h2c->hb_id) return 0;
+    if (buffer_clen(h2c->hb) + flen > 65536) return 0;
+    buffer_append_string_len(h2c->hb, (const char *)s+9, flen);
+    if (!(s[4] & H2_FLAG_END_HEADERS)) return 1;
+
+    /* (reuse HEADERS frame header saved at start of h2c->hb) */
+    uint8_t * const h = (uint8_t *)h2c->hb->ptr;
+    const uint32_t len = buffer_clen(h2c->hb) - 9;
+    h[0] = (uint8_t)(len >> 16);
+    h[1] = (uint8_t)(len >> 8);
+    h[2] = (uint8_t)len;
+    h2c->hb_id = 0;
+    return proxy_h2_recv_header_block(h2c, h, len);
+}
+
+
+static int proxy_h2_recv_frames (proxy_h2con * const h2c) {
+    chunkqueue * const cq = &h2c->rq;
+    for (off_t cqlen; (cqlen = chunkqueue_length(cq)) >= 9; ) {
+        chunk *c = cq->first;
+        uint32_t clen = buffer_clen(c->mem) - (uint32_t)c->offset;
+        if (clen < 10) {
+            chunkqueue_compact_mem(cq, cqlen < 10 ? 9 : 10);
+            c = cq->first;
+            clen = buffer_clen(c->mem) - (uint32_t)c->offset;
+        }
+        const uint8_t *s = (uint8_t *)(c->mem->ptr + c->offset);
+        const uint32_t flen = proxy_h2_u24(s);
+        if (flen > PROXY_H2_MAX_FRAME) return 0; /* FRAME_SIZE_ERROR */
+        if (cqlen < 9 + flen) break; /* incomplete frame */
+
+        if (h2c->hb_id && s[3] != H2_FTYPE_CONTINUATION)
+            return 0; /* PROTOCOL_ERROR */
+
+        if (s[3] == H2_FTYPE_DATA) {
+            /*(DATA payload is moved to stream without copying full chunks)*/
+            if (!proxy_h2_recv_data(h2c, cq, s, flen)) return 0;
+            continue;
+        }
+
+        if (clen < 9 + flen) {
+            chunkqueue_compact_mem(cq, 9 + flen);
+            c = cq->first;
+            s = (uint8_t *)(c->mem->ptr + c->offset);
+        }
+
+        int rc;
+        if (s[3] == H2_FTYPE_HEADERS) {
+            if (s[4] & H2_FLAG_END_HEADERS)
+                rc = proxy_h2_recv_header_block(h2c, s, flen);
+            else {
+                h2c->hb_id = proxy_h2_u31(s+5);
+                rc = (0 != h2c->hb_id);
+                if (NULL == h2c->hb) h2c->hb = buffer_init();
+                buffer_copy_string_len(h2c->hb, (const char *)s, 9 + flen);
+            }
+        }
+        else if (s[3] == H2_FTYPE_CONTINUATION && h2c->hb_id)
+            rc = proxy_h2_recv_continuation(h2c, s, flen);
+        else
+            rc = proxy_h2_recv_frame(h2c, s, flen);
+        if (!rc) return 0;
+        chunkqueue_mark_written(cq, 9 + flen);
+    }
+    return 1;
+}
+
+
+static int proxy_h2con_read (proxy_h2con * const h2c) {
+    chunkqueue * const cq = &h2c->rq;
+    ssize_t n;
+    size_t mem_len;
+    int loops = 16;
+    do {
+        mem_len = 0;
+        chunk * const ckpt = cq->last;
+        char * const mem = chunkqueue_get_memory(cq, &mem_len);
+      #ifdef _WIN32
+        n = recv(h2c->fd, mem, mem_len, 0);
+      #else
+        n = read(h2c->fd, mem, mem_len);
+      #endif
+        chunkqueue_use_memory(cq, ckpt, n > 0 ? (size_t)n : 0);
+    } while (n == (ssize_t)mem_len && --loops);
+
+    if (n > 0 || (n == -1 && (errno == EAGAIN || errno == EINTR)))
+        return proxy_h2_recv_frames(h2c) ? 0 : -1;
+    if (0 == n) /*(EOF; process frames received before close)*/
+        proxy_h2_recv_frames(h2c);
+    return -1;
+}
+
+
+__attribute_cold__
+static void proxy_h2con_connect_error (proxy_h2con * const h2c, const int errnum) {
+    handler_ctx * const hctx = h2c->streams;
+    if (hctx) /*(proc connect error accounting)*/
+        gw_proc_connect_status(&hctx->gw, hctx->gw.r, errnum);
+    proxy_h2con_close(h2c);
+}
+
+
+static handler_t proxy_h2con_handle_fdevent (void *ctx, int revents) {
+    proxy_h2con * const h2c = ctx;
+
+    if (!h2c->connected) {
+        int errnum = fdevent_connect_status(h2c->fd);
+        if (0 == errnum && (revents & (FDEVENT_ERR|FDEVENT_HUP))) errnum = EIO;
+        if (0 != errnum) {
+            proxy_h2con_connect_error(h2c, errnum);
+            return HANDLER_FINISHED;
+        }
+        h2c->connected = 1;
+        if (h2c->streams)
+            gw_proc_connect_status(&h2c->streams->gw, h2c->streams->gw.r, 0);
+        fdevent_fdnode_event_set(h2c->srv->ev, h2c->fdn,
+                                 FDEVENT_IN | FDEVENT_RDHUP);
+        revents |= FDEVENT_OUT;
+    }
+
+    if (revents & (FDEVENT_IN | FDEVENT_RDHUP | FDEVENT_HUP | FDEVENT_ERR)) {
+        if (0 != proxy_h2con_read(h2c)) {
+            if (!chunkqueue_is_empty(&h2c->wq)) /*(e.g. GOAWAY)*/
+                proxy_h2con_write(h2c);
+            proxy_h2con_close(h2c);
+            return HANDLER_FINISHED;
+        }
+    }
+
+    if (0 != proxy_h2con_write(h2c) || (h2c->goaway && 0 == h2c->nstreams))
+        proxy_h2con_close(h2c);
+
+    return HANDLER_FINISHED;
+}
+
+
+static proxy_h2con * proxy_h2con_open (gw_handler_ctx * const gwhctx, request_st * const r) {
+    /*(connection preface, SETTINGS, and WINDOW_UPDATE for connection)*/
+    static const uint8_t h2preface[] = { /*(big-endian numbers)*/
+      'P','R','I',' ','*',' ','H','T','T','P','/','2','.','0','\r','\n',
+      '\r','\n','S','M','\r','\n','\r','\n',
+      /* SETTINGS */
+      0x00, 0x00, 0x0c        /* frame length */
+     ,H2_FTYPE_SETTINGS       /* frame type */
+     ,0x00                    /* frame flags */
+     ,0x00, 0x00, 0x00, 0x00  /* stream identifier */
+     ,0x00, H2_SETTINGS_ENABLE_PUSH
+     ,0x00, 0x00, 0x00, 0x00  /* 0 */
+     ,0x00, H2_SETTINGS_INITIAL_WINDOW_SIZE
+     ,0x00, 0x04, 0x00, 0x00  /* PROXY_H2_STREAM_WINDOW (262144) */
+      /* WINDOW_UPDATE */
+     ,0x00, 0x00, 0x04        /* frame length */
+     ,H2_FTYPE_WINDOW_UPDATE  /* frame type */
+     ,0x00                    /* frame flags */
+     ,0x00, 0x00, 0x00, 0x00  /* stream identifier */
+     ,0x00, 0xff, 0x00, 0x01  /* PROXY_H2_CONN_WINDOW - 65535 */
+    };
+
+    gw_host * const host = gwhctx->host;
+    gw_proc * const proc = gwhctx->proc;
+    server * const srv = r->con->srv;
+    const int fd = fdevent_socket_nb_cloexec(host->family, SOCK_STREAM, 0);
+    if (-1 == fd) {
+        log_perror(r->conf.errh, __FILE__, __LINE__,
+          "socket() failed (cur_fds:%d) (max_fds:%d)",
+          srv->cur_fds, srv->max_fds);
+        return NULL;
+    }
+    ++srv->cur_fds;
+
+    proxy_h2con * const h2c = ck_calloc(1, sizeof(proxy_h2con));
+    h2c->host = host;
+    h2c->proc = proc;
+    h2c->srv = srv;
+    h2c->fd = fd;
+    h2c->fdn = fdevent_register(srv->ev, fd, proxy_h2con_handle_fdevent, h2c);
+    h2c->pid = gwhctx->pid = proc->is_local ? proc->pid : 0;
+    h2c->next_id = 1;
+    h2c->s_max_concurrent_streams = 100; /*(until peer SETTINGS received)*/
+    h2c->s_initial_window_size = 65535;
+    h2c->s_max_frame_size = 16384;
+    h2c->swin = 65535;
+    h2c->rwin = PROXY_H2_CONN_WINDOW;
+    h2c->write_ts = h2c->idle_ts = log_monotonic_secs;
+    chunkqueue_init(&h2c->rq);
+    chunkqueue_init(&h2c->wq);
+    lshpack_dec_init(&h2c->decoder);
+    lshpack_enc_init(&h2c->encoder);
+    lshpack_enc_use_hist(&h2c->encoder, 1);
+    buffer_string_prepare_copy(srv->tmp_buf, 65535); /*(HPACK decode)*/
+    chunkqueue_append_mem(&h2c->wq, (const char *)h2preface, sizeof(h2preface));
+    h2c->next = proxy_h2cons;
+    proxy_h2cons = h2c;
+
+    if (AF_UNIX != host->family) {
+        if (-1 == fdevent_set_tcp_nodelay(fd, 1)) {
+            /*(error, but not critical)*/
+        }
+    }
+
+    if (-1 == connect(fd, proc->saddr, proc->saddrlen)) {
+      #ifdef _WIN32
+        const int errnum = WSAGetLastError();
+        if (errnum == WSAEINPROGRESS || errnum == WSAEALREADY
+            || errnum == WSAEWOULDBLOCK || errnum == WSAEINTR)
+      #else
+        const int errnum = errno;
+        if (errnum == EINPROGRESS || errnum == EALREADY || errnum == EINTR
+            || (errnum == EAGAIN && host->unixsocket))
+      #endif
+        {
+            fdevent_fdnode_event_set(srv->ev, h2c->fdn, FDEVENT_OUT);
+            return h2c;
+        }
+        gw_proc_connect_status(gwhctx, r, errnum);
+        proxy_h2con_close(h2c);
+        return NULL;
+    }
+
+    h2c->connected = 1;
+    gw_proc_connect_status(gwhctx, r, 0);
+    fdevent_fdnode_event_set(srv->ev, h2c->fdn, FDEVENT_IN | FDEVENT_RDHUP);
+    return h2c;
+}
+
+
+static proxy_h2con * proxy_h2con_get (gw_handler_ctx * const gwhctx, request_st * const r) {
+    /* reuse connection to proc with capacity for another stream */
+    gw_proc * const proc = gwhctx->proc;
+    for (proxy_h2con *h2c = proxy_h2cons; h2c; h2c = h2c->next) {
+        if (h2c->proc != proc || h2c->goaway) continue;
+        if (proc->is_local && h2c->pid != proc->pid) {
+            h2c->goaway = 1; /*(connection to prior proc pid)*/
+            continue;
+        }
+        if (h2c->nstreams >= h2c->s_max_concurrent_streams) continue;
+        gwhctx->pid = h2c->pid;
+        return h2c;
+    }
+    return proxy_h2con_open(gwhctx, r);
+}
+
+
+static void proxy_h2_stream_free (void *ctx) {
+    /* (called from handler_ctx_free(), e.g. upon client disconnect) */
+    handler_ctx * const hctx = ctx;
+    proxy_h2con * const h2c = hctx->h2c;
+    if (NULL == h2c) return;
+    proxy_h2_send_u32(h2c, H2_FTYPE_RST_STREAM, hctx->h2id, H2_E_CANCEL);
+    proxy_h2_stream_detach(hctx);
+    if (0 != proxy_h2con_write(h2c))
+        proxy_h2con_close(h2c);
+}
+
+
+static handler_t proxy_h2_stream_open (handler_ctx * const hctx, request_st * const r) {
+    gw_handler_ctx * const gwhctx = &hctx->gw;
+    proxy_h2con *h2c;
+    if (!gw_proc_select(gwhctx) || NULL == (h2c = proxy_h2con_get(gwhctx, r))) {
+        /* no proc running or connection failed; try another proc or host */
+        if (gwhctx->reconnects++ < 5)
+            return gw_reconnect(gwhctx, r);
+        if (!r->resp_body_started)
+            r->http_status = 503; /* Service Unavailable */
+        return gw_backend_error(gwhctx, r);
+    }
+
+    hctx->h2c = h2c;
+    hctx->h2id = h2c->next_id;
+    h2c->next_id += 2;
+    if (h2c->next_id > INT32_MAX)
+        h2c->goaway = 1; /*(stream ids exhausted)*/
+    hctx->h2next = h2c->streams;
+    h2c->streams = hctx;
+    ++h2c->nstreams;
+    hctx->h2swin = h2c->s_initial_window_size;
+    hctx->h2rwin = PROXY_H2_STREAM_WINDOW;
+    hctx->h2state = 0;
+    if (NULL == gwhctx->rb) gwhctx->rb = chunkqueue_init(NULL);
+    gwhctx->read_ts = gwhctx->write_ts = log_monotonic_secs;
+
+    if (r->reqbody_length > 0
+        || (0 == r->reqbody_length
+            && !http_method_get_or_head(r->http_method))) {
+        /* set Content-Length if client sent Transfer-Encoding: chunked
+         * and not streaming to backend (request body has been fully received) */
+        const buffer *vb = http_header_request_get(r, HTTP_HEADER_CONTENT_LENGTH, CONST_STR_LEN("Content-Length"));
+        if (NULL == vb) {
+            buffer_append_int(
+              http_header_request_set_ptr(r, HTTP_HEADER_CONTENT_LENGTH,
+                                          CONST_STR_LEN("Content-Length")),
+              r->reqbody_length);
+        }
+    }
+
+    /* "Forwarded" and legacy X- headers */
+    proxy_set_Forwarded(r->con, r, hctx->conf.forwarded);
+
+    const int end_stream = (0 == r->reqbody_length);
+    if (!proxy_h2_send_headers(h2c, hctx, r,
+                               end_stream ? H2_FLAG_END_STREAM : 0)) {
+        r->http_status = 431; /* Request Header Fields Too Large */
+        return gw_backend_error(gwhctx, r); /*(proxy_h2_stream_free())*/
+    }
+    if (end_stream)
+        hctx->h2state |= PROXY_H2_SENT_END;
+
+    ++(*gwhctx->host->stats_requests); /* "proxy.requests" */
+    return HANDLER_GO_ON;
+}
+
+
+static void proxy_h2_send_body (handler_ctx * const hctx, request_st * const r) {
+    chunkqueue * const wb = &hctx->gw.wb;
+    if (!chunkqueue_is_empty(&r->reqbody_queue)
+        && chunkqueue_length(wb) < 65536)
+        chunkqueue_append_chunkqueue(wb, &r->reqbody_queue);
+    proxy_h2_send_data(hctx->h2c, hctx);
+    if (!(hctx->h2state & PROXY_H2_SENT_END)
+        && chunkqueue_length(wb) < 65536 - 16384
+        && !(r->conf.stream_request_body & FDEVENT_STREAM_REQUEST_POLLIN)) {
+        r->conf.stream_request_body |= FDEVENT_STREAM_REQUEST_POLLIN;
+        if (r->http_version <= HTTP_VERSION_1_1)
+            r->con->is_readable = 1; /*trigger optimistic client read*/
+    }
+}
+
+
+__attribute_cold__
+static handler_t proxy_h2_stream_error (handler_ctx * const hctx, request_st * const r) {
+    gw_handler_ctx * const gwhctx = &hctx->gw;
+    if ((hctx->h2state & PROXY_H2_RETRY)
+        && 0 == gwhctx->wb.bytes_in && !r->resp_body_started
+        && gwhctx->reconnects++ < 5) {
+        /* request (without request body sent) was not processed by backend;
+         * resend request on another stream */
+        if (hctx->conf.gw.debug)
+            gw_backend_error_trace(gwhctx, r,
+              "reconnecting; stream refused or connection closed by backend");
+        hctx->h2id = 0;
+        hctx->h2state = 0;
+        chunkqueue_reset(gwhctx->rb);
+        buffer_clear(gwhctx->response);
+        return gw_reconnect(gwhctx, r);
+    }
+
+    if (!r->resp_body_started) {
+        r->http_status = (hctx->h2state & PROXY_H2_TIMEOUT)
+          ? 504  /* Gateway Timeout */
+          : 502; /* Bad Gateway */
+    }
+    gw_backend_error_trace(gwhctx, r, (hctx->h2state & PROXY_H2_TIMEOUT)
+                                      ? "read timeout"
+                                      : "stream reset or connection closed");
+    return gw_backend_error(gwhctx, r); /* HANDLER_FINISHED */
+}
+
+
+static handler_t proxy_h2_recv_response (handler_ctx * const hctx, request_st * const r) {
+    if ((hctx->h2state & PROXY_H2_RECV_HDRS) && !r->resp_body_started) {
+        handler_t rc =
+          http_response_parse_headers(r, &hctx->gw.opts, hctx->gw.response);
+        if (rc != HANDLER_GO_ON) {
+            if (rc == HANDLER_FINISHED) {
+                gw_connection_close(&hctx->gw, r);
+                return HANDLER_FINISHED;
+            }
+            return gw_backend_error(&hctx->gw, r);
+        }
+    }
+
+    chunkqueue * const rb = hctx->gw.rb;
+    if (r->resp_body_started && !chunkqueue_is_empty(rb)) {
+        if (0 != http_response_transfer_cqlen(r, rb,
+                                              (size_t)chunkqueue_length(rb)))
+            return gw_backend_error(&hctx->gw, r);
+        hctx->gw.proc->last_used = log_monotonic_secs;
+    }
+
+    if (hctx->h2state & PROXY_H2_RESET)
+        return proxy_h2_stream_error(hctx, r);
+
+    if (hctx->h2state & PROXY_H2_RECV_END) {
+        if (!r->resp_body_started) {
+            /* END_STREAM without (final) response headers */
+            hctx->h2state |= PROXY_H2_RESET;
+            return proxy_h2_stream_error(hctx, r);
+        }
+        gw_connection_close(&hctx->gw, r);
+        return HANDLER_FINISHED;
+    }
+
+    /* replenish stream recv window as response is consumed
+     * (hold back if FDEVENT_STREAM_RESPONSE_BUFMIN and client is slow) */
+    proxy_h2con * const h2c = hctx->h2c;
+    if (h2c && hctx->h2rwin <= PROXY_H2_STREAM_WINDOW/2
+        && (!(r->conf.stream_response_body & FDEVENT_STREAM_RESPONSE_BUFMIN)
+            || chunkqueue_length(&r->write_queue) <= 65536 - 4096)) {
+        proxy_h2_send_u32(h2c, H2_FTYPE_WINDOW_UPDATE, hctx->h2id,
+                          (uint32_t)(PROXY_H2_STREAM_WINDOW - hctx->h2rwin));
+        hctx->h2rwin = PROXY_H2_STREAM_WINDOW;
+        if (0 != proxy_h2con_write(h2c))
+            proxy_h2con_close(h2c); /*(next event handles stream reset)*/
+    }
+
+    return HANDLER_WAIT_FOR_EVENT;
+}
+
+
+static handler_t proxy_h2_handle_subrequest (handler_ctx * const hctx, request_st * const r) {
+    if (0 == hctx->h2id) {
+        /* wait for request body unless streaming request body to backend */
+        if (r->state == CON_STATE_READ_POST) {
+            handler_t rc = r->con->reqbody_read(r);
+            if (rc != HANDLER_GO_ON) return rc;
+        }
+        handler_t rc = proxy_h2_stream_open(hctx, r);
+        if (rc != HANDLER_GO_ON) return rc;
+    }
+
+    proxy_h2con * const h2c = hctx->h2c;
+    if (h2c && !(hctx->h2state & PROXY_H2_SENT_END)) {
+        if (r->state == CON_STATE_READ_POST) {
+            if (chunkqueue_length(&hctx->gw.wb) > 65536 - 4096
+                && (r->conf.stream_request_body
+                    & FDEVENT_STREAM_REQUEST_BUFMIN))
+                r->conf.stream_request_body &= ~FDEVENT_STREAM_REQUEST_POLLIN;
+            else {
+                handler_t rc = r->con->reqbody_read(r);
+                if (rc != HANDLER_GO_ON && rc != HANDLER_WAIT_FOR_EVENT)
+                    return rc;
+            }
+        }
+        proxy_h2_send_body(hctx, r);
+    }
+    if (h2c && 0 != proxy_h2con_write(h2c))
+        proxy_h2con_close(h2c);
+
+    return proxy_h2_recv_response(hctx, r);
+}
+
+
+static void proxy_h2_handle_trigger (void) {
+    const unix_time64_t mono = log_monotonic_secs;
+    for (proxy_h2con *h2c = proxy_h2cons, *next; h2c; h2c = next) {
+        next = h2c->next;
+        const gw_host * const host = h2c->host;
+        if (!h2c->connected) {
+            if (host->connect_timeout
+                && mono - h2c->write_ts > (unix_time64_t)host->connect_timeout)
+                proxy_h2con_connect_error(h2c, ETIMEDOUT);
+            continue;
+        }
+        if (0 == h2c->nstreams) {
+            /* close idle connection */
+            if (h2c->goaway || h2c->proc->state != PROC_STATE_RUNNING
+                || mono - h2c->idle_ts > (unix_time64_t)host->idle_timeout) {
+                if (!h2c->goaway) proxy_h2_send_goaway(h2c, H2_E_NO_ERROR);
+                proxy_h2con_write(h2c);
+                proxy_h2con_close(h2c);
+            }
+            continue;
+        }
+        if (host->write_timeout && !chunkqueue_is_empty(&h2c->wq)
+            && mono - h2c->write_ts > (unix_time64_t)host->write_timeout) {
+            log_error(h2c->srv->errh, __FILE__, __LINE__,
+              "write timeout on socket: %s (fd: %d)",
+              h2c->proc->connection_name->ptr, h2c->fd);
+            proxy_h2con_close(h2c);
+            continue;
+        }
+        if (host->read_timeout) {
+            const unix_time64_t ts = mono - (unix_time64_t)host->read_timeout;
+            for (handler_ctx *hctx = h2c->streams, *hnext; hctx; hctx = hnext) {
+                hnext = hctx->h2next;
+                if (hctx->gw.read_ts >= ts) continue;
+                proxy_h2_send_u32(h2c, H2_FTYPE_RST_STREAM, hctx->h2id,
+                                  H2_E_CANCEL);
+                proxy_h2_stream_reset(hctx, PROXY_H2_TIMEOUT);
+            }
+            if (0 != proxy_h2con_write(h2c))
+                proxy_h2con_close(h2c);
+        }
+    }
+}
+
+
+static handler_t mod_proxy_handle_subrequest (request_st * const r, void *p_d) {
+    plugin_data * const p = p_d;
+    handler_ctx * const hctx = r->plugin_ctx[p->id];
+    if (NULL == hctx || !hctx->h2)
+        return gw_handle_subrequest(r, p_d);
+    return proxy_h2_handle_subrequest(hctx, r);
+}
+
+
+static handler_t mod_proxy_handle_trigger (server * const srv, void *p_d) {
+    handler_t rc = gw_handle_trigger(srv, p_d);
+    if (proxy_h2cons) proxy_h2_handle_trigger();
+    return rc;
+}
+
+
 static handler_t mod_proxy_check_extension(request_st * const r, void *p_d) {
 	plugin_data *p = p_d;
 	handler_t rc;
@@ -1137,6 +2353,11 @@ static handler_t mod_proxy_check_extension(request_st * const r, void *p_d) {
 				return HANDLER_FINISHED;
 			}
 		}
+		else if (hctx->conf.header.h2c
+		         && !light_btst(r->rqst_htags, HTTP_HEADER_UPGRADE)) {
+			hctx->h2 = 1; /* HTTP/2 upstream (h2c) */
+			hctx->gw.handler_ctx_free = proxy_h2_stream_free;
+		}
 	}
 
 	return HANDLER_GO_ON;
@@ -1155,8 +2376,8 @@ int mod_proxy_plugin_init(plugin *p) {
 	p->set_defaults = mod_proxy_set_defaults;
 	p->handle_request_reset    = gw_handle_request_reset;
 	p->handle_uri_clean        = mod_proxy_check_extension;
-	p->handle_subrequest       = gw_handle_subrequest;
-	p->handle_trigger          = gw_handle_trigger;
+	p->handle_subrequest       = mod_proxy_handle_subrequest;
+	p->handle_trigger          = mod_proxy_handle_trigger;
 	p->handle_waitpid          = gw_handle_waitpid_cb;
 
 	return 0;
@@ -0,0 +1,527 @@
+/*
+ * mod_ratelimit - token bucket request rate limiting
+ *
+ * Copyright(c) 2026 lighttpd contributors  All rights reserved
+ * License: BSD 3-clause (same as lighttpd)
+ */
+#include "first.h"
+
+#include <sys/types.h>
+#include "sys-mmap.h"
+#include "sys-socket.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>      /* CLOCK_MONOTONIC */
+
+#include "base.h"
+#include "buffer.h"
+#include "http_header.h"
+#include "log.h"
+#include "plugin.h"
+#include "request.h"
+#include "sock_addr.h"
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/* bucket table shared between workers requires fork(), anonymous shared mmap,
+ * and compiler atomic builtins (buckets are updated by multiple processes) */
+#if defined(HAVE_FORK) && defined(HAVE_MMAP) && defined(MAP_ANONYMOUS) \
+ && (defined(__GNUC__) || defined(__clang__))
+#define RATELIMIT_SHM
+#endif
+
+/**
+ * limit request rate using token buckets keyed by client address (as set
+ * by mod_extforward, if used), by virtual host, by url-path prefix, or by
+ * authenticated user.  Buckets are kept in a fixed-size table in shared
+ * memory so that limits hold across server.max-worker processes.
+ *
+ * Requests are checked in handle_uri_clean, before any request handler
+ * runs, and requests exceeding the limit receive 429 Too Many Requests
+ * with a Retry-After response header.  mod_ratelimit should be listed in
+ * server.modules after mod_extforward (and after mod_auth if keyed by
+ * "user") and before modules handling requests (e.g. mod_proxy).
+ *
+ * ratelimit.limit = ( "rate"   => 10,          # tokens added each period
+ *                     "period" => 1,           # secs (default: 1)
+ *                     "burst"  => 20,          # bucket size (default: rate)
+ *                     "key"    => "remote-ip" )# (default: "remote-ip")
+ * ratelimit.max-entries = 65536                # table size (global)
+ *
+ * "key" is one of "remote-ip", "host", "url-prefix" (first url-path
+ * segment, e.g. "/api/"), or "user" (REMOTE_USER; requests without an
+ * authenticated user are not limited).  Each ratelimit.limit directive
+ * (e.g. in separate config conditions) has its own set of buckets.
+ *
+ * When the table is full, the least recently used bucket in the probe
+ * sequence is replaced, so limits are approximate under heavy churn.
+ */
+
+typedef struct {
+    uint64_t key;       /* hash of limit id and key (0 if unused) */
+    uint64_t ts;        /* (msecs, monotonic) time of last update */
+    int64_t tokens;     /* (milli-tokens) */
+    uint32_t lock;
+} ratelimit_bucket;
+
+enum {
+  RATELIMIT_KEY_REMOTE_IP,
+  RATELIMIT_KEY_HOST,
+  RATELIMIT_KEY_URL_PREFIX,
+  RATELIMIT_KEY_USER
+};
+
+typedef struct {
+    uint32_t id;
+    uint32_t rate;
+    uint32_t period;
+    uint32_t burst;
+    int keytype;
+} ratelimit_limit;
+
+typedef struct {
+    const ratelimit_limit *limit;
+} plugin_config;
+
+typedef struct {
+    PLUGIN_DATA;
+    plugin_config defaults;
+    plugin_config conf;
+
+    ratelimit_bucket *buckets;
+    uint32_t mask;
+    int shm;
+} plugin_data;
+
+#define RATELIMIT_PROBES 4
+
+INIT_FUNC(mod_ratelimit_init) {
+    return ck_calloc(1, sizeof(plugin_data));
+}
+
+FREE_FUNC(mod_ratelimit_free) {
+    plugin_data * const p = p_d;
+    if (p->buckets) {
+      #ifdef RATELIMIT_SHM
+        if (p->shm)
+            munmap((void *)p->buckets, (p->mask+1) * sizeof(ratelimit_bucket));
+        else
+      #endif
+            free(p->buckets);
+    }
+    if (NULL == p->cvlist) return;
+    /* (init i to 0 if global context; to 1 to skip empty global context) */
+    for (int i = !p->cvlist[0].v.u2[1], used = p->nconfig; i < used; ++i) {
+        config_plugin_value_t *cpv = p->cvlist + p->cvlist[i].v.u2[0];
+        for (; -1 != cpv->k_id; ++cpv) {
+            if (cpv->vtype != T_CONFIG_LOCAL || NULL == cpv->v.v) continue;
+            switch (cpv->k_id) {
+              case 0: /* ratelimit.limit */
+                free(cpv->v.v);
+                break;
+              default:
+                break;
+            }
+        }
+    }
+}
+
+static void mod_ratelimit_merge_config_cpv(plugin_config * const pconf, const config_plugin_value_t * const cpv) {
+    switch (cpv->k_id) { /* index into static config_plugin_keys_t cpk[] */
+      case 0: /* ratelimit.limit */
+        if (cpv->vtype == T_CONFIG_LOCAL)
+            pconf->limit = cpv->v.v;
+        break;
+      case 1: /* ratelimit.max-entries */
+        break;
+      default:/* should not happen */
+        return;
+    }
+}
+
+static void mod_ratelimit_merge_config(plugin_config * const pconf, const config_plugin_value_t *cpv) {
+    do {
+        mod_ratelimit_merge_config_cpv(pconf, cpv);
+    } while ((++cpv)->k_id != -1);
+}
+
+static void mod_ratelimit_patch_config(request_st * const r, plugin_data * const p) {
+    p->conf = p->defaults; /* copy small struct instead of memcpy() */
+    /*memcpy(&p->conf, &p->defaults, sizeof(plugin_config));*/
+    for (int i = 1, used = p->nconfig; i < used; ++i) {
+        if (config_check_cond(r, (uint32_t)p->cvlist[i].k_id))
+            mod_ratelimit_merge_config(&p->conf, p->cvlist + p->cvlist[i].v.u2[0]);
+    }
+}
+
+static ratelimit_limit * mod_ratelimit_parse_limit(const array * const a, const uint32_t id, log_error_st * const errh) {
+    ratelimit_limit * const limit = ck_calloc(1, sizeof(ratelimit_limit));
+    limit->id = id;
+    limit->period = 1;
+    limit->keytype = RATELIMIT_KEY_REMOTE_IP;
+
+    for (uint32_t i = 0; i < a->used; ++i) {
+        const data_unset * const du = a->data[i];
+        if (buffer_eq_slen(&du->key, CONST_STR_LEN("rate"))) {
+            const int32_t v = config_plugin_value_to_int32(du, -1);
+            if (v > 0)
+                limit->rate = (uint32_t)v;
+            else {
+                log_error(errh, __FILE__, __LINE__,
+                  "invalid value for ratelimit.limit \"rate\"");
+                free(limit);
+                return NULL;
+            }
+        }
+        else if (buffer_eq_slen(&du->key, CONST_STR_LEN("period"))) {
+            const int32_t v = config_plugin_value_to_int32(du, -1);
+            if (v > 0)
+                limit->period = (uint32_t)v;
+            else {
+                log_error(errh, __FILE__, __LINE__,
+                  "invalid value for ratelimit.limit \"period\"");
+                free(limit);
+                return NULL;
+            }
+        }
+        else if (buffer_eq_slen(&du->key, CONST_STR_LEN("burst"))) {
+            const int32_t v = config_plugin_value_to_int32(du, -1);
+            if (v > 0)
+                limit->burst = (uint32_t)v;
+            else {
+                log_error(errh, __FILE__, __LINE__,
+                  "invalid value for ratelimit.limit \"burst\"");
+                free(limit);
+                return NULL;
+            }
+        }
+        else if (buffer_eq_slen(&du->key, CONST_STR_LEN("key"))) {
+            const buffer * const vb = du->type == TYPE_STRING
+              ? &((const data_string *)du)->value
+              : NULL;
+            if (vb && buffer_eq_slen(vb, CONST_STR_LEN("remote-ip")))
+                limit->keytype = RATELIMIT_KEY_REMOTE_IP;
+            else if (vb && buffer_eq_slen(vb, CONST_STR_LEN("host")))
+                limit->keytype = RATELIMIT_KEY_HOST;
+            else if (vb && buffer_eq_slen(vb, CONST_STR_LEN("url-prefix")))
+                limit->keytype = RATELIMIT_KEY_URL_PREFIX;
+            else if (vb && buffer_eq_slen(vb, CONST_STR_LEN("user")))
+                limit->keytype = RATELIMIT_KEY_USER;
+            else {
+                log_error(errh, __FILE__, __LINE__,
+                  "invalid value for ratelimit.limit \"key\"; "
+                  "expecting \"remote-ip\", \"host\", \"url-prefix\", "
+                  "or \"user\"");
+                free(limit);
+                return NULL;
+            }
+        }
+        else {
+            log_error(errh, __FILE__, __LINE__,
+              "unrecognized key for ratelimit.limit: %s", du->key.ptr);
+            free(limit);
+            return NULL;
+        }
+    }
+
+    if (0 == limit->rate) {
+        log_error(errh, __FILE__, __LINE__,
+          "ratelimit.limit requires \"rate\" > 0");
+        free(limit);
+        return NULL;
+    }
+    if (0 == limit->burst)
+        limit->burst = limit->rate;
+    return limit;
+}
+
+__attribute_cold__
+static int mod_ratelimit_table_init(plugin_data * const p, uint32_t entries, log_error_st * const errh) {
+    /* round up to power of 2 (for mask) */
+    uint32_t sz = RATELIMIT_PROBES;
+    while (sz < entries && sz < (1u << 30)) sz <<= 1;
+    p->mask = sz - 1;
+  #ifdef RATELIMIT_SHM
+    /* (anonymous mmap is zero-initialized) */
+    void * const addr = mmap(NULL, sz * sizeof(ratelimit_bucket),
+                             PROT_READ|PROT_WRITE,
+                             MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED != addr) {
+        p->buckets = addr;
+        p->shm = 1;
+        return 1;
+    }
+    log_perror(errh, __FILE__, __LINE__, "mmap() ratelimit shared table");
+    return 0;
+  #else
+    /*(each worker, if server.max-worker, enforces limits separately)*/
+    p->buckets = ck_calloc(sz, sizeof(ratelimit_bucket));
+    UNUSED(errh);
+    return 1;
+  #endif
+}
+
+SETDEFAULTS_FUNC(mod_ratelimit_set_defaults) {
+    static const config_plugin_keys_t cpk[] = {
+      { CONST_STR_LEN("ratelimit.limit"),
+        T_CONFIG_ARRAY_KVANY,
+        T_CONFIG_SCOPE_CONNECTION }
+     ,{ CONST_STR_LEN("ratelimit.max-entries"),
+        T_CONFIG_INT,
+        T_CONFIG_SCOPE_SERVER }
+     ,{ NULL, 0,
+        T_CONFIG_UNSET,
+        T_CONFIG_SCOPE_UNSET }
+    };
+
+    plugin_data * const p = p_d;
+    if (!config_plugin_values_init(srv, p, cpk, "mod_ratelimit"))
+        return HANDLER_ERROR;
+
+    uint32_t nlimits = 0;
+    uint32_t max_entries = 65536;
+
+    /* process and validate config directives
+     * (init i to 0 if global context; to 1 to skip empty global context) */
+    for (int i = !p->cvlist[0].v.u2[1]; i < p->nconfig; ++i) {
+        config_plugin_value_t *cpv = p->cvlist + p->cvlist[i].v.u2[0];
+        for (; -1 != cpv->k_id; ++cpv) {
+            switch (cpv->k_id) {
+              case 0: /* ratelimit.limit */
+                if (cpv->v.a->used) {
+                    cpv->v.v =
+                      mod_ratelimit_parse_limit(cpv->v.a,++nlimits,srv->errh);
+                    if (NULL == cpv->v.v) return HANDLER_ERROR;
+                }
+                else
+                    cpv->v.v = NULL; /*(disable in this context)*/
+                cpv->vtype = T_CONFIG_LOCAL;
+                break;
+              case 1: /* ratelimit.max-entries */
+                if (cpv->v.u)
+                    max_entries = cpv->v.u;
+                break;
+              default:/* should not happen */
+                break;
+            }
+        }
+    }
+
+    /* initialize p->defaults from global config context */
+    if (p->nconfig > 0 && p->cvlist->v.u2[1]) {
+        const config_plugin_value_t *cpv = p->cvlist + p->cvlist->v.u2[0];
+        if (-1 != cpv->k_id)
+            mod_ratelimit_merge_config(&p->defaults, cpv);
+    }
+
+    /* (allocate before workers are forked so that table is shared) */
+    if (nlimits && !mod_ratelimit_table_init(p, max_entries, srv->errh))
+        return HANDLER_ERROR;
+
+    return HANDLER_GO_ON;
+}
+
+
+static uint64_t mod_ratelimit_hash (uint64_t h, const void * const s, const size_t len) {
+    /* FNV-1a 64-bit */
+    const unsigned char * const c = s;
+    for (size_t i = 0; i < len; ++i)
+        h = (h ^ c[i]) * 0x100000001b3uLL;
+    return h;
+}
+
+static int mod_ratelimit_key (request_st * const r, const ratelimit_limit * const limit, uint64_t * const key) {
+    uint64_t h = mod_ratelimit_hash(0xcbf29ce484222325uLL,
+                                    &limit->id, sizeof(limit->id));
+    switch (limit->keytype) {
+      case RATELIMIT_KEY_REMOTE_IP:
+      {
+        const sock_addr * const addr = r->dst_addr;
+        switch (sock_addr_get_family(addr)) {
+          case AF_INET:
+            h = mod_ratelimit_hash(h, &addr->ipv4.sin_addr,
+                                   sizeof(addr->ipv4.sin_addr));
+            break;
+         #ifdef HAVE_IPV6
+          case AF_INET6:
+            h = mod_ratelimit_hash(h, &addr->ipv6.sin6_addr,
+                                   sizeof(addr->ipv6.sin6_addr));
+            break;
+         #endif
+          default:
+            h = mod_ratelimit_hash(h, BUF_PTR_LEN(r->dst_addr_buf));
+            break;
+        }
+        break;
+      }
+      case RATELIMIT_KEY_HOST:
+        h = mod_ratelimit_hash(h, BUF_PTR_LEN(&r->uri.authority));
+        break;
+      case RATELIMIT_KEY_URL_PREFIX:
+      {
+        const buffer * const path = &r->uri.path;
+        const char * const s = path->ptr;
+        const uint32_t len = buffer_clen(path);
+        const char * const e = len > 1 ? memchr(s+1, '/', len-1) : NULL;
+        h = mod_ratelimit_hash(h, s, e ? (size_t)(e - s + 1) : len);
+        break;
+      }
+      case RATELIMIT_KEY_USER:
+      {
+        const buffer * const vb =
+          http_header_env_get(r, CONST_STR_LEN("REMOTE_USER"));
+        if (NULL == vb || buffer_is_blank(vb)) return 0;
+        h = mod_ratelimit_hash(h, BUF_PTR_LEN(vb));
+        break;
+      }
+      default:
+        return 0;
+    }
+    *key = h ? h : 1; /*(0 marks unused bucket)*/
+    return 1;
+}
+
+static uint64_t mod_ratelimit_clock_ms (void) {
+    unix_timespec64_t ts;
+    if (0 != log_clock_gettime(CLOCK_MONOTONIC, &ts))
+        return (uint64_t)log_monotonic_secs * 1000;
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+static int mod_ratelimit_bucket_lock (ratelimit_bucket * const b) {
+  #ifdef RATELIMIT_SHM
+    /* critical section is a few instructions; spin briefly, and fail open
+     * (do not limit) rather than stall if a worker died holding the lock */
+    for (int i = 0; i < 1024; ++i) {
+        if (!__atomic_exchange_n(&b->lock, 1, __ATOMIC_ACQUIRE))
+            return 1;
+    }
+    return 0;
+  #else
+    UNUSED(b);
+    return 1;
+  #endif
+}
+
+static void mod_ratelimit_bucket_unlock (ratelimit_bucket * const b) {
+  #ifdef RATELIMIT_SHM
+    __atomic_store_n(&b->lock, 0, __ATOMIC_RELEASE);
+  #else
+    UNUSED(b);
+  #endif
+}
+
+/* take token from bucket; return 0 if allowed, else secs until token avail */
+static uint32_t mod_ratelimit_bucket_take (ratelimit_bucket * const b, const ratelimit_limit * const limit, const uint64_t now) {
+    /* refill (rate * 1000) milli-tokens every (period * 1000) msecs */
+    const int64_t max = (int64_t)limit->burst * 1000;
+    if (now > b->ts) {
+        const uint64_t add =
+          (now - b->ts) * limit->rate / limit->period;
+        b->tokens = (add >= (uint64_t)max) ? max : b->tokens + (int64_t)add;
+        if (b->tokens > max) b->tokens = max;
+        b->ts = now;
+    }
+    if (b->tokens >= 1000) {
+        b->tokens -= 1000;
+        return 0;
+    }
+    /* msecs until next token, rounded up to secs */
+    const uint64_t ms = ((uint64_t)(1000 - b->tokens) * limit->period
+                         + limit->rate - 1) / limit->rate;
+    return (uint32_t)((ms + 999) / 1000);
+}
+
+static uint32_t mod_ratelimit_check (plugin_data * const p, const ratelimit_limit * const limit, const uint64_t key) {
+    const uint64_t now = mod_ratelimit_clock_ms();
+    ratelimit_bucket *victim = NULL;
+    uint64_t victim_ts = UINT64_MAX;
+    for (uint32_t i = 0; i < RATELIMIT_PROBES; ++i) {
+        ratelimit_bucket * const b =
+          p->buckets + (((uint32_t)key + i) & p->mask);
+        if (!mod_ratelimit_bucket_lock(b))
+            continue;
+        if (b->key == key) {
+            const uint32_t retry = mod_ratelimit_bucket_take(b, limit, now);
+            mod_ratelimit_bucket_unlock(b);
+            return retry;
+        }
+        const uint64_t ts = b->key ? b->ts : 0;
+        mod_ratelimit_bucket_unlock(b);
+        if (ts < victim_ts) {
+            victim_ts = ts;
+            victim = b;
+        }
+    }
+    if (NULL == victim || !mod_ratelimit_bucket_lock(victim))
+        return 0;
+    /* (another process might have modified the bucket since unlocked above;
+     *  replacing it is harmless since limits are approximate when full) */
+    victim->key = key;
+    victim->ts = now;
+    victim->tokens = (int64_t)limit->burst * 1000;
+    const uint32_t retry = mod_ratelimit_bucket_take(victim, limit, now);
+    mod_ratelimit_bucket_unlock(victim);
+    return retry;
+}
+
+__attribute_cold__
+static handler_t mod_ratelimit_reject (request_st * const r, const uint32_t retry) {
+    if (r->conf.log_request_handling)
+        log_debug(r->conf.errh, __FILE__, __LINE__,
+          "request rate limited %s", r->uri.path.ptr);
+
+    char buf[LI_ITOSTRING_LENGTH];
+    http_header_response_set(r, HTTP_HEADER_OTHER,
+                             CONST_STR_LEN("Retry-After"),
+                             buf, li_utostrn(buf, sizeof(buf), retry));
+    r->http_status = 429;
+    r->handler_module = NULL;
+    return HANDLER_FINISHED;
+}
+
+URIHANDLER_FUNC(mod_ratelimit_uri_handler) {
+    plugin_data * const p = p_d;
+    if (NULL == p->buckets) return HANDLER_GO_ON;
+    /* check once per request (not again if request is rewritten) */
+    if (NULL != r->plugin_ctx[p->id]) return HANDLER_GO_ON;
+    r->plugin_ctx[p->id] = p; /*(flag; not allocated)*/
+    mod_ratelimit_patch_config(r, p);
+    const ratelimit_limit * const limit = p->conf.limit;
+    if (NULL == limit) return HANDLER_GO_ON;
+
+    uint64_t key;
+    if (!mod_ratelimit_key(r, limit, &key))
+        return HANDLER_GO_ON;
+
+    const uint32_t retry = mod_ratelimit_check(p, limit, key);
+    return 0 == retry
+      ? HANDLER_GO_ON
+      : mod_ratelimit_reject(r, retry);
+}
+
+REQUEST_FUNC(mod_ratelimit_handle_request_reset) {
+    plugin_data * const p = p_d;
+    r->plugin_ctx[p->id] = NULL;
+    return HANDLER_GO_ON;
+}
+
+
+__attribute_cold__
+__declspec_dllexport__
+int mod_ratelimit_plugin_init(plugin *p);
+int mod_ratelimit_plugin_init(plugin *p) {
+    p->version          = LIGHTTPD_VERSION_ID;
+    p->name             = "ratelimit";
+
+    p->init             = mod_ratelimit_init;
+    p->cleanup          = mod_ratelimit_free;
+    p->set_defaults     = mod_ratelimit_set_defaults;
+    p->handle_uri_clean = mod_ratelimit_uri_handler;
+    p->handle_request_reset = mod_ratelimit_handle_request_reset;
+
+    return 0;
+}
@@ -243,7 +243,7 @@ static handler_t scgi_create_env(handler_ctx *hctx) {
 			hctx->wb_reqlen = -hctx->wb_reqlen;
 	}
 
-	plugin_stats_inc("scgi.requests");
+	++(*hctx->host->stats_requests); /* "scgi.requests" */
 	return HANDLER_GO_ON;
 }
 
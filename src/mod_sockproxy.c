@@ -134,7 +134,7 @@ static handler_t sockproxy_create_env_connect(handler_ctx *hctx) {
 	gw_set_transparent(hctx);
 	http_response_upgrade_read_body_unknown(r);
 
-	plugin_stats_inc("sockproxy.requests");
+	++(*hctx->host->stats_requests); /* "sockproxy.requests" */
 	return HANDLER_GO_ON;
 }
 
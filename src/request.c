@@ -13,6 +13,7 @@
 #include "http_kv.h"
 #include "log.h"
 #include "sock_addr.h"
+#include "sys-simd.h"
 
 #include <limits.h>
 #include <stdint.h>
@@ -61,7 +62,19 @@ __attribute_noinline__
 __attribute_nonnull__()
 __attribute_pure__
 static const char * http_request_check_uri_strict (const uint8_t * const restrict s, const uint_fast32_t len) {
-    for (uint_fast32_t i = 0; i < len; ++i) {
+    uint_fast32_t i = 0;
+  #ifdef LI_SIMD
+    for (; i + LI_SIMD <= len; i += LI_SIMD) {
+        const li_simd_t v = li_simd_load(s+i);
+        const li_simd_mask_t m =
+          li_simd_movemask(li_simd_vor(li_simd_vor(li_simd_vlt(v, 33),
+                                                   li_simd_veq(v, 127)),
+                                       li_simd_veq(v, 255)));
+        if (__builtin_expect( (m != 0), 0))
+            return (const char *)s+i+li_simd_mask_first(m);
+    }
+  #endif
+    for (; i < len; ++i) {
         if (__builtin_expect( (s[i] <= 32),  0)) return (const char *)s+i;
         if (__builtin_expect( (s[i] == 127), 0)) return (const char *)s+i;
         if (__builtin_expect( (s[i] == 255), 0)) return (const char *)s+i;
@@ -72,7 +85,17 @@ static const char * http_request_check_uri_strict (const uint8_t * const restric
 __attribute_nonnull__()
 __attribute_pure__
 static const char * http_request_check_line_strict (const char * const restrict s, const uint_fast32_t len) {
-    for (uint_fast32_t i = 0; i < len; ++i) {
+    uint_fast32_t i = 0;
+  #ifdef LI_SIMD
+    for (; i + LI_SIMD <= len; i += LI_SIMD) {
+        const li_simd_t v = li_simd_load(s+i);
+        const li_simd_mask_t m =
+          (li_simd_lt(v, 32) & ~li_simd_eq(v, '\t')) | li_simd_eq(v, 127);
+        if (__builtin_expect( (m != 0), 0))
+            return s+i+li_simd_mask_first(m);
+    }
+  #endif
+    for (; i < len; ++i) {
         if (__builtin_expect( (((const uint8_t *)s)[i]<32), 0) && s[i] != '\t')
             return s+i;
         if (__builtin_expect( (s[i] == 127), 0))
@@ -81,6 +104,40 @@ static const char * http_request_check_line_strict (const char * const restrict
     return NULL;
 }
 
+/* check block of header lines (strict) in a single pass for CTLs other than
+ * HTAB, CR, LF, and for DEL, and that there are as many CR as LF (each LF is
+ * separately checked for preceding CR).  If clean, the field values need not
+ * be checked individually with http_request_check_line_strict(); otherwise,
+ * the individual checks locate the error. */
+__attribute_nonnull__()
+__attribute_pure__
+static int http_request_check_block_strict (const char * const restrict s, const uint_fast32_t len) {
+    uint_fast32_t i = 0, ncr = 0, nlf = 0;
+  #ifdef LI_SIMD
+    for (; i + LI_SIMD <= len; i += LI_SIMD) {
+        const li_simd_t v = li_simd_load(s+i);
+        const li_simd_mask_t cr = li_simd_eq(v, '\r');
+        const li_simd_mask_t lf = li_simd_eq(v, '\n');
+        if ((li_simd_lt(v, 32) & ~(li_simd_eq(v, '\t') | cr | lf))
+            | li_simd_eq(v, 127))
+            return 0;
+        ncr += li_simd_mask_count(cr);
+        nlf += li_simd_mask_count(lf);
+    }
+  #endif
+    for (; i < len; ++i) {
+        const uint8_t c = ((const uint8_t *)s)[i];
+        if (__builtin_expect( (c < 32), 0)) {
+            if (c == '\r')      ++ncr;
+            else if (c == '\n') ++nlf;
+            else if (c != '\t') return 0;
+        }
+        else if (__builtin_expect( (c == 127), 0))
+            return 0;
+    }
+    return (ncr == nlf);
+}
+
 __attribute_nonnull__()
 __attribute_pure__
 static const char * http_request_check_line_minimal (const char * const restrict s, const uint_fast32_t len) {
@@ -1112,6 +1169,10 @@ static int http_request_parse_header_other(request_st * const restrict r, const
 
 static int http_request_parse_headers(request_st * const restrict r, char * const restrict ptr, const unsigned short * const restrict hoff, const unsigned int http_parseopts) {
     const unsigned int http_header_strict = (http_parseopts & HTTP_PARSEOPT_HEADER_STRICT);
+    /* check field values individually only if block check finds error */
+    const int check_values = http_header_strict && hoff[0] > 2
+      && !http_request_check_block_strict(ptr+hoff[2],
+                                          (uint32_t)(hoff[hoff[0]]-hoff[2]));
 
   #if 0 /*(not checked here; will later result in invalid label for HTTP header)*/
     int i = hoff[2];
@@ -1208,7 +1269,7 @@ static int http_request_parse_headers(request_st * const restrict r, char * cons
             continue; /* ignore empty header */
         }
 
-        if (http_header_strict) {
+        if (check_values) {
             const char * const x = http_request_check_line_strict(v, vlen);
             if (x)
                 return http_request_header_char_invalid(r, *x,
@@ -480,14 +480,22 @@ http_response_errdoc_init (request_st * const r)
 {
     /* modules that produce headers required with error response should
      * typically also produce an error document.  Make an exception for
-     * mod_auth WWW-Authenticate response header. */
+     * mod_auth WWW-Authenticate response header, and for Retry-After with
+     * 429 Too Many Requests or 503 Service Unavailable. */
     buffer *www_auth = NULL;
+    buffer *retry_after = NULL;
     if (401 == r->http_status) {
         const buffer * const vb =
           http_header_response_get(r, HTTP_HEADER_WWW_AUTHENTICATE,
                                    CONST_STR_LEN("WWW-Authenticate"));
         if (NULL != vb) buffer_copy_buffer((www_auth = buffer_init()), vb);
     }
+    else if (429 == r->http_status || 503 == r->http_status) {
+        const buffer * const vb =
+          http_header_response_get(r, HTTP_HEADER_OTHER,
+                                   CONST_STR_LEN("Retry-After"));
+        if (NULL != vb) buffer_copy_buffer((retry_after = buffer_init()), vb);
+    }
 
     buffer_reset(&r->physical.path);
     r->resp_htags = 0;
@@ -500,6 +508,13 @@ http_response_errdoc_init (request_st * const r)
                                  BUF_PTR_LEN(www_auth));
         buffer_free(www_auth);
     }
+
+    if (NULL != retry_after) {
+        http_header_response_set(r, HTTP_HEADER_OTHER,
+                                 CONST_STR_LEN("Retry-After"),
+                                 BUF_PTR_LEN(retry_after));
+        buffer_free(retry_after);
+    }
 }
 
 
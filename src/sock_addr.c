@@ -11,6 +11,7 @@
 #include "sys-socket.h"
 #include <sys/types.h>
 #include <errno.h>
+#include <stdlib.h>
 #include <string.h>
 #ifndef _WIN32
 #include <netdb.h>
@@ -191,6 +192,94 @@ int sock_addr_is_addr_eq_bits(const sock_addr *a, const sock_addr *b, int bits)
 }
 
 
+/* trie node child 0 is empty; child 1 is leaf for mask match;
+ * nodes[0] and nodes[1] are not used (nodes are allocated starting at 2) */
+#define SOCK_ADDR_CIDR_MATCH 1
+
+static uint32_t sock_addr_cidr_bit (const uint8_t * const a, const int i) {
+    return (a[i >> 3] >> (7 - (i & 7))) & 1;
+}
+
+static void sock_addr_cidr_insert_bits (sock_addr_cidr * const restrict t, const int tree, const uint8_t * const restrict a, const int bits) {
+    /* reserve enough nodes for this insert so that nodes are not reallocated
+     * while holding pointer into nodes */
+    if (t->size - t->used < (uint32_t)bits) {
+        if (0 == t->size) t->used = 2;
+        const uint32_t x = (uint32_t)bits + 128;
+        ck_realloc_u32((void **)&t->nodes, t->size, x, sizeof(*t->nodes));
+        t->size += x;
+    }
+
+    uint32_t *n = &t->root[tree];
+    for (int i = 0; i < bits; ++i) {
+        if (SOCK_ADDR_CIDR_MATCH == *n)
+            return; /* already covered by shorter mask */
+        if (0 == *n) {
+            *n = t->used++;
+            t->nodes[*n][0] = t->nodes[*n][1] = 0;
+        }
+        n = &t->nodes[*n][sock_addr_cidr_bit(a, i)];
+    }
+    /*(replaces any longer masks under this prefix; those nodes unused)*/
+    *n = SOCK_ADDR_CIDR_MATCH;
+}
+
+static int sock_addr_cidr_match_bits (const sock_addr_cidr * const restrict t, const int tree, const uint8_t * const restrict a, const int bits) {
+    uint32_t n = t->root[tree];
+    for (int i = 0; n > SOCK_ADDR_CIDR_MATCH && i < bits; ++i)
+        n = t->nodes[n][sock_addr_cidr_bit(a, i)];
+    return (SOCK_ADDR_CIDR_MATCH == n);
+}
+
+int sock_addr_cidr_insert (sock_addr_cidr * const restrict t, const sock_addr * const restrict addr, int bits) {
+    if (bits < 0) return -1;
+    switch (addr->plain.sa_family) {
+      case AF_INET:
+        if (bits > 32) bits = 32;
+        sock_addr_cidr_insert_bits(t, 0,
+          (const uint8_t *)&addr->ipv4.sin_addr.s_addr, bits);
+        return 0;
+     #ifdef HAVE_IPV6
+      case AF_INET6:
+        if (bits > 128) bits = 128;
+        if (bits >= 96 && IN6_IS_ADDR_V4MAPPED(&addr->ipv6.sin6_addr))
+            sock_addr_cidr_insert_bits(t, 0,
+              addr->ipv6.sin6_addr.s6_addr+12, bits - 96);
+        else
+            sock_addr_cidr_insert_bits(t, 1,
+              addr->ipv6.sin6_addr.s6_addr, bits);
+        return 0;
+     #endif
+      default:
+        return -1;
+    }
+}
+
+int sock_addr_cidr_match (const sock_addr_cidr * const restrict t, const sock_addr * const restrict addr) {
+    switch (addr->plain.sa_family) {
+      case AF_INET:
+        return sock_addr_cidr_match_bits(t, 0,
+          (const uint8_t *)&addr->ipv4.sin_addr.s_addr, 32);
+     #ifdef HAVE_IPV6
+      case AF_INET6:
+        if (IN6_IS_ADDR_V4MAPPED(&addr->ipv6.sin6_addr)
+            && sock_addr_cidr_match_bits(t, 0,
+                 addr->ipv6.sin6_addr.s6_addr+12, 32))
+            return 1;
+        return sock_addr_cidr_match_bits(t, 1,
+          addr->ipv6.sin6_addr.s6_addr, 128);
+     #endif
+      default:
+        return 0;
+    }
+}
+
+void sock_addr_cidr_free (sock_addr_cidr * const t) {
+    free(t->nodes);
+    memset(t, 0, sizeof(*t));
+}
+
+
 void sock_addr_set_port (sock_addr * const restrict saddr, const unsigned short port)
 {
     switch (saddr->plain.sa_family) {
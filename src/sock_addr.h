@@ -50,6 +50,24 @@ int sock_addr_is_addr_port_eq (const sock_addr *saddr1, const sock_addr *saddr2)
 __attribute_pure__
 int sock_addr_is_addr_eq_bits(const sock_addr * restrict a, const sock_addr * restrict b, int bits);
 
+/* set of IPv4 and IPv6 CIDR masks (binary trie)
+ * (e.g. built at config load and checked per request; lookup cost depends on
+ *  address length (max 32 or 128 steps), not on number of masks in set)
+ * (zero-initialize before first use) */
+typedef struct sock_addr_cidr {
+    uint32_t root[2]; /* [0] IPv4 (and IPv4-mapped IPv6), [1] IPv6 */
+    uint32_t used;
+    uint32_t size;
+    uint32_t (*nodes)[2];
+} sock_addr_cidr;
+
+int sock_addr_cidr_insert (sock_addr_cidr * restrict t, const sock_addr * restrict addr, int bits);
+
+__attribute_pure__
+int sock_addr_cidr_match (const sock_addr_cidr * restrict t, const sock_addr * restrict addr);
+
+void sock_addr_cidr_free (sock_addr_cidr *t);
+
 void sock_addr_set_port (sock_addr * restrict saddr, unsigned short port);
 
 int sock_addr_assign (sock_addr * restrict saddr, int family, unsigned short nport, const void * restrict naddr);
@@ -0,0 +1,157 @@
+#ifndef LI_SYS_SIMD_H
+#define LI_SYS_SIMD_H
+#include "first.h"
+
+/* minimal 16-byte SIMD byte classification (SSE2 or NEON)
+ *
+ * LI_SIMD is defined if available; callers must provide scalar fallback.
+ * li_simd_v*() comparisons return a vector (0xff for each matching byte)
+ * which may be combined and then converted with li_simd_movemask() into a
+ * bitmask with one bit per matching byte, in which byte order is preserved;
+ * bits are LI_SIMD_MASK_STRIDE apart.  li_simd_eq(), li_simd_lt(),
+ * li_simd_ge() are shortcuts returning a bitmask for a single comparison.
+ *   li_simd_mask_first()  index of first matching byte (mask must be != 0)
+ *   li_simd_mask_last()   index of last matching byte (mask must be != 0)
+ *   li_simd_mask_next()   clear first matching byte from mask
+ *   li_simd_mask_count()  number of matching bytes
+ */
+
+#if defined(__GNUC__) || defined(__clang__)
+
+#if defined(__SSE2__)
+
+#include <emmintrin.h>
+
+#define LI_SIMD 16
+#define LI_SIMD_MASK_STRIDE 1
+
+typedef __m128i li_simd_t;
+typedef uint32_t li_simd_mask_t;
+
+#define LI_SIMD_MASK_ALL 0xFFFFu
+
+static inline li_simd_t
+li_simd_load (const void * const s)
+{
+    return _mm_loadu_si128((const __m128i *)s);
+}
+
+static inline li_simd_mask_t
+li_simd_movemask (const li_simd_t cmp)
+{
+    return (li_simd_mask_t)_mm_movemask_epi8(cmp);
+}
+
+static inline li_simd_t
+li_simd_veq (const li_simd_t v, const uint8_t c)
+{
+    return _mm_cmpeq_epi8(v, _mm_set1_epi8((char)c));
+}
+
+/* (unsigned) v < c  (c > 0) */
+static inline li_simd_t
+li_simd_vlt (const li_simd_t v, const uint8_t c)
+{
+    return _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8((char)(c-1))), v);
+}
+
+/* (unsigned) v >= c */
+static inline li_simd_t
+li_simd_vge (const li_simd_t v, const uint8_t c)
+{
+    return _mm_cmpeq_epi8(_mm_max_epu8(v, _mm_set1_epi8((char)c)), v);
+}
+
+/* (unsigned) lo <= v && v <= hi */
+static inline li_simd_t
+li_simd_vrange (const li_simd_t v, const uint8_t lo, const uint8_t hi)
+{
+    return _mm_cmpeq_epi8(_mm_max_epu8(_mm_min_epu8(v,
+                                         _mm_set1_epi8((char)hi)),
+                                       _mm_set1_epi8((char)lo)), v);
+}
+
+#define li_simd_vor(a,b) _mm_or_si128((a),(b))
+
+#define li_simd_mask_first(m) ((uint32_t)__builtin_ctz(m))
+#define li_simd_mask_last(m)  ((uint32_t)(31 - __builtin_clz(m)))
+#define li_simd_mask_count(m) ((uint32_t)__builtin_popcount(m))
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+#include <arm_neon.h>
+
+#define LI_SIMD 16
+#define LI_SIMD_MASK_STRIDE 4
+
+typedef uint8x16_t li_simd_t;
+typedef uint64_t li_simd_mask_t;
+
+#define LI_SIMD_MASK_ALL 0x8888888888888888uLL
+
+static inline li_simd_t
+li_simd_load (const void * const s)
+{
+    return vld1q_u8((const uint8_t *)s);
+}
+
+static inline li_simd_mask_t
+li_simd_movemask (const li_simd_t cmp)
+{
+    /* narrow each 0x00/0xff byte to a nibble; keep one bit per nibble */
+    return vget_lane_u64(vreinterpret_u64_u8(
+             vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4)), 0)
+         & LI_SIMD_MASK_ALL;
+}
+
+static inline li_simd_t
+li_simd_veq (const li_simd_t v, const uint8_t c)
+{
+    return vceqq_u8(v, vdupq_n_u8(c));
+}
+
+/* (unsigned) v < c */
+static inline li_simd_t
+li_simd_vlt (const li_simd_t v, const uint8_t c)
+{
+    return vcltq_u8(v, vdupq_n_u8(c));
+}
+
+/* (unsigned) v >= c */
+static inline li_simd_t
+li_simd_vge (const li_simd_t v, const uint8_t c)
+{
+    return vcgeq_u8(v, vdupq_n_u8(c));
+}
+
+/* (unsigned) lo <= v && v <= hi */
+static inline li_simd_t
+li_simd_vrange (const li_simd_t v, const uint8_t lo, const uint8_t hi)
+{
+    return vandq_u8(vcgeq_u8(v, vdupq_n_u8(lo)), vcleq_u8(v, vdupq_n_u8(hi)));
+}
+
+#define li_simd_vor(a,b) vorrq_u8((a),(b))
+
+#define li_simd_mask_first(m) ((uint32_t)__builtin_ctzll(m) >> 2)
+#define li_simd_mask_last(m)  ((uint32_t)(63 - __builtin_clzll(m)) >> 2)
+#define li_simd_mask_count(m) ((uint32_t)__builtin_popcountll(m))
+
+#endif
+
+#define li_simd_mask_next(m) ((m) & ((m) - 1))
+
+/* shift mask by one byte position toward higher index; carry in last
+ * byte position from mask of previous block */
+#define li_simd_mask_shift1(m,prev) \
+  ((((m) << LI_SIMD_MASK_STRIDE) | ((prev) >> (15*LI_SIMD_MASK_STRIDE))) \
+   & LI_SIMD_MASK_ALL)
+
+#define li_simd_eq(v,c) li_simd_movemask(li_simd_veq((v),(c)))
+#define li_simd_lt(v,c) li_simd_movemask(li_simd_vlt((v),(c)))
+#define li_simd_ge(v,c) li_simd_movemask(li_simd_vge((v),(c)))
+
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
+
+#endif
@@ -63,10 +63,54 @@ static void test_array_set_key_value (void) {
     array_free(a);
 }
 
+static void test_array_get_buf_ptr_ext (void) {
+    array *a = array_init(0);
+    buffer *b;
+
+    /* (ext values here are arbitrary non-zero ids) */
+    b = array_get_buf_ptr_ext(a, 0, CONST_STR_LEN("X-Other"));
+    buffer_copy_string_len(b, CONST_STR_LEN("other"));
+    b = array_get_buf_ptr_ext(a, 3, CONST_STR_LEN("Accept"));
+    buffer_copy_string_len(b, CONST_STR_LEN("*/*"));
+    b = array_get_buf_ptr_ext(a, 7, CONST_STR_LEN("Cookie"));
+    buffer_copy_string_len(b, CONST_STR_LEN("a=1; b=2; c=3"));
+    buffer * const cookie = b;
+    b = array_get_buf_ptr_ext(a, 0, CONST_STR_LEN("X-Other"));
+    assert(buffer_eq_slen(b, CONST_STR_LEN("other")));
+    buffer * const other = b;
+    assert(3 == a->used);
+
+    /* reset as done between requests; insert in different order */
+    array_reset_data_strings(a);
+    assert(0 == a->used);
+    b = array_get_buf_ptr_ext(a, 7, CONST_STR_LEN("cookie"));
+    assert(b == cookie);
+    assert(buffer_is_blank(b));
+    b = array_get_buf_ptr_ext(a, 0, CONST_STR_LEN("X-Other"));
+    assert(b == other);
+    assert(buffer_is_blank(b));
+    buffer_copy_string_len(b, CONST_STR_LEN("x"));
+    b = array_get_buf_ptr_ext(a, 0, CONST_STR_LEN("X-New"));
+    buffer_copy_string_len(b, CONST_STR_LEN("y"));
+    assert(3 == a->used);
+
+    data_string *ds = (data_string *)array_get_element_klen_ext(a, 7, CONST_STR_LEN("Cookie"));
+    assert(NULL != ds && &ds->value == cookie);
+    assert(buffer_eq_slen(&ds->key, CONST_STR_LEN("cookie")));
+    ds = (data_string *)array_get_element_klen_ext(a, 0, CONST_STR_LEN("X-Other"));
+    assert(NULL != ds && buffer_eq_slen(&ds->value, CONST_STR_LEN("x")));
+    ds = (data_string *)array_get_element_klen_ext(a, 0, CONST_STR_LEN("X-New"));
+    assert(NULL != ds && buffer_eq_slen(&ds->value, CONST_STR_LEN("y")));
+    assert(NULL == array_get_element_klen_ext(a, 3, CONST_STR_LEN("Accept")));
+
+    array_free(a);
+}
+
 void test_array (void);
 void test_array (void)
 {
     test_array_get_int_ptr();
     test_array_insert_value();
     test_array_set_key_value();
+    test_array_get_buf_ptr_ext();
 }
@@ -1,7 +1,10 @@
 #include "first.h"
 
+#undef NDEBUG
+#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "burl.c"
 
@@ -153,8 +156,81 @@ static void test_burl_normalize (void) {
     buffer_free(ptmp);
 }
 
+static void test_burl_normalize_scan (void) {
+    /* burl_normalize_scan() must either defer to burl_normalize_steps()
+     * or return same qs for URL which burl_normalize_steps() leaves as-is */
+    static const char * const urls[] = {
+      "/",
+      "/abcdefghijklmnopqrstuvwxyz/0123456789/index.html",
+      "/abcdefghijklmnopqrstuvwxyz/0123456789/index.html?a=b&c=d/e?f",
+      "/abcdefghijklmno/.well-known/acme-challenge/x",
+      "/abcdefghijklmn/./index.html",
+      "/abcdefghijklmno//index.html",
+      "/abcdefghijklmnop/../index.html",
+      "/abcdefghijklmnopqrstuvwxyz/index.html?url=http://x/./y",
+      "/abcdefghijklmnopqrstuvwxyz?a=b/./c?d=e//f",
+      "/abcdefghijklmnopqrstuvwxyz/index.html/.",
+      "./abcdefghijklmnopqrstuvwxyz/index.html",
+      "/abcdefghijklmnopqrstuvwxyz/%7e/index.html",
+      "/abcdefghijklmnopqrstuvwxyz/index.html#frag",
+      "/abcdefghijklmnopqrstuvwxyz/{index}.html",
+      "/abcdefghijklmnopqrstuvwxyz/index html",
+      "/abcdefghijklmnopqrstuvwxyz/index\177.html",
+      "/abcdefghijklmnopqrstuvwxyz/ind\303\244x.html",
+      "/abcdefghijklmnopqrstuvwxyz/ind[e]x^`|.html",
+      "/abcdefghijklmnopqrstuvwxyz/~!$&'()*+,;=:@-_.html",
+    };
+    static const int flagsets[] = {
+      HTTP_PARSEOPT_URL_NORMALIZE_UNRESERVED,
+      HTTP_PARSEOPT_URL_NORMALIZE_REQUIRED,
+      HTTP_PARSEOPT_URL_NORMALIZE_UNRESERVED
+     |HTTP_PARSEOPT_URL_NORMALIZE_PATH_DOTSEG_REMOVE,
+      HTTP_PARSEOPT_URL_NORMALIZE_REQUIRED
+     |HTTP_PARSEOPT_URL_NORMALIZE_PATH_DOTSEG_REJECT,
+      HTTP_PARSEOPT_URL_NORMALIZE_UNRESERVED
+     |HTTP_PARSEOPT_URL_NORMALIZE_PATH_DOTSEG_REMOVE
+     |HTTP_PARSEOPT_URL_NORMALIZE_PATH_2F_DECODE
+     |HTTP_PARSEOPT_URL_NORMALIZE_QUERY_20_PLUS
+     |HTTP_PARSEOPT_URL_NORMALIZE_CTRLS_REJECT,
+    };
+    buffer *psrc = buffer_init();
+    buffer *ptmp = buffer_init();
+    for (size_t i = 0; i < sizeof(urls)/sizeof(*urls); ++i) {
+        for (size_t j = 0; j < sizeof(flagsets)/sizeof(*flagsets); ++j) {
+            buffer_copy_string(psrc, urls[i]);
+            const int qs = burl_normalize_scan(psrc, flagsets[j]);
+            if (-3 == qs) continue;
+            const int qs2 = burl_normalize_steps(psrc, ptmp, flagsets[j]);
+            if (qs != qs2 || !buffer_eq_slen(psrc, urls[i], strlen(urls[i]))) {
+                fprintf(stderr,
+                        "%s.%d: %s('%s') failed: qs %d, expected %d ('%s')\n",
+                        __FILE__, __LINE__, __func__+5, urls[i], qs, qs2,
+                        psrc->ptr);
+                fflush(stderr);
+                abort();
+            }
+        }
+    }
+    /* already-normalized URLs take fast path */
+    buffer_copy_string(psrc, urls[2]);
+    assert(49 == burl_normalize_scan(psrc,
+                                     HTTP_PARSEOPT_URL_NORMALIZE_UNRESERVED
+                                    |HTTP_PARSEOPT_URL_NORMALIZE_PATH_DOTSEG_REMOVE));
+    assert(59 == burl_normalize_scan(psrc,
+                                     HTTP_PARSEOPT_URL_NORMALIZE_REQUIRED));
+    buffer_copy_string(psrc, urls[3]);
+    assert(-1 == burl_normalize_scan(psrc,
+                                     HTTP_PARSEOPT_URL_NORMALIZE_UNRESERVED));
+    assert(-3 == burl_normalize_scan(psrc,
+                                     HTTP_PARSEOPT_URL_NORMALIZE_UNRESERVED
+                                    |HTTP_PARSEOPT_URL_NORMALIZE_PATH_DOTSEG_REMOVE));
+    buffer_free(psrc);
+    buffer_free(ptmp);
+}
+
 void test_burl (void);
 void test_burl (void)
 {
     test_burl_normalize();
+    test_burl_normalize_scan();
 }
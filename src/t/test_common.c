@@ -11,7 +11,9 @@ void test_http_header (void);
 void test_http_kv (void);
 void test_http_range (void);
 void test_keyvalue (void);
+void test_lshpack (void);
 void test_request (void);
+void test_sock_addr (void);
 
 int main(void) {
     test_array();
@@ -22,7 +24,9 @@ int main(void) {
     test_http_kv();
     test_http_range();
     test_keyvalue();
+    test_lshpack();
     test_request();
+    test_sock_addr();
 
     return 0;
 }
@@ -0,0 +1,384 @@
+#include "first.h"
+
+#undef NDEBUG
+#include <sys/types.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "gw_backend.c"
+
+static void test_gw_latency (void) {
+    uint32_t ewma = gw_latency_ewma(0, 1000);
+    assert(1000 == ewma);
+    for (int i = 0; i < 64; ++i)
+        ewma = gw_latency_ewma(ewma, 1000);
+    assert(1000 == ewma);
+
+    /* a single long request (e.g. long-poll) does not replace the average */
+    ewma = gw_latency_ewma(ewma, 60000000);
+    assert(ewma < 16000000);
+    /* and is forgotten after typical samples */
+    for (int i = 0; i < 256; ++i)
+        ewma = gw_latency_ewma(ewma, 1000);
+    assert(ewma < 2000);
+
+    /* sustained slowdown is detected quickly */
+    ewma = 1000;
+    for (int i = 0; i < 8; ++i)
+        ewma = gw_latency_ewma(ewma, 100000);
+    assert(ewma > 90000);
+
+    /* estimate decays without new samples */
+    ewma = 60000000;
+    assert(ewma == gw_latency_decay(ewma, 100, 100));
+    assert(ewma == gw_latency_decay(ewma, 100, 101));
+    for (unix_time64_t ts = 102; ts < 102+32; ++ts)
+        ewma = gw_latency_decay(ewma, 100, ts);
+    assert(0 == ewma); /*(0 is treated as no samples; proc will be selected)*/
+}
+
+static void test_gw_procs_demand (void) {
+    gw_host host;
+    memset(&host, 0, sizeof(host));
+    host.min_procs = 1;
+    host.max_procs = 4;
+
+    /* max_load_per_proc 0: 1 request in-flight per proc */
+    host.load = 0;
+    assert(1 == gw_host_procs_demand(&host)); /* min_procs */
+    host.load = 3;
+    assert(3 == gw_host_procs_demand(&host));
+    host.load = 100;
+    assert(4 == gw_host_procs_demand(&host)); /* max_procs */
+
+    host.max_load_per_proc = 4;
+    host.load = 4;
+    assert(1 == gw_host_procs_demand(&host));
+    host.load = 5;
+    assert(2 == gw_host_procs_demand(&host)); /* (rounded up) */
+    host.load = 16;
+    assert(4 == gw_host_procs_demand(&host));
+
+    host.min_procs = 0;
+    host.load = 0;
+    assert(0 == gw_host_procs_demand(&host));
+
+    /* idle procs over demand are terminated after idle_timeout */
+    gw_proc proc;
+    memset(&proc, 0, sizeof(proc));
+    proc.pid = 1;
+    proc.last_used = 100;
+    assert(gw_proc_idle_expired(&proc, 101));
+    assert(!gw_proc_idle_expired(&proc, 100));
+    proc.load = 1;
+    assert(!gw_proc_idle_expired(&proc, 101)); /* busy */
+    proc.load = 0;
+    proc.pid = 0;
+    assert(!gw_proc_idle_expired(&proc, 101)); /* not running */
+}
+
+static uint32_t test_gw_hash_moved (const uint8_t * const a, const uint8_t * const b, const uint32_t nkeys) {
+    uint32_t moved = 0;
+    for (uint32_t i = 0; i < nkeys; ++i) moved += (a[i] != b[i]);
+    return moved;
+}
+
+static void test_gw_hash_map (const gw_extension * const ext, uint8_t * const map, const uint32_t nkeys, const int bounded) {
+    for (uint32_t i = 0; i < nkeys; ++i) {
+        char key[32];
+        const int len = snprintf(key, sizeof(key), "/path/%u", i);
+        const uint32_t base_hash = gw_hash(key, (uint32_t)len, DJBHASH_INIT);
+        const int ndx = gw_host_get_hash(ext, base_hash, bounded);
+        assert(ndx >= 0);
+        map[i] = (uint8_t)ndx;
+    }
+}
+
+static void test_gw_hash (void) {
+    enum { NKEYS = 12000, NHOSTS = 6 };
+    static uint8_t map0[NKEYS], map1[NKEYS];
+    gw_host hosts[NHOSTS];
+    gw_host *hptrs[NHOSTS];
+    gw_extension ext;
+    memset(hosts, 0, sizeof(hosts));
+    memset(&ext, 0, sizeof(ext));
+    ext.hosts = hptrs;
+    ext.used = NHOSTS;
+    for (int k = 0; k < NHOSTS; ++k) {
+        char h[16];
+        const int len = snprintf(h, sizeof(h), "10.0.0.%d", k+1);
+        hosts[k].gw_hash = gw_hash(h, (uint32_t)len, DJBHASH_INIT) ^ 8080;
+        hosts[k].hash_load_bound = 25;
+        hosts[k].active_procs = (k < NHOSTS-1); /* last host starts down */
+        hptrs[k] = &hosts[k];
+    }
+
+    /* keys spread about evenly over 5 active hosts */
+    test_gw_hash_map(&ext, map0, NKEYS, 1);
+    uint32_t count[NHOSTS];
+    memset(count, 0, sizeof(count));
+    for (uint32_t i = 0; i < NKEYS; ++i) ++count[map0[i]];
+    assert(0 == count[NHOSTS-1]);
+    for (int k = 0; k < NHOSTS-1; ++k)
+        assert(count[k] > NKEYS/5 * 3/4 && count[k] < NKEYS/5 * 5/4);
+
+    /* host added: ~1/6 keys move, all to the new host */
+    hosts[NHOSTS-1].active_procs = 1;
+    test_gw_hash_map(&ext, map1, NKEYS, 1);
+    uint32_t moved = test_gw_hash_moved(map0, map1, NKEYS);
+    assert(moved > NKEYS/6 * 3/4 && moved < NKEYS/6 * 5/4);
+    for (uint32_t i = 0; i < NKEYS; ++i)
+        assert(map0[i] == map1[i] || map1[i] == NHOSTS-1);
+
+    /* host removed: only keys of removed host move */
+    hosts[0].active_procs = 0;
+    test_gw_hash_map(&ext, map0, NKEYS, 1);
+    moved = test_gw_hash_moved(map0, map1, NKEYS);
+    for (uint32_t i = 0; i < NKEYS; ++i)
+        assert(map0[i] == map1[i] || map1[i] == 0);
+    assert(moved > NKEYS/6 * 3/4 && moved < NKEYS/6 * 5/4);
+    hosts[0].active_procs = 1;
+
+    /* bounded loads: host at (1 + 25%) of average load is skipped */
+    const uint32_t key = 12345;
+    const int ndx = gw_host_get_hash(&ext, key, 1);
+    for (int k = 0; k < NHOSTS; ++k) hosts[k].load = 4;
+    assert(ndx == gw_host_get_hash(&ext, key, 1));
+    hosts[ndx].load = 5; /* (5 < (6*4+1+1) * 1.25 / 6) */
+    assert(ndx == gw_host_get_hash(&ext, key, 1));
+    hosts[ndx].load = 6; /* (6 >= (6*4+2+1) * 1.25 / 6) */
+    assert(ndx != gw_host_get_hash(&ext, key, 1));
+    /* (not bounded if hash-load-bound is 0) */
+    hosts[ndx].hash_load_bound = 0;
+    assert(ndx == gw_host_get_hash(&ext, key, 1));
+    hosts[ndx].hash_load_bound = 100; /* (6 < (6*4+2+1) * 2 / 6) */
+    assert(ndx == gw_host_get_hash(&ext, key, 1));
+
+    /* balance "sticky": not bounded, and weight is (key ^ host hash),
+     * unchanged from prior releases so that client affinity is preserved */
+    int sticky = -1;
+    uint32_t max = 0;
+    for (int k = 0; k < NHOSTS; ++k) {
+        if (max <= (key ^ hosts[k].gw_hash)) {
+            max = key ^ hosts[k].gw_hash;
+            sticky = k;
+        }
+    }
+    hosts[sticky].load = 100;
+    assert(sticky == gw_host_get_hash(&ext, key, 0));
+}
+
+#ifndef _WIN32
+
+#include <netinet/in.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include "fdevent_impl.h"
+#include "fdlog.h"
+
+static int test_gw_fdevent_set (fdevents *ev, fdnode *fdn, int events) {
+    UNUSED(ev);
+    UNUSED(events);
+    fdn->fde_ndx = 0;
+    return 0;
+}
+
+static int test_gw_fdevent_del (fdevents *ev, fdnode *fdn) {
+    UNUSED(ev);
+    UNUSED(fdn);
+    return 0;
+}
+
+static void test_gw_fdevent_run (fdevents * const ev, gw_proc * const proc) {
+    /* wait for pending (async) health check connect() and run handler */
+    if (proc->hc) {
+        fdnode * const fdn = proc->hc->fdn;
+        struct pollfd pfd = { fdn->fd, POLLOUT, 0 };
+        assert(1 == poll(&pfd, 1, 5000));
+        int revents = 0;
+        if (pfd.revents & POLLOUT) revents |= FDEVENT_OUT;
+        if (pfd.revents & POLLERR) revents |= FDEVENT_ERR;
+        if (pfd.revents & POLLHUP) revents |= FDEVENT_HUP;
+        (*fdn->handler)(fdn->ctx, revents);
+    }
+    assert(NULL == proc->hc);
+    /* close scheduled fds */
+    for (fdnode *fdn = ev->pendclose, *next; fdn; fdn = next) {
+        next = (fdnode *)fdn->ctx;
+        ev->fdarray[fdn->fd] = NULL;
+        close(fdn->fd);
+        --(*ev->cur_fds);
+        free(fdn);
+    }
+    ev->pendclose = NULL;
+}
+
+static void test_gw_health (void) {
+    /* backend address bound, but not listening (connect() refused) */
+    struct sockaddr_in sin;
+    socklen_t slen = sizeof(sin);
+    memset(&sin, 0, sizeof(sin));
+    sin.sin_family = AF_INET;
+    sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    const int sfd = socket(AF_INET, SOCK_STREAM, 0);
+    assert(-1 != sfd);
+    assert(0 == bind(sfd, (struct sockaddr *)&sin, sizeof(sin)));
+    assert(0 == getsockname(sfd, (struct sockaddr *)&sin, &slen));
+
+    static server srv;
+    fdevents ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.maxfds = 4096;
+    ev.fdarray = ck_calloc(ev.maxfds, sizeof(*ev.fdarray));
+    ev.event_set = test_gw_fdevent_set;
+    ev.event_del = test_gw_fdevent_del;
+    ev.cur_fds = &srv.cur_fds;
+    ev.errh = srv.errh = fdlog_init(NULL, -1, FDLOG_FD);
+    srv.errh->fd = -1; /* (disable) */
+    srv.ev = &ev;
+
+    int died = 0;
+    gw_host host;
+    gw_proc proc;
+    memset(&host, 0, sizeof(host));
+    memset(&proc, 0, sizeof(proc));
+    host.family = AF_INET;
+    host.disable_time = 1;
+    host.connect_timeout = 2;
+    host.health_check_interval = 2;
+    host.active_procs = 1;
+    host.first = &proc;
+    proc.state = PROC_STATE_RUNNING;
+    proc.saddr = (struct sockaddr *)&sin;
+    proc.saddrlen = slen;
+    proc.connection_name = buffer_init();
+    buffer_copy_string_len(proc.connection_name, CONST_STR_LEN("127.0.0.1"));
+    proc.stats_died = &died;
+
+    /* dead backend is marked down */
+    log_monotonic_secs = 1000;
+    gw_handle_trigger_host_health(&srv, &host);
+    test_gw_fdevent_run(&ev, &proc);
+    assert(PROC_STATE_OVERLOADED == proc.state);
+    assert(0 == host.active_procs);
+    assert(1 == died);
+    assert(proc.disabled_until >= 1000 + host.health_check_interval);
+
+    /* not checked again before health-check-interval */
+    log_monotonic_secs = 1001;
+    gw_handle_trigger_host_health(&srv, &host);
+    assert(NULL == proc.hc && NULL == ev.pendclose);
+    assert(PROC_STATE_OVERLOADED == proc.state);
+
+    /* still down: remains disabled */
+    log_monotonic_secs = 1002;
+    gw_handle_trigger_host_health(&srv, &host);
+    test_gw_fdevent_run(&ev, &proc);
+    assert(PROC_STATE_OVERLOADED == proc.state);
+    assert(1 == died);
+
+    /* backend listening: marked up (before disabled_until expires) */
+    assert(0 == listen(sfd, 8));
+    log_monotonic_secs = 1004;
+    assert(proc.disabled_until > log_monotonic_secs);
+    gw_handle_trigger_host_health(&srv, &host);
+    test_gw_fdevent_run(&ev, &proc);
+    assert(PROC_STATE_RUNNING == proc.state);
+    assert(1 == host.active_procs);
+    assert(0 == proc.disabled_until);
+
+    /* up backend remains up */
+    log_monotonic_secs = 1006;
+    gw_handle_trigger_host_health(&srv, &host);
+    test_gw_fdevent_run(&ev, &proc);
+    assert(PROC_STATE_RUNNING == proc.state);
+    assert(0 == srv.cur_fds);
+
+    close(sfd);
+    buffer_free(proc.connection_name);
+    fdlog_free(srv.errh);
+    free(ev.fdarray);
+    log_monotonic_secs = 0;
+}
+
+#endif /* !_WIN32 */
+
+#ifdef GW_PROC_SHM
+
+static void test_gw_shm (void) {
+    /* load counted per worker; load of worker which exits is discarded */
+    int stats_load = 0, stats_active = 0;
+    gw_host host;
+    gw_proc proc;
+    memset(&host, 0, sizeof(host));
+    memset(&proc, 0, sizeof(proc));
+    host.max_procs = 1;
+    host.first = &proc;
+    host.stats_global_active = &stats_active;
+    proc.stats_load = &stats_load;
+    log_error_st * const errh = fdlog_init(NULL, -1, FDLOG_FD);
+    errh->fd = -1; /* (disable) */
+    gw_host_shm_init(&host, 2, errh);
+    assert(NULL != proc.shm);
+
+    /* worker exits with requests in-progress */
+    const pid_t pid = fork();
+    assert(-1 != pid);
+    if (0 == pid) {
+        gw_proc_load_inc(&host, &proc);
+        gw_proc_load_inc(&host, &proc);
+        _exit(0);
+    }
+    int status;
+    assert(pid == fdevent_waitpid(pid, &status, 0));
+    assert(2 == gw_proc_load(&host, &proc));
+
+    /* (this process as another worker) */
+    gw_proc_load_inc(&host, &proc);
+    assert(3 == gw_proc_load(&host, &proc));
+    gw_host_shm_reap(&host, pid);
+    assert(1 == gw_proc_load(&host, &proc));
+
+    /* worker slot is released for reuse */
+    assert(0 == host.shm_workers[0] || 0 == host.shm_workers[1]);
+
+    gw_proc_load_dec(&host, &proc);
+    assert(0 == gw_proc_load(&host, &proc));
+
+    /* respawned proc (same id) does not inherit state of previous proc */
+    proc.disabled_until = 123;
+    gw_proc_shm_publish(&proc);
+    gw_proc_shm_attach(&host, &proc, errh);
+    assert(0 == proc.shm->disabled_until);
+
+    /* proc id without shared state slot is not published */
+    gw_proc proc2;
+    memset(&proc2, 0, sizeof(proc2));
+    proc2.id = host.max_procs;
+    proc2.connection_name = buffer_init();
+    gw_proc_shm_attach(&host, &proc2, errh);
+    assert(NULL == proc2.shm);
+    buffer_free(proc2.connection_name);
+
+    munmap((void *)host.shm_workers, gw_host_shm_size(&host));
+    fdlog_free(errh);
+}
+
+#endif /* GW_PROC_SHM */
+
+void test_gw_backend (void);
+void test_gw_backend (void)
+{
+    test_gw_latency();
+    test_gw_procs_demand();
+    test_gw_hash();
+  #ifndef _WIN32
+    test_gw_health();
+  #endif
+  #ifdef GW_PROC_SHM
+    test_gw_shm();
+  #endif
+}
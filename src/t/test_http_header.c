@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "http_header.c"
 
@@ -104,8 +105,64 @@ static void test_http_header_tables (void) {
     }
 }
 
+static void test_http_header_parse_hoff (void) {
+    /* compare with simple line-by-line scan; vary line lengths so that line
+     * ends fall in various positions relative to (SIMD) block boundaries */
+    char buf[2048];
+    unsigned short hoff[8192];
+    unsigned short xoff[8192];
+    for (uint32_t n = 1; n < 40; ++n) {
+        uint32_t len = 0;
+        for (uint32_t j = 0; len + n + 4 < sizeof(buf)-2 && j < 40; ++j) {
+            memset(buf+len, 'a', n + j % 3);
+            len += n + j % 3;
+            if (j % 5 == 4) /*(bare LF)*/
+                buf[len++] = '\n';
+            else {
+                buf[len++] = '\r';
+                buf[len++] = '\n';
+            }
+        }
+        buf[len++] = '\r';
+        buf[len++] = '\n';
+
+        xoff[0] = 1;
+        uint32_t xlen = 0;
+        for (const char *b = buf, *e; (e = memchr(b, '\n', len - xlen)); b = e+1) {
+            xlen = (uint32_t)(e - buf + 1);
+            if (e - b <= 1 && (e == b || e[-1] == '\r')) {
+                xoff[xoff[0]+1] = xlen;
+                break;
+            }
+            xoff[++xoff[0]] = xlen;
+        }
+        assert(xlen == len);
+
+        hoff[0] = 1;
+        assert(len == http_header_parse_hoff(buf, len, hoff));
+        assert(hoff[0] == xoff[0]);
+        assert(0 == memcmp(hoff+2, xoff+2, hoff[0] * sizeof(*hoff)));
+
+        /* incomplete header */
+        hoff[0] = 1;
+        assert(0 == http_header_parse_hoff(buf, len-1, hoff));
+    }
+
+    /* blank line ending headers (LF and CRLF) */
+    hoff[0] = 1;
+    assert(1 == http_header_parse_hoff(CONST_STR_LEN("\n"), hoff));
+    assert(1 == hoff[0] && 1 == hoff[2]);
+    hoff[0] = 1;
+    assert(2 == http_header_parse_hoff(CONST_STR_LEN("\r\n"), hoff));
+    assert(1 == hoff[0] && 2 == hoff[2]);
+    hoff[0] = 1;
+    assert(0 == http_header_parse_hoff(CONST_STR_LEN("a\r\r\n"), hoff));
+    assert(2 == hoff[0] && 4 == hoff[2]);
+}
+
 void test_http_header (void);
 void test_http_header (void)
 {
     test_http_header_tables();
+    test_http_header_parse_hoff();
 }
@@ -0,0 +1,143 @@
+#include "first.h"
+
+#include "ls-hpack/lshpack.c"
+
+/*(after lshpack.c, which defines NDEBUG)*/
+#undef NDEBUG
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static uint32_t test_lshpack_rand_state = 1;
+
+static uint32_t test_lshpack_rand (void) {
+    /* xorshift32; deterministic input for repeatable tests */
+    uint32_t x = test_lshpack_rand_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return (test_lshpack_rand_state = x);
+}
+
+static void run_huff_decode (const unsigned char *in, const int in_len) {
+    unsigned char enc[4096];
+    unsigned char dec[4096];
+    unsigned char full[4096];
+    const int elen = lshpack_enc_huff_encode(in, in+in_len, enc, sizeof(enc));
+    assert(elen > 0 || 0 == in_len);
+    const int dlen = lshpack_dec_huff_decode(enc, elen, dec, sizeof(dec));
+    assert(dlen == in_len);
+    assert(0 == memcmp(dec, in, (size_t)in_len));
+    assert(dlen == lshpack_dec_huff_decode_full(enc, elen, full, sizeof(full)));
+
+    /* dst too small */
+    if (in_len) {
+        assert(LSHPACK_ERR_MORE_BUF
+               == lshpack_dec_huff_decode(enc, elen, dec, in_len-1));
+        assert(LSHPACK_ERR_MORE_BUF
+               == lshpack_dec_huff_decode_full(enc, elen, full, in_len-1));
+    }
+}
+
+static void test_lshpack_huff_decode (void) {
+    unsigned char in[1024];
+
+    run_huff_decode((const unsigned char *)"", 0);
+    for (int i = 0; i < 256; ++i) {
+        in[0] = (unsigned char)i;
+        run_huff_decode(in, 1);
+        in[1] = 'a';
+        run_huff_decode(in, 2);
+        in[0] = 'a';
+        in[1] = (unsigned char)i;
+        run_huff_decode(in, 2);
+    }
+    for (int i = 0; i < 256; ++i)
+        in[i] = (unsigned char)i;
+    run_huff_decode(in, 256);
+
+    /* random strings; mix of all bytes and of likely header chars */
+    static const char hchars[] =
+      "0123456789abcdefghijklmnopqrstuvwxyz"
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZ+/=-_.;, ";
+    for (int i = 0; i < 2000; ++i) {
+        const int len = (int)(test_lshpack_rand() % sizeof(in));
+        const int any = (i & 1);
+        for (int j = 0; j < len; ++j) {
+            const uint32_t x = test_lshpack_rand();
+            in[j] = any
+              ? (unsigned char)x
+              : (unsigned char)hchars[x % (sizeof(hchars)-1)];
+        }
+        run_huff_decode(in, len);
+    }
+
+    /* invalid input */
+    unsigned char enc[8];
+    /* "a" (00011) followed by 0-bits padding (must be EOS prefix (1-bits)) */
+    enc[0] = 0x18;
+    assert(-1 == lshpack_dec_huff_decode(enc, 1, in, sizeof(in)));
+    enc[0] = 0x1f;
+    assert(1 == lshpack_dec_huff_decode(enc, 1, in, sizeof(in)));
+    assert('a' == in[0]);
+    /* padding > 7 bits */
+    enc[0] = 0x1f;
+    enc[1] = 0xff;
+    assert(-1 == lshpack_dec_huff_decode(enc, 2, in, sizeof(in)));
+    /* EOS (30 1-bits) */
+    memset(enc, 0xff, 4);
+    assert(-1 == lshpack_dec_huff_decode(enc, 4, in, sizeof(in)));
+    /* "aaaa...", then EOS */
+    enc[0] = 0x18; /* 00011000 */
+    enc[1] = 0xc6; /* 11000110 */
+    enc[2] = 0x3f; /* 00111111 */
+    memset(enc+3, 0xff, 5);
+    assert(-1 == lshpack_dec_huff_decode(enc, 8, in, sizeof(in)));
+}
+
+static void test_lshpack_huff_decode_bench (void) {
+    /* benchmark (optional); set env LIGHTTPD_TEST_BENCH=1 to run */
+    if (NULL == getenv("LIGHTTPD_TEST_BENCH")) return;
+
+    /* large cookie-like and auth-like header values */
+    static const char b64[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    unsigned char in[4000];
+    unsigned char enc[4096];
+    unsigned char dec[4096];
+    for (int i = 0; i < (int)sizeof(in); ++i)
+        in[i] = (i % 64 == 63)
+          ? ';'
+          : (i % 64 == 20)
+              ? '='
+              : (unsigned char)b64[test_lshpack_rand() % 64];
+    const int elen = lshpack_enc_huff_encode(in, in+sizeof(in),
+                                             enc, sizeof(enc));
+    assert(elen > 0);
+
+    const int iter = 20000;
+    int dlen = 0;
+    clock_t t0 = clock();
+    for (int i = 0; i < iter; ++i)
+        dlen += lshpack_dec_huff_decode_full(enc, elen, dec, sizeof(dec));
+    clock_t t1 = clock();
+    for (int i = 0; i < iter; ++i)
+        dlen -= lshpack_dec_huff_decode(enc, elen, dec, sizeof(dec));
+    clock_t t2 = clock();
+    assert(0 == dlen);
+
+    const double mb = (double)elen * iter / (1024*1024);
+    const double s1 = (double)(t1 - t0) / CLOCKS_PER_SEC;
+    const double s2 = (double)(t2 - t1) / CLOCKS_PER_SEC;
+    fprintf(stderr, "huff decode (4-bit): %.0f MB/s\n", s1 > 0 ? mb/s1 : 0);
+    fprintf(stderr, "huff decode (12-bit): %.0f MB/s\n", s2 > 0 ? mb/s2 : 0);
+}
+
+void test_lshpack (void);
+void test_lshpack (void)
+{
+    test_lshpack_huff_decode();
+    test_lshpack_huff_decode_bench();
+}
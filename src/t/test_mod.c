@@ -5,6 +5,7 @@
 
 #include "chunk.h"
 
+void test_gw_backend (void);
 void test_mod_access (void);
 void test_mod_alias (void);
 void test_mod_evhost (void);
@@ -18,6 +19,7 @@ void test_mod_userdir (void);
 int main(void) {
     chunkqueue_set_tempdirs_default(NULL, 0);
 
+    test_gw_backend();
     test_mod_access();
     test_mod_alias();
     test_mod_evhost();
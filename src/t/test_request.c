@@ -533,6 +533,37 @@ static void test_request_http_request_parse(request_st * const r)
                     "If-Modified-Since: \0\r\n"
                     "\r\n"));
 
+    run_http_request_parse(r, __LINE__, 400,
+      "invalid control char in Header value (strict)",
+      CONST_STR_LEN("GET / HTTP/1.0\r\n"
+                    "User-Agent: abcdefghijklmnopqrstuvwxyz\001abcdef\r\n"
+                    "\r\n"));
+
+    run_http_request_parse(r, __LINE__, 400,
+      "invalid DEL char in Header value (strict)",
+      CONST_STR_LEN("GET / HTTP/1.0\r\n"
+                    "User-Agent: abcdefghijklmnopqrstuvwxyz\177abcdef\r\n"
+                    "\r\n"));
+
+    run_http_request_parse(r, __LINE__, 400,
+      "invalid CR in Header value (strict)",
+      CONST_STR_LEN("GET / HTTP/1.0\r\n"
+                    "User-Agent: abcdefghijklmnopqrstuvwxyz\rabcdef\r\n"
+                    "\r\n"));
+
+    run_http_request_parse(r, __LINE__, 400,
+      "missing CR before LF and stray CR in Header values (strict)",
+      CONST_STR_LEN("GET / HTTP/1.0\r\n"
+                    "User-Agent: abcdefghijklmnopqrstuvwxyz\n"
+                    "Accept: abcdefghijklmnopqrstuvwxyz\rabcdef\r\n"
+                    "\r\n"));
+
+    run_http_request_parse(r, __LINE__, 0,
+      "HTAB and high bytes in Header value (strict)",
+      CONST_STR_LEN("GET / HTTP/1.0\r\n"
+                    "User-Agent: abcdefghijklmnop\tqrstuvwxyz\200\377\r\n"
+                    "\r\n"));
+
     run_http_request_parse(r, __LINE__, 0,
       "absolute-uri in request-line (without Host)",
       CONST_STR_LEN("GET http://zzz.example.org/ HTTP/1.1\r\n"
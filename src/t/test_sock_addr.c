@@ -0,0 +1,69 @@
+#include "first.h"
+
+#undef NDEBUG
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sock_addr.h"
+
+static void test_sock_addr_cidr_add (sock_addr_cidr * const t, const char * const str, const int family, const int bits) {
+    sock_addr addr;
+    assert(1 == sock_addr_inet_pton(&addr, str, family, 0));
+    assert(0 == sock_addr_cidr_insert(t, &addr, bits));
+}
+
+static int test_sock_addr_cidr_check (const sock_addr_cidr * const t, const char * const str, const int family) {
+    sock_addr addr;
+    assert(1 == sock_addr_inet_pton(&addr, str, family, 0));
+    return sock_addr_cidr_match(t, &addr);
+}
+
+static void test_sock_addr_cidr (void) {
+    sock_addr_cidr t;
+    memset(&t, 0, sizeof(t));
+
+    /* empty set */
+    assert(!test_sock_addr_cidr_check(&t, "10.0.0.1", AF_INET));
+
+    test_sock_addr_cidr_add(&t, "10.0.0.0", AF_INET, 8);
+    test_sock_addr_cidr_add(&t, "192.168.1.0", AF_INET, 24);
+    test_sock_addr_cidr_add(&t, "172.16.0.1", AF_INET, 32);
+    assert(test_sock_addr_cidr_check(&t, "10.0.0.1", AF_INET));
+    assert(test_sock_addr_cidr_check(&t, "10.255.255.255", AF_INET));
+    assert(!test_sock_addr_cidr_check(&t, "11.0.0.1", AF_INET));
+    assert(test_sock_addr_cidr_check(&t, "192.168.1.77", AF_INET));
+    assert(!test_sock_addr_cidr_check(&t, "192.168.2.77", AF_INET));
+    assert(test_sock_addr_cidr_check(&t, "172.16.0.1", AF_INET));
+    assert(!test_sock_addr_cidr_check(&t, "172.16.0.2", AF_INET));
+
+    /* longer mask inside shorter mask; shorter mask replaces longer mask */
+    test_sock_addr_cidr_add(&t, "10.1.2.0", AF_INET, 24);
+    assert(test_sock_addr_cidr_check(&t, "10.9.9.9", AF_INET));
+    test_sock_addr_cidr_add(&t, "192.168.0.0", AF_INET, 16);
+    assert(test_sock_addr_cidr_check(&t, "192.168.2.77", AF_INET));
+
+  #ifdef HAVE_IPV6
+    /* IPv4-mapped IPv6 addresses match IPv4 masks */
+    assert(test_sock_addr_cidr_check(&t, "::ffff:10.0.0.1", AF_INET6));
+    assert(!test_sock_addr_cidr_check(&t, "::ffff:11.0.0.1", AF_INET6));
+    assert(!test_sock_addr_cidr_check(&t, "2001:db8::1", AF_INET6));
+
+    test_sock_addr_cidr_add(&t, "2001:db8::", AF_INET6, 32);
+    test_sock_addr_cidr_add(&t, "::ffff:203.0.113.0", AF_INET6, 120);
+    assert(test_sock_addr_cidr_check(&t, "2001:db8:1:2::3", AF_INET6));
+    assert(!test_sock_addr_cidr_check(&t, "2001:db9::1", AF_INET6));
+    assert(test_sock_addr_cidr_check(&t, "203.0.113.9", AF_INET));
+    assert(test_sock_addr_cidr_check(&t, "::ffff:203.0.113.9", AF_INET6));
+    assert(!test_sock_addr_cidr_check(&t, "203.0.114.9", AF_INET));
+  #endif
+
+    sock_addr_cidr_free(&t);
+    assert(!test_sock_addr_cidr_check(&t, "10.0.0.1", AF_INET));
+}
+
+void test_sock_addr (void);
+void test_sock_addr (void)
+{
+    test_sock_addr_cidr();
+}
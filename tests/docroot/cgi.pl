@@ -1,7 +1,8 @@
 #!/usr/bin/env perl
 
-# env
-if ($ENV{"QUERY_STRING"} =~ /^env=(\w+)/) {
+# env (optionally delayed, e.g. for concurrent requests)
+if ($ENV{"QUERY_STRING"} =~ /^env=(\w+)(?:&delay=(\d+))?/) {
+    select(undef, undef, undef, $2/1000) if ($2);
     my $v = defined($ENV{$1}) ? $ENV{$1} : "[$1 not found]";
     print "Status: 200\r\n\r\n$v";
     exit 0;
@@ -75,6 +76,16 @@ if ($ENV{"QUERY_STRING"} eq "post-len") {
     exit 0;
 }
 
+# POST echo
+if ($ENV{"QUERY_STRING"} eq "post-echo") {
+    binmode STDIN;
+    binmode STDOUT;
+    local $/;
+    my $body = $ENV{"REQUEST_METHOD"} eq "POST" ? <STDIN> : "";
+    print "Status: 200\r\n\r\n$body";
+    exit 0;
+}
+
 # default
 print "Content-Type: text/plain\r\n\r\n";
 print $ENV{"QUERY_STRING"};
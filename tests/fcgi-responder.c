@@ -65,6 +65,9 @@ typedef uintptr_t FILE;
 #include "../src/compat/fastcgi.h"
 
 static int finished;
+static int keep_conn; /* FCGI_KEEP_CONN flag from FCGI_BEGIN_REQUEST */
+static int req_done;
+static unsigned int req_count; /* requests received by this process */
 static unsigned char buf[65536];
 
 
@@ -188,11 +191,73 @@ fcgi_getenv(const unsigned char * const r, const uint32_t rlen, const char * con
 }
 
 
+static void
+fcgi_sleep_ms (int ms)
+{
+  #ifdef _WIN32
+    Sleep(ms);
+  #else
+    poll(NULL, 0, ms);
+  #endif
+}
+
+
+static int
+fcgi_write_split (const void * const ptr, size_t len, int split, FILE * const stream)
+{
+    /* (split: flush first half and pause, so that data is received in
+     *  separate reads, e.g. to test records split across reads) */
+    const size_t n = split ? len / 2 : 0;
+    if (n) {
+        if (n != fwrite(ptr, 1, n, stream))
+            return -1;
+        fflush(stream);
+        fcgi_sleep_ms(20);
+    }
+    return (len - n == fwrite((const char *)ptr+n, 1, len - n, stream))
+      ? 0
+      : -1;
+}
+
+
+static int
+fcgi_puts_padded (const int req_id, const char * const str, size_t len, unsigned char padding, int split, FILE * const stream)
+{
+    /* single FCGI_STDOUT record with padding
+     * (split: header, content, and padding each split across reads) */
+    static const char pad[255];
+    FCGI_Header header;
+    fcgi_header(&header, FCGI_STDOUT, req_id, (int)len, padding);
+    return (0 == fcgi_write_split(&header, sizeof(header), split, stream)
+            && 0 == fcgi_write_split(str, len, split, stream)
+            && 0 == fcgi_write_split(pad, padding, split, stream))
+      ? 0
+      : -1;
+}
+
+
+static int
+fcgi_count (char * const s, unsigned int n)
+{
+    /* decimal string of n (for counting requests sent to backend) */
+    char t[16];
+    int i = 0, len = 0;
+    do { t[i++] = (char)('0' + n % 10); } while ((n /= 10));
+    while (i) s[len++] = t[--i];
+    return len;
+}
+
+
 static int
 fcgi_process_params (FILE * const stream, int req_id, int role, unsigned char * const r, uint32_t rlen)
 {
     const char *p = NULL;
     int len;
+    int large = 0;
+    int delay_end = 0;
+    char cnum[16];
+
+    ++req_count;
 
     /* (FCGI_STDIN currently ignored in these FastCGI unit test responses, so
      *  generate response here based on query string values (indicating test) */
@@ -218,10 +283,100 @@ fcgi_process_params (FILE * const stream, int req_id, int role, unsigned char *
             fflush(stdout);
             cdata = "\r\n";
         }
+        else if (12 == len && 0 == memcmp(p, "split-stdout", 12)) {
+            /* FCGI_STDOUT records with padding; each split across reads */
+            cdata = "Status: 200 OK\r\n\r\n";
+            if (0 != fcgi_puts_padded(req_id, cdata, strlen(cdata), 5, 1, stream)
+                || 0 != fcgi_puts_padded(req_id, "split-", 6, 3, 1, stream)
+                || 0 != fcgi_puts_padded(req_id, "stdout-", 7, 0, 1, stream)
+                || 0 != fcgi_puts_padded(req_id, "response", 8, 7, 1, stream))
+                return -1;
+            cdata = NULL;
+            p = NULL;
+        }
+        else if (12 == len && 0 == memcmp(p, "multi-stdout", 12)) {
+            /* many small FCGI_STDOUT records with padding (in single write)
+             * response body is "0123456789" repeated 10 times */
+            cdata = "Status: 200 OK\r\n\r\n";
+            if (0 != fcgi_puts(req_id, cdata, strlen(cdata), stream))
+                return -1;
+            for (int i = 0; i < 100; ++i) {
+                if (0 != fcgi_puts_padded(req_id, "0123456789"+i%10, 1,
+                                          (unsigned char)(i % 8), 0, stream))
+                    return -1;
+            }
+            cdata = NULL;
+            p = NULL;
+        }
         else if (10 == len && 0 == memcmp(p, "die-at-end", 10)) {
             cdata = "Status: 200 OK\r\n\r\n";
             finished = 1;
         }
+        else if (len >= 5 && 0 == memcmp(p, "count", 5)) {
+            /* response body is number of requests received by this process
+             * (no Content-Length; response ends with FCGI_END_REQUEST)
+             * count-slow: delay 500ms; count-slower: delay 4s
+             * count-slow-private: delay 500ms; Cache-Control: private
+             * count-stream: send response body, then delay 500ms before end */
+            if (10 == len && 0 == memcmp(p, "count-slow", 10))
+                fcgi_sleep_ms(500);
+            else if (12 == len && 0 == memcmp(p, "count-slower", 12))
+                fcgi_sleep_ms(4000);
+            else if (12 == len && 0 == memcmp(p, "count-stream", 12))
+                delay_end = 1;
+            else if (18 == len && 0 == memcmp(p, "count-slow-private", 18))
+                fcgi_sleep_ms(500);
+            cdata = (18 == len)
+              ? "Status: 200 OK\r\nCache-Control: private\r\n\r\n"
+              : "Status: 200 OK\r\n\r\n";
+            len = fcgi_count(cnum, req_count);
+            p = cnum;
+        }
+        else if (len >= 3 && 0 == memcmp(p, "pid", 3)) {
+            /* response body is process id (identifies backend proc)
+             * pid-slow: delay 500ms */
+            if (8 == len && 0 == memcmp(p, "pid-slow", 8))
+                fcgi_sleep_ms(500);
+            cdata = "Status: 200 OK\r\n\r\n";
+          #ifdef _WIN32
+            len = fcgi_count(cnum, (unsigned int)GetCurrentProcessId());
+          #else
+            len = fcgi_count(cnum, (unsigned int)getpid());
+          #endif
+            p = cnum;
+        }
+        else if (len >= 6 && 0 == memcmp(p, "cache-", 6)) {
+            /* cacheable responses; response body is request count
+             * cache-fresh: max-age=60
+             * cache-expire: max-age=1
+             * cache-vary: max-age=60 and Vary: X-Test
+             * cache-etag: max-age=0 and ETag (304 if If-None-Match matches)
+             * cache-etag-200: max-age=0 and ETag (never 304)
+             * cache-large: max-age=60 and 4k response body */
+            if (14 == len && 0 == memcmp(p, "cache-etag-200", 14))
+                cdata = "Status: 200 OK\r\n"
+                        "Cache-Control: max-age=0\r\nETag: \"abc\"\r\n\r\n";
+            else if (10 == len && 0 == memcmp(p, "cache-etag", 10)) {
+                int n;
+                const char * const inm =
+                  fcgi_getenv(r, rlen, "HTTP_IF_NONE_MATCH", 18, &n);
+                cdata = (NULL != inm && 5 == n && 0 == memcmp(inm, "\"abc\"", 5))
+                  ? "Status: 304 Not Modified\r\n"
+                    "Cache-Control: max-age=0\r\nETag: \"abc\"\r\n\r\n"
+                  : "Status: 200 OK\r\n"
+                    "Cache-Control: max-age=0\r\nETag: \"abc\"\r\n\r\n";
+            }
+            else if (12 == len && 0 == memcmp(p, "cache-expire", 12))
+                cdata = "Status: 200 OK\r\nCache-Control: max-age=1\r\n\r\n";
+            else if (10 == len && 0 == memcmp(p, "cache-vary", 10))
+                cdata = "Status: 200 OK\r\nCache-Control: max-age=60\r\n"
+                        "Vary: X-Test\r\n\r\n";
+            else
+                cdata = "Status: 200 OK\r\nCache-Control: max-age=60\r\n\r\n";
+            large = (11 == len && 0 == memcmp(p, "cache-large", 11));
+            len = fcgi_count(cnum, req_count);
+            p = (cdata[8] == '3') ? NULL : cnum; /*(no body if 304)*/
+        }
         else if (role == FCGI_AUTHORIZER
                  && len >= 5 && 0 == memcmp(p, "auth-", 5)) {
             if (7 == len && 0 == memcmp(p, "auth-ok", 7))
@@ -251,6 +406,8 @@ fcgi_process_params (FILE * const stream, int req_id, int role, unsigned char *
 
     if (NULL == p)
         cdata = NULL;
+    else if (p == cnum)
+        cdata = cnum;
     else if (len > 4 && 0 == memcmp(p, "env=", 4))
         cdata = fcgi_getenv(r, rlen, p+4, len-4, &len);
     else if (8 == len && 0 == memcmp(p, "auth-var", 8))
@@ -263,6 +420,18 @@ fcgi_process_params (FILE * const stream, int req_id, int role, unsigned char *
     if (cdata && 0 != fcgi_puts(req_id, cdata, (size_t)len, stream))
         return -1;
 
+    if (large) {
+        static char pad[4096];
+        memset(pad, 'x', sizeof(pad));
+        if (0 != fcgi_puts(req_id, pad, sizeof(pad), stream))
+            return -1;
+    }
+
+    if (delay_end) {
+        fflush(stream);
+        fcgi_sleep_ms(500);
+    }
+
     /*(XXX: always sending appStatus 0)*/
     FCGI_EndRequestRecord endrec;
     fcgi_end_request_rec(&endrec, req_id, 0, FCGI_REQUEST_COMPLETE);
@@ -306,15 +475,21 @@ fcgi_dispatch_packet (FILE *stream, ssize_t offset, uint32_t len)
       case FCGI_BEGIN_REQUEST:
         role = (buf[offset+FCGI_HEADER_LEN] << 8)
              |  buf[offset+FCGI_HEADER_LEN+1];
+        keep_conn = buf[offset+FCGI_HEADER_LEN+2] & FCGI_KEEP_CONN;
+        req_done = 0;
         return 0;  /* ignore; could save req_id and match further packets */
       case FCGI_ABORT_REQUEST:
         return -2; /* done */
       case FCGI_END_REQUEST:
         return -1; /* unexpected; this server is not sending FastCGI requests */
       case FCGI_PARAMS:
+        if (req_done)
+            return 0; /* ignore end of FCGI_PARAMS after response sent */
         return fcgi_process_params(stream, req_id, role,
                                    buf+offset+FCGI_HEADER_LEN, len);
       case FCGI_STDIN:
+        if (req_done)
+            return 0; /* ignore end of FCGI_STDIN after response sent */
         /* XXX: TODO read and discard request body
          * (currently ignored in these FastCGI unit tests)
          * (make basic effort to read body; ignore any timeouts or errors) */
@@ -346,8 +521,13 @@ fcgi_recv_packet (FILE * const stream, ssize_t sz)
         if (sz - offset < (ssize_t)(FCGI_HEADER_LEN + len + pad))
             break;
         int rc = fcgi_dispatch_packet(stream, offset, len);
-        if (rc < 0)
-            return rc;
+        if (rc < 0) {
+            if (-2 != rc || !keep_conn || finished)
+                return rc;
+            /* FCGI_KEEP_CONN; send response and wait for next request */
+            req_done = 1;
+            fflush(stream);
+        }
         offset += (ssize_t)(FCGI_HEADER_LEN + len + pad);
     }
     return offset;
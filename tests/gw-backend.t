@@ -0,0 +1,176 @@
+#!/usr/bin/env perl
+BEGIN {
+	# add current source dir to the include-path
+	# we need this for make distcheck
+	(my $srcdir = $0) =~ s,/[^/]+$,/,;
+	unshift @INC, $srcdir;
+}
+
+use strict;
+use IO::Socket ();
+use Time::HiRes qw(time);
+use Test::More tests => 21;
+use LightyTest;
+
+my $tf = LightyTest->new();
+
+# send concurrent requests (first request sent $delay secs before the rest)
+sub concurrent_send {
+	my ($delay, @urls) = @_;
+	my @socks;
+	foreach my $url (@urls) {
+		my $sock = IO::Socket::INET->new(
+			PeerAddr => '127.0.0.1',
+			PeerPort => $tf->{PORT},
+			Proto    => 'tcp') or die("connect: $!");
+		print $sock "GET $url HTTP/1.0\r\nHost: www.example.org\r\n\r\n";
+		push(@socks, $sock);
+		select(undef, undef, undef, $delay) if ($delay && 1 == @socks);
+	}
+	return @socks;
+}
+
+# receive responses and return response bodies (undef if not 200 OK)
+sub concurrent_recv {
+	my @bodies;
+	foreach my $sock (@_) {
+		local $/;
+		my $resp = <$sock>;
+		close($sock);
+		my ($head, $body) = split(/\r\n\r\n/, $resp, 2);
+		push(@bodies, $head =~ m{^HTTP/1\.\d 200 } ? $body : undef);
+	}
+	return @bodies;
+}
+
+sub concurrent_get {
+	return concurrent_recv(concurrent_send(@_));
+}
+
+# get counter from mod_status statistics (0 if not present)
+sub statistic {
+	my ($key) = @_;
+	my ($stats) = concurrent_get(0, '/server-statistics');
+	return (defined($stats) && $stats =~ m{^\Q$key\E: (\d+)$}m) ? $1 : 0;
+}
+
+# wait (up to 10s) for counter from mod_status statistics to reach value
+sub wait_statistic {
+	my ($key, $value) = @_;
+	for (my $i = 0; $i < 40; ++$i) {
+		return 1 if (statistic($key) == $value);
+		select(undef, undef, undef, 0.25);
+	}
+	return 0;
+}
+
+SKIP: {
+	skip "no fcgi-responder found", 21
+	  unless (   -x $tf->{BASEDIR}."/tests/fcgi-responder"
+		  || -x $tf->{BASEDIR}."/tests/fcgi-responder.exe");
+
+	my $ephemeral_port = LightyTest->get_ephemeral_tcp_port();
+	$ENV{EPHEMERAL_PORT} = $ephemeral_port;
+
+	$tf->{CONFIGFILE} = 'gw-backend.conf';
+	ok($tf->start_proc == 0, "Starting lighttpd with $tf->{CONFIGFILE}") or die();
+
+	my @r;
+	my $n;
+
+	# collapse forwarding: response without Content-Length (read to end)
+	# sent once to backend, and copied to waiting requests
+	@r = concurrent_get(0.2, ('/collapse/a?count-slow') x 3);
+	($n) = concurrent_get(0, '/collapse/?count');
+	ok(defined($r[0]) && $r[0] eq $r[1] && $r[0] eq $r[2] && $n == $r[0]+1,
+	   'collapse forwarding: single backend request');
+
+	# collapse forwarding: not collapsed with different request target
+	@r = concurrent_get(0.2, '/collapse/a?count-slow', '/collapse/b?count-slow');
+	ok(defined($r[0]) && defined($r[1]) && $r[1] == $r[0]+1,
+	   'collapse forwarding: different request target');
+
+	# collapse forwarding: max waiters ("collapse-forwarding" => 2)
+	# (order in which concurrent requests are received is not defined)
+	@r = concurrent_get(0.2, ('/collapse/a?count-slow') x 4);
+	ok(defined($r[0]) && 2 == grep({ defined($_) && $_ eq $r[0] } @r[1..3]),
+	   'collapse forwarding: waiters sent leader response');
+	ok(defined($r[0]) && 1 == grep({ defined($_) && $_ == $r[0]+1 } @r[1..3]),
+	   'collapse forwarding: request beyond max waiters sent to backend');
+
+	# collapse forwarding: response not reusable; waiters sent to backend
+	@r = concurrent_get(0.2, ('/collapse/a?count-slow-private') x 3);
+	ok(defined($r[0]) && defined($r[1]) && defined($r[2])
+	   && $r[0] != $r[1] && $r[0] != $r[2] && $r[1] != $r[2],
+	   'collapse forwarding: non-reusable response releases waiters');
+	($n) = concurrent_get(0, '/collapse/?count');
+	ok($n == $r[0]+3, 'collapse forwarding: non-reusable response; 3 backend requests');
+
+	# collapse forwarding: waiters released after "collapse-timeout"
+	# (leader response delayed 4s; waiters released after 1-3s)
+	@r = concurrent_get(0.2, ('/collapse/a?count-slower') x 2);
+	ok(defined($r[0]) && defined($r[1]) && $r[1] == $r[0]+1,
+	   'collapse forwarding: waiter released after collapse-timeout');
+
+	# collapse forwarding with server.stream-response-body = 1:
+	# response streamed to client if no other request waits on it
+	# (backend sends response body, then delays 1s before end of response)
+	my ($sock) = concurrent_send(0, '/collapse/stream/a?count-stream');
+	my $ts = time();
+	my $resp = '';
+	1 while ($resp !~ m{\r\n\r\n\d} && sysread($sock, $resp, 1024, length($resp)));
+	my $elapsed = time() - $ts;
+	close($sock);
+	ok($resp =~ m{\r\n\r\n\d} && $elapsed < 0.5,
+	   'collapse forwarding: leader response streamed if no waiters');
+
+	# waiter joins before leader response started; response collected
+	@r = concurrent_get(0.2, ('/collapse/stream/a?count-slow') x 2);
+	ok(defined($r[0]) && defined($r[1]) && $r[0] eq $r[1],
+	   'collapse forwarding: streaming leader collapsed before response');
+
+	# not collapsed after leader response started streaming to client
+	@r = concurrent_get(0.2, ('/collapse/stream/a?count-stream') x 2);
+	ok(defined($r[0]) && defined($r[1]) && $r[1] == $r[0]+1,
+	   'collapse forwarding: streaming response not collapsed once started');
+
+	# adaptive spawning ("min-procs" => 1, "max-procs" => 3):
+	# procs spawned while backend saturated, and terminated after idle
+	# (procs spawned and terminated from once-per-second trigger)
+	my @socks = concurrent_send(0, ('/spawn/?count-slow') x 8);
+	ok(wait_statistic('gw.backend.spawn.procs', 3),
+	   'procs spawned when backend saturated');
+	concurrent_recv(@socks);
+	ok(wait_statistic('gw.backend.spawn.procs', 1),
+	   'idle procs terminated after idle-timeout');
+
+	# request queue ("max-load-per-proc" => 1, "queue-max" => 2):
+	# requests wait for proc; request beyond queue-max sent 503
+	@r = concurrent_get(0.2, ('/queue/?count-slow') x 4);
+	ok(defined($r[0]) && 1 == grep({ !defined($_) } @r[1..3]),
+	   'request queue: request beyond queue-max rejected');
+	ok(2 == grep({ defined($_) && $_ > $r[0] } @r[1..3]),
+	   'request queue: queued requests sent to backend');
+	ok(2 == statistic('gw.backend.queue.queue.wait.count'),
+	   'request queue: dispatched waits recorded');
+	ok(1 == statistic('gw.backend.queue.queue.rejected'),
+	   'request queue: rejected request counted');
+
+	# request queue: queued request sent 503 after "queue-timeout" => 2
+	# (leader response delayed 4s)
+	@r = concurrent_get(0.2, ('/queue/?count-slower') x 2);
+	ok(defined($r[0]) && !defined($r[1]), 'request queue: queue-timeout');
+	ok(1 == statistic('gw.backend.queue.queue.timeout')
+	   && 2 == statistic('gw.backend.queue.queue.wait.count'),
+	   'request queue: timeout counted, not recorded as dispatched wait');
+
+	# request queue without "max-load-per-proc": requests not held in queue
+	# (second request would time out after 1-2s if serialized in queue)
+	@r = concurrent_get(0.2, '/queue-nolimit/?count-slower', '/queue-nolimit/?count-slow');
+	ok(defined($r[0]) && defined($r[1])
+	   && 0 == statistic('gw.backend.nolimit.queue.wait.count')
+	   && 0 == statistic('gw.backend.nolimit.queue.timeout'),
+	   'request queue: no per-proc limit unless max-load-per-proc configured');
+
+	ok($tf->stop_proc == 0, "Stopping lighttpd");
+}
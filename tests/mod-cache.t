@@ -0,0 +1,151 @@
+#!/usr/bin/env perl
+BEGIN {
+	# add current source dir to the include-path
+	# we need this for make distcheck
+	(my $srcdir = $0) =~ s,/[^/]+$,/,;
+	unshift @INC, $srcdir;
+}
+
+use strict;
+use Test::More tests => 21;
+use LightyTest;
+
+my $tf = LightyTest->new();
+
+my $t;
+
+SKIP: {
+	skip "no fcgi-responder found", 21
+	  unless (   -x $tf->{BASEDIR}."/tests/fcgi-responder"
+		  || -x $tf->{BASEDIR}."/tests/fcgi-responder.exe");
+
+	my $ephemeral_port = LightyTest->get_ephemeral_tcp_port();
+	$ENV{EPHEMERAL_PORT} = $ephemeral_port;
+
+	# stale cache file from previous server instance
+	my $cachedir = $tf->{TESTDIR}."/tmp/lighttpd/cache";
+	open(my $fh, '>', "$cachedir/c-0-0-0") or die("open: $!");
+	close($fh);
+	# file not created by mod_cache
+	open($fh, '>', "$cachedir/c-notes") or die("open: $!");
+	close($fh);
+
+	$tf->{CONFIGFILE} = 'cache.conf';
+	ok($tf->start_proc == 0, "Starting lighttpd with $tf->{CONFIGFILE}") or die();
+
+	ok(!-e "$cachedir/c-0-0-0", 'stale cache file removed at startup');
+	ok(-e "$cachedir/c-notes", 'other file not removed at startup');
+	unlink("$cachedir/c-notes");
+
+	# (response body from fcgi-responder is count of backend requests)
+
+	$t->{REQUEST}  = ( <<EOF
+GET /cache.fcgi?cache-fresh HTTP/1.0
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '1', '-Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache miss');
+
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '1', '+Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache hit');
+
+	$t->{REQUEST}  = ( <<EOF
+GET /cache.fcgi?cache-vary HTTP/1.0
+X-Test: a
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '2', '-Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache miss (Vary)');
+
+	$t->{REQUEST}  = ( <<EOF
+GET /cache.fcgi?cache-vary HTTP/1.0
+X-Test: b
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '3', '-Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache miss (Vary; different request header)');
+
+	$t->{REQUEST}  = ( <<EOF
+GET /cache.fcgi?cache-vary HTTP/1.0
+X-Test: a
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '2', '+Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache hit (Vary)');
+
+	$t->{REQUEST}  = ( <<EOF
+GET /cache.fcgi?cache-expire HTTP/1.0
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '4', '-Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache miss (max-age=1)');
+
+	sleep(2);
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '5', '-Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache miss (expired)');
+
+	$t->{REQUEST}  = ( <<EOF
+GET /cache.fcgi?cache-etag HTTP/1.0
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '6', '-Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache miss (max-age=0, ETag)');
+
+	# stale; revalidated with backend (304 Not Modified), sent from cache
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '6', '+Age' => '', 'ETag' => '"abc"' } ];
+	ok($tf->handle_http($t) == 0, 'cache hit (revalidated)');
+
+	$t->{REQUEST}  = ( <<EOF
+GET /cache.fcgi?count HTTP/1.0
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '8' } ];
+	ok($tf->handle_http($t) == 0, 'revalidation request sent to backend');
+
+	$t->{REQUEST}  = ( <<EOF
+GET /cache.fcgi?cache-etag-200 HTTP/1.0
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '9', '-Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache miss (max-age=0, ETag; never 304)');
+
+	# stale; revalidated with backend (200 OK), sent from backend
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '10', '-Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache miss (revalidated; replaced)');
+
+	# larger than cache.max-memory-entry-size; stored on disk
+	$t->{REQUEST}  = ( <<EOF
+GET /cache.fcgi?cache-large HTTP/1.0
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '11'.('x' x 4096), '-Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache miss (disk)');
+
+	opendir(my $dh, $cachedir) or die("opendir: $!");
+	my @files = grep { /^c-/ } readdir($dh);
+	closedir($dh);
+	ok(1 == scalar(@files), 'cache file stored on disk');
+
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '11'.('x' x 4096), '+Age' => '' } ];
+	ok($tf->handle_http($t) == 0, 'cache hit (disk)');
+
+	# static file responses are not stored
+	$t->{REQUEST}  = ( <<EOF
+GET /index.html HTTP/1.0
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, '-Age' => '' } ];
+	$tf->handle_http($t);
+	ok($tf->handle_http($t) == 0, 'static file not stored');
+
+	ok($tf->stop_proc == 0, "Stopping lighttpd");
+
+	# conditional request headers added by mod_cache for revalidation
+	# are not visible after backend response (e.g. in access log)
+	my $log = $tf->{TESTDIR}."/tmp/lighttpd/logs/cache.access.log";
+	open($fh, '<', $log) or die("open: $!");
+	my @lines = grep { /cache-etag-200/ } <$fh>;
+	close($fh);
+	ok(2 == scalar(@lines) && 2 == scalar(grep { / -$/ } @lines),
+	   'revalidation request headers removed');
+}
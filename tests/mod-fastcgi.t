@@ -7,7 +7,7 @@ BEGIN {
 }
 
 use strict;
-use Test::More tests => 24;
+use Test::More tests => 27;
 use LightyTest;
 
 my $tf = LightyTest->new();
@@ -15,7 +15,7 @@ my $tf = LightyTest->new();
 my $t;
 
 SKIP: {
-	skip "no fcgi-responder found", 24
+	skip "no fcgi-responder found", 27
 	  unless (   -x $tf->{BASEDIR}."/tests/fcgi-responder"
 		  || -x $tf->{BASEDIR}."/tests/fcgi-responder.exe");
 
@@ -62,6 +62,14 @@ EOF
 	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200 } ];
 	ok($tf->handle_http($t) == 0, 'valid request');
 
+	$t->{REQUEST} = ( <<EOF
+GET /phpinfo.php HTTP/1.0
+Host: www.example.org
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200 } ];
+	ok($tf->handle_http($t) == 0, 'valid request (FCGI_KEEP_CONN)');
+
 	$t->{REQUEST}  = ( <<EOF
 GET /get-server-env.php?env=USER HTTP/1.0
 Host: bin-env.example.org
@@ -172,6 +180,22 @@ EOF
 	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => 'test123' } ];
 	ok($tf->handle_http($t) == 0, 'line-ending \r\n + \r\n');
 
+	$t->{REQUEST}  = ( <<EOF
+GET /index.fcgi?split-stdout HTTP/1.0
+Host: www.example.org
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => 'split-stdout-response' } ];
+	ok($tf->handle_http($t) == 0, 'FCGI_STDOUT records and padding split across reads');
+
+	$t->{REQUEST}  = ( <<EOF
+GET /index.fcgi?multi-stdout HTTP/1.0
+Host: www.example.org
+EOF
+ );
+	$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => '0123456789' x 10 } ];
+	ok($tf->handle_http($t) == 0, 'many FCGI_STDOUT records with padding in single read');
+
 	$t->{REQUEST}  = ( <<EOF
 GET /abc/def/ghi?env=PATH_INFO HTTP/1.0
 Host: wsgi.example.org
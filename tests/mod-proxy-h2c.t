@@ -0,0 +1,249 @@
+#!/usr/bin/env perl
+BEGIN {
+	# add current source dir to the include-path
+	# we need this for make distcheck
+	(my $srcdir = $0) =~ s,/[^/]+$,/,;
+	unshift @INC, $srcdir;
+}
+
+use strict;
+use IO::Socket ();
+use Time::HiRes qw(time);
+use Test::More tests => 21;
+use LightyTest;
+
+my $tf = LightyTest->new();
+my $tf_proxy = LightyTest->new();
+
+# send requests concurrently; return response bodies (undef if not 200 OK)
+sub concurrent_get {
+	my @socks;
+	foreach my $req (@_) {
+		my $sock = IO::Socket::INET->new(
+			PeerAddr => '127.0.0.1',
+			PeerPort => $tf_proxy->{PORT},
+			Proto    => 'tcp') or die("connect: $!");
+		print $sock $req;
+		push(@socks, $sock);
+	}
+	my @bodies;
+	foreach my $sock (@socks) {
+		local $/;
+		my $resp = <$sock>;
+		close($sock);
+		my ($head, $body) = split(/\r\n\r\n/, $resp, 2);
+		push(@bodies, $head =~ m{^HTTP/1\.\d 200 } ? $body : undef);
+	}
+	return @bodies;
+}
+
+my $t;
+
+$tf->{CONFIGFILE} = 'h2c-backend.conf';
+ok($tf->start_proc == 0, "Starting lighttpd as h2c backend") or die();
+
+$ENV{EPHEMERAL_PORT} = $tf->{PORT};
+$tf_proxy->{CONFIGFILE} = 'proxy-h2c.conf';
+ok($tf_proxy->start_proc == 0, "Starting lighttpd as proxy") or die();
+
+# framing: request sent to backend as HTTP/2 stream
+$t->{REQUEST}  = ( <<EOF
+GET /cgi.pl?env=SERVER_PROTOCOL HTTP/1.0
+Host: www.example.org
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => 'HTTP/2.0', 'X-Backend' => 'h2c' } ];
+ok($tf_proxy->handle_http($t) == 0, 'request sent to backend over HTTP/2');
+
+# HPACK: request and response headers encoded and decoded; repeated on same
+# connection so that fields are sent as references to dynamic table entries
+$t->{REQUEST}  = ( <<EOF
+GET /cgi.pl?env=HTTP_X_TEST HTTP/1.0
+Host: www.example.org
+X-Test: hpack-value
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => 'hpack-value', 'X-Backend' => 'h2c' } ];
+ok($tf_proxy->handle_http($t) == 0, 'HPACK request header');
+ok($tf_proxy->handle_http($t) == 0, 'HPACK request header (dynamic table)');
+
+# HPACK: header block larger than SETTINGS_MAX_FRAME_SIZE (16384) is sent in
+# HEADERS and CONTINUATION frames
+my $large = 'x' x 30000;
+$t->{REQUEST}  = ( <<EOF
+GET /cgi.pl?env=HTTP_X_TEST HTTP/1.0
+Host: www.example.org
+X-Test: $large
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => $large } ];
+ok($tf_proxy->handle_http($t) == 0, 'HEADERS with CONTINUATION');
+
+# framing and flow control: response body larger than max frame size and
+# larger than stream recv window (WINDOW_UPDATE sent to backend)
+my $docroot = $tf->{TESTDIR}."/tmp/lighttpd/servers/www.example.org/pages";
+my $content = join('', map { sprintf("%07d\n", $_) } (0 .. 131071)); # 1 MB
+open(my $fh, '>', "$docroot/h2c-large.txt") or die("open: $!");
+print $fh $content;
+close($fh);
+$t->{REQUEST}  = ( <<EOF
+GET /h2c-large.txt HTTP/1.0
+Host: www.example.org
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 200, 'HTTP-Content' => $content } ];
+ok($tf_proxy->handle_http($t) == 0, 'flow control: response body larger than recv window');
+unlink("$docroot/h2c-large.txt");
+
+# flow control: request body larger than backend initial window (65535)
+my ($n) = concurrent_get("POST /cgi.pl?post-len HTTP/1.0\r\n"
+                        ."Host: www.example.org\r\n"
+                        ."Content-Length: ".length($content)."\r\n"
+                        ."\r\n".$content);
+ok(defined($n) && $n == length($content),
+   'flow control: request body larger than send window');
+
+# multiplexing: concurrent requests sent as streams on one connection
+# (responses delayed 1s; would take at least 4s if not concurrent)
+my $req = "GET /cgi.pl?env=REMOTE_PORT&delay=1000 HTTP/1.0\r\n"
+         ."Host: www.example.org\r\n\r\n";
+my $ts = time();
+my @r = concurrent_get(($req) x 4);
+ok(4 == grep({ defined($_) && $_ > 0 && $_ == $r[0] } @r)
+   && time() - $ts < 3,
+   'multiplexing: concurrent streams on one connection');
+my $remote_port = $r[0];
+
+# multiplexing: responses to concurrent requests not mixed
+@r = concurrent_get(map {
+         "GET /cgi.pl?env=HTTP_X_TEST&delay=".(400-$_*100)." HTTP/1.0\r\n"
+        ."Host: www.example.org\r\nX-Test: stream-$_\r\n\r\n" } (0 .. 3));
+ok(4 == grep({ defined($r[$_]) && $r[$_] eq "stream-$_" } (0 .. 3)),
+   'multiplexing: responses sent to corresponding requests');
+
+# idle connection reused for subsequent request
+my ($port) = concurrent_get("GET /cgi.pl?env=REMOTE_PORT HTTP/1.0\r\n"
+                           ."Host: www.example.org\r\n\r\n");
+ok(defined($port) && defined($remote_port) && $port == $remote_port,
+   'idle connection reused');
+
+ok($tf_proxy->stop_proc == 0, "Stopping lighttpd proxy");
+ok($tf->stop_proc == 0, "Stopping lighttpd h2c backend");
+
+# frame validation: responses from a scripted backend with invalid frames
+# (backend sends GOAWAY after SETTINGS so that each connection is used for
+#  a single stream, then reports the RST_STREAM or GOAWAY error code sent by
+#  lighttpd in response to the invalid frame)
+sub h2_frame {
+	my ($type, $flags, $id, $payload) = @_;
+	my $len = length($payload);
+	return pack('CnCCN', $len >> 16, $len & 0xffff, $type, $flags, $id)
+	      .$payload;
+}
+
+sub h2_read {
+	my ($sock, $n) = @_;
+	my $buf = '';
+	while (length($buf) < $n) {
+		return undef unless sysread($sock, $buf, $n - length($buf), length($buf));
+	}
+	return $buf;
+}
+
+sub h2_read_frame {
+	my ($sock) = @_;
+	my $hdr = h2_read($sock, 9);
+	return () unless defined($hdr);
+	my ($lhi, $llo, $type, $flags, $id) = unpack('CnCCN', $hdr);
+	my $payload = h2_read($sock, ($lhi << 16) | $llo);
+	return () unless defined($payload);
+	return ($type, $flags, $id & 0x7fffffff, $payload);
+}
+
+sub h2_response_headers {
+	my ($id, $k, $v) = @_;
+	# ":status: 200" (static table index 8) and literal header field
+	return h2_frame(1, 0x4|0x1, $id, # HEADERS (END_HEADERS|END_STREAM)
+	                "\x88\x00".chr(length($k)).$k.chr(length($v)).$v);
+}
+
+my @cases = (
+	[ 'WINDOW_UPDATE 0 increment on stream; RST_STREAM PROTOCOL_ERROR',
+	  sub { h2_frame(8, 0, $_[0], pack('N', 0)) }, 'RST_STREAM 1' ],
+	[ 'WINDOW_UPDATE stream window overflow; RST_STREAM FLOW_CONTROL_ERROR',
+	  sub { h2_frame(8, 0, $_[0], pack('N', 0x7fffffff)) }, 'RST_STREAM 3' ],
+	[ 'WINDOW_UPDATE 0 increment on connection; GOAWAY PROTOCOL_ERROR',
+	  sub { h2_frame(8, 0, 0, pack('N', 0)) }, 'GOAWAY 1' ],
+	[ 'WINDOW_UPDATE connection window overflow; GOAWAY FLOW_CONTROL_ERROR',
+	  sub { h2_frame(8, 0, 0, pack('N', 0x7fffffff)) }, 'GOAWAY 3' ],
+	[ 'response header name with uppercase; RST_STREAM PROTOCOL_ERROR',
+	  sub { h2_response_headers($_[0], 'X-Test', 'a') }, 'RST_STREAM 1' ],
+	[ 'response header name with non-leading colon; RST_STREAM PROTOCOL_ERROR',
+	  sub { h2_response_headers($_[0], 'x:test', 'a') }, 'RST_STREAM 1' ],
+);
+
+my $listen = IO::Socket::INET->new(
+	Listen    => 5,
+	LocalAddr => '127.0.0.1',
+	LocalPort => 0,
+	ReuseAddr => 1,
+	Proto     => 'tcp') or die("listen: $!");
+pipe(my $rd, my $wr) or die("pipe: $!");
+my $pid = fork();
+die("fork: $!") unless defined($pid);
+if (0 == $pid) {
+	close($rd);
+	foreach my $case (@cases) {
+		my $sock = $listen->accept() or exit(1);
+		my $result = 'none';
+		eval {
+			local $SIG{ALRM} = sub { die("timeout\n"); };
+			alarm(5);
+			h2_read($sock, 24); # connection preface
+			syswrite($sock, h2_frame(4, 0, 0, '')             # SETTINGS
+			               .h2_frame(7, 0, 0, pack('NN', 1, 0))); # GOAWAY
+			my ($type, $flags, $id, $payload);
+			do { ($type, $flags, $id, $payload) = h2_read_frame($sock); }
+			  while (defined($type) && $type != 1); # HEADERS
+			syswrite($sock, $case->[1]->($id)) if (defined($type));
+			while (($type, $flags, $id, $payload) = h2_read_frame($sock)) {
+				if ($type == 3) {
+					$result = 'RST_STREAM '.unpack('N', $payload);
+					last;
+				}
+				if ($type == 7) {
+					$result = 'GOAWAY '.unpack('N', substr($payload, 4, 4));
+					last;
+				}
+			}
+			alarm(0);
+		};
+		close($sock);
+		syswrite($wr, "$result\n");
+	}
+	exit(0);
+}
+close($wr);
+
+$ENV{EPHEMERAL_PORT} = $listen->sockport();
+my $tf_frames = LightyTest->new();
+$tf_frames->{CONFIGFILE} = 'proxy-h2c.conf';
+ok($tf_frames->start_proc == 0, "Starting lighttpd as proxy to scripted backend") or die();
+close($listen);
+
+$t->{REQUEST}  = ( <<EOF
+GET /frames HTTP/1.0
+Host: www.example.org
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 502 } ];
+foreach my $case (@cases) {
+	my $rc = $tf_frames->handle_http($t);
+	my $result = <$rd>;
+	chomp($result) if (defined($result));
+	ok($rc == 0 && defined($result) && $result eq $case->[2], $case->[0]);
+}
+close($rd);
+waitpid($pid, 0);
+
+ok($tf_frames->stop_proc == 0, "Stopping lighttpd proxy to scripted backend");
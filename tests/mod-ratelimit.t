@@ -0,0 +1,112 @@
+#!/usr/bin/env perl
+BEGIN {
+	# add current source dir to the include-path
+	# we need this for make distcheck
+	(my $srcdir = $0) =~ s,/[^/]+$,/,;
+	unshift @INC, $srcdir;
+}
+
+use strict;
+use Test::More tests => 19;
+use LightyTest;
+
+my $tf = LightyTest->new();
+
+my $t;
+
+$tf->{CONFIGFILE} = 'ratelimit.conf';
+ok($tf->start_proc == 0, "Starting lighttpd with $tf->{CONFIGFILE}") or die();
+
+# (requests allowed through mod_ratelimit are 404 Not Found)
+
+# "key" => "remote-ip" (default); "rate" => 1, "period" => 1, "burst" => 2
+$t->{REQUEST}  = ( <<EOF
+GET /ip/ HTTP/1.0
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 404, '-Retry-After' => '' } ];
+ok($tf->handle_http($t) == 0, 'remote-ip: burst (1)');
+ok($tf->handle_http($t) == 0, 'remote-ip: burst (2)');
+
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 429, 'Retry-After' => '1' } ];
+ok($tf->handle_http($t) == 0, 'remote-ip: burst exceeded; 429 with Retry-After');
+
+# bucket refills at "rate" per "period", up to "burst"
+sleep(3);
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 404, '-Retry-After' => '' } ];
+ok($tf->handle_http($t) == 0, 'remote-ip: refill (1)');
+ok($tf->handle_http($t) == 0, 'remote-ip: refill (2)');
+
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 429, 'Retry-After' => '1' } ];
+ok($tf->handle_http($t) == 0, 'remote-ip: refill limited to burst');
+
+# "key" => "host"; "rate" => 1, "period" => 60 (and "burst" defaults to rate)
+$t->{REQUEST}  = ( <<EOF
+GET /host/ HTTP/1.0
+Host: a.example.org
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 404, '-Retry-After' => '' } ];
+ok($tf->handle_http($t) == 0, 'host: allowed');
+
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 429, 'Retry-After' => '60' } ];
+ok($tf->handle_http($t) == 0, 'host: limited');
+
+$t->{REQUEST}  = ( <<EOF
+GET /host/ HTTP/1.0
+Host: b.example.org
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 404, '-Retry-After' => '' } ];
+ok($tf->handle_http($t) == 0, 'host: separate bucket for different host');
+
+# "key" => "url-prefix" (first url-path segment)
+$t->{REQUEST}  = ( <<EOF
+GET /prefix-a/1 HTTP/1.0
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 404, '-Retry-After' => '' } ];
+ok($tf->handle_http($t) == 0, 'url-prefix: allowed');
+
+$t->{REQUEST}  = ( <<EOF
+GET /prefix-a/2 HTTP/1.0
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 429, 'Retry-After' => '60' } ];
+ok($tf->handle_http($t) == 0, 'url-prefix: limited for same prefix');
+
+$t->{REQUEST}  = ( <<EOF
+GET /prefix-b/1 HTTP/1.0
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 404, '-Retry-After' => '' } ];
+ok($tf->handle_http($t) == 0, 'url-prefix: separate bucket for different prefix');
+
+# "key" => "user" (REMOTE_USER); requests without authenticated user not limited
+$t->{REQUEST}  = ( <<EOF
+GET /user/ HTTP/1.0
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 404, '-Retry-After' => '' } ];
+ok($tf->handle_http($t) == 0, 'user: no user; not limited (1)');
+ok($tf->handle_http($t) == 0, 'user: no user; not limited (2)');
+
+$t->{REQUEST}  = ( <<EOF
+GET /user/auth/ HTTP/1.0
+Authorization: Basic amFuOmphbg==
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 404, '-Retry-After' => '' } ];
+ok($tf->handle_http($t) == 0, 'user: allowed');
+
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 429, 'Retry-After' => '60' } ];
+ok($tf->handle_http($t) == 0, 'user: limited');
+
+$t->{REQUEST}  = ( <<EOF
+GET /user/ HTTP/1.0
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.0', 'HTTP-Status' => 404, '-Retry-After' => '' } ];
+ok($tf->handle_http($t) == 0, 'user: no user; not limited by user bucket');
+
+ok($tf->stop_proc == 0, "Stopping lighttpd");
@@ -8,7 +8,7 @@ BEGIN {
 
 use strict;
 use IO::Socket;
-use Test::More tests => 164;
+use Test::More tests => 176;
 use LightyTest;
 
 my $tf = LightyTest->new();
@@ -295,6 +295,165 @@ EOF
 $t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 400 } ];
 ok($tf->handle_http($t) == 0, 'POST via Transfer-Encoding: chunked; chunked header too long');
 
+# send request in parts, pausing between parts so that each part is
+# received in a separate read; return response body (undef if not 200 OK)
+sub chunked_post_parts {
+	my $sock = IO::Socket::INET->new(
+		PeerAddr => '127.0.0.1',
+		PeerPort => $tf->{PORT},
+		Proto    => 'tcp') or die("connect: $!");
+	my $hdrs = "POST /cgi.pl?post-echo HTTP/1.1\r\n"
+	         . "Host: www.example.org\r\n"
+	         . "Connection: close\r\n"
+	         . "Transfer-Encoding: chunked\r\n\r\n";
+	$sock->autoflush(1);
+	foreach my $part ($hdrs . shift, @_) {
+		print $sock $part;
+		select(undef, undef, undef, 0.25);
+	}
+	local $/;
+	my $resp = <$sock>;
+	close($sock);
+	my ($head, $body) = split(/\r\n\r\n/, $resp, 2);
+	return $head =~ m{^HTTP/1\.1 200 } ? $body : undef;
+}
+
+my $data = join('', map { sprintf("%04d", $_) } (1..256));
+$t->{REQUEST}  = "POST /cgi.pl?post-echo HTTP/1.1\n"
+               . "Host: www.example.org\n"
+               . "Connection: close\n"
+               . "Transfer-Encoding: chunked\n\n"
+               . join('', map { "4\n$_\n" } unpack("(A4)*", $data))
+               . "0\n";
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 200, 'HTTP-Content' => $data } ];
+ok($tf->handle_http($t) == 0, 'POST via Transfer-Encoding: chunked; many small chunks');
+
+$t->{REQUEST}  = "POST /cgi.pl?post-echo HTTP/1.1\n"
+               . "Host: www.example.org\n"
+               . "Connection: close\n"
+               . "Transfer-Encoding: chunked\n\n"
+               . join('', map { "4\n$_\n" } unpack("(A4)*", $data))
+               . "0\nTest-Trailer: testing\n";
+ok($tf->handle_http($t) == 0, 'POST via Transfer-Encoding: chunked; many small chunks with trailer');
+
+$t->{REQUEST}  = ( <<EOF
+POST /cgi.pl?post-echo HTTP/1.1
+Host: www.example.org
+Connection: close
+Transfer-Encoding: chunked
+
+5
+abcde
+000000a
+0123456789
+0000000a
+0123456789
+5
+fghij
+0
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 200, 'HTTP-Content' => 'abcde01234567890123456789fghij' } ];
+ok($tf->handle_http($t) == 0, 'POST via Transfer-Encoding: chunked; 7 and 8 hex digit chunk sizes');
+
+$t->{REQUEST}  = ( <<EOF
+POST /cgi.pl?post-echo HTTP/1.1
+Host: www.example.org
+Connection: close
+Transfer-Encoding: chunked
+
+5
+abcde
+5
+fghij
+5; ext=1
+klmno
+5
+pqrst
+5
+uvwxy
+0
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 200, 'HTTP-Content' => 'abcdefghijklmnopqrstuvwxy' } ];
+ok($tf->handle_http($t) == 0, 'POST via Transfer-Encoding: chunked; chunk extension following decoded chunks');
+
+$t->{REQUEST}  = "POST /cgi.pl?post-echo HTTP/1.1\n"
+               . "Host: www.example.org\n"
+               . "Connection: close\n"
+               . "Transfer-Encoding: chunked\n\n"
+               . "5\nabcde\n"
+               . sprintf("%x\n", 40000) . ('x' x 40000) . "\n"
+               . "5\nfghij\n"
+               . "0\n";
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 200, 'HTTP-Content' => 'abcde' . ('x' x 40000) . 'fghij' } ];
+ok($tf->handle_http($t) == 0, 'POST via Transfer-Encoding: chunked; large chunk following small chunk');
+
+$data = join('', map { sprintf("%032d", $_) } (1..2560));
+$t->{REQUEST}  = "POST /cgi.pl?post-echo HTTP/1.1\n"
+               . "Host: www.example.org\n"
+               . "Connection: close\n"
+               . "Transfer-Encoding: chunked\n\n"
+               . join('', map { "20\n$_\n" } unpack("(A32)*", $data))
+               . "0\n";
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 200, 'HTTP-Content' => $data } ];
+ok($tf->handle_http($t) == 0, 'POST via Transfer-Encoding: chunked; many small chunks > 64k');
+
+ok((chunked_post_parts("5\r\nabcde\r\n5\r\nfghij\r\n",
+                       "5\r\nklmno\r\n0\r\n\r\n") // '')
+   eq 'abcdefghijklmno',
+   'POST via Transfer-Encoding: chunked; read ends at end of chunk');
+
+ok((chunked_post_parts("5\r\nabcde\r\n10\r\n01234567",
+                       "89abcdef\r\n5\r\nfghij\r\n0\r\n\r\n") // '')
+   eq 'abcde0123456789abcdeffghij',
+   'POST via Transfer-Encoding: chunked; chunk crosses end of read');
+
+ok((chunked_post_parts("5\r\nabcde\r\n5\r",
+                       "\nfghij\r",
+                       "\n0\r\n\r\n") // '')
+   eq 'abcdefghij',
+   'POST via Transfer-Encoding: chunked; chunk header and CRLF cross end of read');
+
+$t->{REQUEST}  = "POST /cgi.pl?post-echo HTTP/1.1\n"
+               . "Host: reqsize.example.org\n"
+               . "Connection: close\n"
+               . "Transfer-Encoding: chunked\n\n"
+               . join('', map { "4\n$_\n" } unpack("(A4)*", substr($data, 0, 2048)))
+               . "0\n";
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 413 } ];
+ok($tf->handle_http($t) == 0, 'POST via Transfer-Encoding: chunked; many small chunks exceed server.max-request-size');
+
+## pipelining
+
+$t->{REQUEST}  = ( <<EOF
+GET /nofile-1 HTTP/1.1
+Host: 123.example.org
+
+GET /nofile-2 HTTP/1.1
+Host: 123.example.org
+
+GET /nofile-3 HTTP/1.1
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 404 }, { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 404 }, { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 400 } ];
+ok($tf->handle_http($t) == 0, 'pipelined requests followed by bad request');
+
+$t->{REQUEST}  = ( <<EOF
+GET /nofile-1 HTTP/1.1
+Host: 123.example.org
+
+GET /nofile-2 HTTP/1.1
+Host: 123.example.org
+
+POST /cgi.pl?post-len HTTP/1.1
+Host: www.example.org
+Content-Length: 10
+EOF
+ );
+$t->{RESPONSE} = [ { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 404 }, { 'HTTP-Protocol' => 'HTTP/1.1', 'HTTP-Status' => 404 } ];
+ok($tf->handle_http($t) == 0, 'pipelined requests followed by incomplete request');
+
 ## ranges
 
 $t->{REQUEST}  = ( <<EOF